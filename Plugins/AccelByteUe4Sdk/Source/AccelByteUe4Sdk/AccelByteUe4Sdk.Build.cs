@@ -27,6 +27,13 @@ public class AccelByteUe4Sdk : ModuleRules
             "SSL",
         });
 
+        PrivateDependencyModuleNames.AddRange(new string[]
+        {
+            "Projects",
+        });
+
+        AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
         if (Target.bBuildEditor == true)
         {
             PrivateDependencyModuleNames.AddRange(new string[]
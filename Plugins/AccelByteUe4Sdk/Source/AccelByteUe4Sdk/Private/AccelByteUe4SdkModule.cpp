@@ -5,7 +5,10 @@
 #include "AccelByteUe4SdkModule.h"
 #include "AccelByteRegistry.h"
 #include "AccelByteHttpRetryScheduler.h"
+#include "AccelByteHttpWorker.h"
+#include "AccelByteTrace.h"
 #include "CoreUObject.h"
+#include "Misc/Paths.h"
 #include "Runtime/Core/Public/Containers/Ticker.h"
 
 #if WITH_EDITOR
@@ -30,16 +33,37 @@ void FAccelByteUe4SdkModule::StartupModule()
 {
 	RegisterSettings();
 	LoadSettingsFromConfigUobject();
+
+	if (FRegistry::Settings.bPersistResponseCache)
+	{
+		FRegistry::HttpRetryScheduler.SetResponseStoreDirectory(FPaths::ProjectSavedDir() / TEXT("AccelByte") / TEXT("ResponseCache"));
+	}
+
+	if (FRegistry::Settings.bJournalWrites)
+	{
+		FRegistry::HttpRetryScheduler.SetJournalDirectory(FPaths::ProjectSavedDir() / TEXT("AccelByte") / TEXT("Journal"));
+	}
+
+	Trace::SetHitchDump(FPaths::ProjectSavedDir() / TEXT("AccelByte") / TEXT("Traces"), 0.1);
+
+	if (FRegistry::Settings.bTraceEnabled)
+	{
+		Trace::Enable();
+	}
+
+	FRegistry::HttpWorker.Startup();
 	FTicker& Ticker = FTicker::GetCoreTicker();
 
+	// Scheduling and decoding run on the worker, results are delivered every frame
 	Ticker.AddTicker(
 		FTickerDelegate::CreateLambda([](float DeltaTime)
 		{
-			FRegistry::HttpRetryScheduler.PollRetry(FPlatformTime::Seconds(), FRegistry::Credentials);
+			FRegistry::HttpWorker.PollGameThread();
+			Trace::OnFrame(DeltaTime);
 
 			return true;
 		}),
-		0.2f);
+		0.0f);
 
 	Ticker.AddTicker(
 		FTickerDelegate::CreateLambda([](float DeltaTime)
@@ -53,6 +77,11 @@ void FAccelByteUe4SdkModule::StartupModule()
 
 void FAccelByteUe4SdkModule::ShutdownModule()
 {
+	FRegistry::HttpWorker.Shutdown();
+	// Writes the index of the open partition
+	FRegistry::HttpRetryScheduler.SetResponseStoreDirectory(FString());
+	// Finishes a hitch dump still being written
+	Trace::SetHitchDump(FString(), 0.0);
 	UnregisterSettings();
 }
 
@@ -99,6 +128,10 @@ bool FAccelByteUe4SdkModule::LoadSettingsFromConfigUobject()
 	FRegistry::Settings.BasicServerUrl = GetDefault<UAccelByteSettings>()->BasicServerUrl;
 	FRegistry::Settings.CloudStorageServerUrl = GetDefault<UAccelByteSettings>()->CloudStorageServerUrl;
 	FRegistry::Settings.GameProfileServerUrl = GetDefault<UAccelByteSettings>()->GameProfileServerUrl;
+	FRegistry::Settings.bPersistResponseCache = GetDefault<UAccelByteSettings>()->bPersistResponseCache;
+	FRegistry::Settings.bJournalWrites = GetDefault<UAccelByteSettings>()->bJournalWrites;
+	FRegistry::Settings.bRetryKeyedWrites = GetDefault<UAccelByteSettings>()->bRetryKeyedWrites;
+	FRegistry::Settings.bTraceEnabled = GetDefault<UAccelByteSettings>()->bTraceEnabled;
 	FRegistry::Credentials.SetClientCredentials(FRegistry::Settings.ClientId, FRegistry::Settings.ClientSecret);
 	
 	return true;
@@ -6,6 +6,9 @@
 #include "AccelByteError.h"
 #include "JsonUtilities.h"
 #include "AccelByteRegistry.h"
+#include "AccelByteHttpRetryScheduler.h"
+#include "AccelByteHttpRequestFactory.h"
+#include "Core/AccelByteEndpoints.h"
 
 namespace AccelByte
 {
@@ -13,188 +16,87 @@ namespace Api
 {
 	void CloudStorage::GetAllSlots(const THandler<TArray<FAccelByteModelsSlot>>& OnSuccess, const FErrorHandler& OnError)
 	{
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-		FString Url				= FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/slots"), *FRegistry::Settings.CloudStorageServerUrl, *FRegistry::Credentials.GetUserNamespace(), *FRegistry::Credentials.GetUserId());
-		FString Verb			= TEXT("GET");
-		FString ContentType		= TEXT("application/json");
-		FString Accept			= TEXT("application/json");
-		FString Content			= TEXT("");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
-		Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-		Request->ProcessRequest();
+		FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::CloudStorage::GetAllSlots);
+
+		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void CloudStorage::CreateSlot(TArray<uint8> BinaryData, const FString& FileName, const TArray<FString>& Tags, const FString& Label, const FString& CustomAttribute, const THandler<FAccelByteModelsSlot>& OnSuccess, FHttpRequestProgressDelegate OnProgress, const FErrorHandler& OnError)
 	{
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-		FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/slots"), *FRegistry::Settings.CloudStorageServerUrl, *FRegistry::Credentials.GetUserNamespace(), *FRegistry::Credentials.GetUserId());
-
-		if (Tags.Num() != 0 || !Label.IsEmpty())
-		{
-			Url.Append(TEXT("?"));
-		}
-
-		if (Tags.Num() != 0)
-		{
-			for (int i = 0; i < Tags.Num(); i++)
-			{
-				Url.Append(FString::Printf(TEXT("tags=%s&"), *FGenericPlatformHttp::UrlEncode(Tags[i])));
-			}
-		}
-		if (!Label.IsEmpty())
+		FHttpQuery Query;
+		for (const FString& Tag : Tags)
 		{
-			Url.Append(FString::Printf(TEXT("label=%s"), *FGenericPlatformHttp::UrlEncode(Label)));
+			Query.Add(TEXT("tags"), FGenericPlatformHttp::UrlEncode(Tag));
 		}
+		Query.Add(TEXT("label"), FGenericPlatformHttp::UrlEncode(Label));
 
-		FString Verb = TEXT("POST");
-		FString Accept = TEXT("*/*");
 		FString BoundaryGuid = FGuid::NewGuid().ToString();
 		TArray<uint8> Content = CustomAttributeFormDataBuilder(CustomAttribute, BoundaryGuid, false);
 		Content.Append(FormDataBuilder(BinaryData, BoundaryGuid, FileName));
 
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Accept"), Accept);
+		FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::CloudStorage::CreateSlot, {}, Query);
 		Request->SetHeader(TEXT("Content-Type"), FString::Printf(TEXT("multipart/form-data; boundary=%s"), *BoundaryGuid));
-
 		Request->SetContent(Content);
 		Request->OnRequestProgress() = OnProgress;
-		Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-		Request->ProcessRequest();
+
+		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Background, FHttpRetryPolicy::Upload(Content.Num()));
 		UE_LOG(LogTemp, Log, TEXT("[AccelByte] Cloud Storage Start uploading..."));
 	}
 
 	void CloudStorage::GetSlot(FString SlotID, const THandler<TArray<uint8>> & OnSuccess, const FErrorHandler & OnError)
 	{
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-		FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/slots/%s"), *FRegistry::Settings.CloudStorageServerUrl, *FRegistry::Credentials.GetUserNamespace(), *FRegistry::Credentials.GetUserId(), *SlotID);
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("*/*");
-		FString Content = TEXT("");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
-		Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-		Request->ProcessRequest();
+		FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::CloudStorage::GetSlot, { *SlotID });
+
+		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	void CloudStorage::UpdateSlot(FString SlotID, const TArray<uint8> BinaryData, const FString& FileName, const TArray<FString> & Tags, const FString& Label, const FString& CustomAttribute, const THandler<FAccelByteModelsSlot> & OnSuccess, FHttpRequestProgressDelegate OnProgress, const FErrorHandler & OnError)
 	{
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-		
-		FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/slots/%s"), *FRegistry::Settings.CloudStorageServerUrl, *FRegistry::Credentials.GetUserNamespace(), *FRegistry::Credentials.GetUserId(), *SlotID);
-
-		if (Tags.Num() != 0 || !Label.IsEmpty())
-		{
-			Url.Append(TEXT("?"));
-		}
-
-		if (Tags.Num() != 0)
-		{
-			for (int i = 0; i < Tags.Num(); i++)
-			{
-				Url.Append(FString::Printf(TEXT("tags=%s&"), *FGenericPlatformHttp::UrlEncode(Tags[i])));
-			}
-		}
-		if (!Label.IsEmpty())
+		FHttpQuery Query;
+		for (const FString& Tag : Tags)
 		{
-			Url.Append(FString::Printf(TEXT("label=%s"), *FGenericPlatformHttp::UrlEncode(Label)));
+			Query.Add(TEXT("tags"), FGenericPlatformHttp::UrlEncode(Tag));
 		}
+		Query.Add(TEXT("label"), FGenericPlatformHttp::UrlEncode(Label));
 
-		FString Verb = TEXT("PUT");
-		FString Accept = TEXT("*/*");
 		FString BoundaryGuid = FGuid::NewGuid().ToString();
 		TArray<uint8> Content = CustomAttributeFormDataBuilder(CustomAttribute, BoundaryGuid, false);
 		Content.Append(FormDataBuilder(BinaryData, BoundaryGuid, FileName));
 
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Accept"), Accept);
+		FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::CloudStorage::UpdateSlot, { *SlotID }, Query);
 		Request->SetHeader(TEXT("Content-Type"), FString::Printf(TEXT("multipart/form-data; boundary=%s"), *BoundaryGuid));
-
 		Request->SetContent(Content);
 		Request->OnRequestProgress() = OnProgress;
-		Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-		Request->ProcessRequest();
+
+		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Background, FHttpRetryPolicy::Upload(Content.Num()));
 		UE_LOG(LogTemp, Log, TEXT("[AccelByte] Cloud Storage Start uploading..."));
 	}
 
 	void CloudStorage::UpdateSlotMetadata(FString SlotID, const FString& FileName, const TArray<FString> & Tags, const FString& Label, const FString& CustomAttribute, const THandler<FAccelByteModelsSlot> & OnSuccess, FHttpRequestProgressDelegate OnProgress, const FErrorHandler & OnError)
 	{
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-		
-		FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/slots/%s/metadata"), *FRegistry::Settings.CloudStorageServerUrl, *FRegistry::Credentials.GetUserNamespace(), *FRegistry::Credentials.GetUserId(), *SlotID);
-
-		if (Tags.Num() != 0 || !Label.IsEmpty())
+		FHttpQuery Query;
+		for (const FString& Tag : Tags)
 		{
-			Url.Append(TEXT("?"));
+			Query.Add(TEXT("tags"), FGenericPlatformHttp::UrlEncode(Tag));
 		}
+		Query.Add(TEXT("label"), FGenericPlatformHttp::UrlEncode(Label));
 
-		if (Tags.Num() != 0)
-		{
-			for (int i = 0; i < Tags.Num(); i++)
-			{
-				Url.Append(FString::Printf(TEXT("tags=%s&"), *FGenericPlatformHttp::UrlEncode(Tags[i])));
-			}
-		}
-		if (!Label.IsEmpty())
-		{
-			Url.Append(FString::Printf(TEXT("label=%s"), *FGenericPlatformHttp::UrlEncode(Label)));
-		}
-
-		FString Verb = TEXT("PUT");
-		FString Accept = TEXT("*/*");
 		FString BoundaryGuid = FGuid::NewGuid().ToString();
 		TArray<uint8> Content = CustomAttributeFormDataBuilder(CustomAttribute, BoundaryGuid, true);
 
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Accept"), Accept);
+		FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::CloudStorage::UpdateSlotMetadata, { *SlotID }, Query);
 		Request->SetHeader(TEXT("Content-Type"), FString::Printf(TEXT("multipart/form-data; boundary=%s"), *BoundaryGuid));
-		
 		Request->SetContent(Content);
 		Request->OnRequestProgress() = OnProgress;
-		Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-		Request->ProcessRequest();
+
+		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Interactive, FHttpRetryPolicy::Durable());
 	}
 
 	void CloudStorage::DeleteSlot(FString SlotID, const FVoidHandler & OnSuccess, const FErrorHandler & OnError)
 	{
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-		FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/slots/%s"), *FRegistry::Settings.CloudStorageServerUrl, *FRegistry::Credentials.GetUserNamespace(), *FRegistry::Credentials.GetUserId(), *SlotID);
-		FString Verb = TEXT("DELETE");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("*/*");
-		FString Content = TEXT("");
-
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
-		Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-		Request->ProcessRequest();
+		FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::CloudStorage::DeleteSlot, { *SlotID });
+
+		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 	}
 
 	TArray<uint8> CloudStorage::FormDataBuilder(TArray<uint8> BinaryData, FString BoundaryGuid, FString FileName)
@@ -9,13 +9,14 @@
 #include "AccelByteRegistry.h"
 #include "AccelByteHttpRetryScheduler.h"
 #include "AccelByteSettings.h"
+#include "Core/AccelByteEndpoints.h"
 
 namespace AccelByte
 {
 namespace Api
 {
 
-GameProfile::GameProfile(const Credentials& Credentials, const AccelByte::Settings& Setting) : GameProfileCredentials(Credentials), GameProfileSettings(Setting)
+GameProfile::GameProfile(const Credentials& Credentials, const AccelByte::Settings& Setting) : GameProfileCredentials(Credentials), GameProfileSettings(Setting), RequestFactory(Setting, Credentials)
 {
 }
 
@@ -29,163 +30,77 @@ void GameProfile::BatchGetPublicGameProfiles(TArray<FString> UserIds, const THan
 	}
 	else
 	{
-		FString Authorization = FString::Printf(TEXT("Bearer %s"), *GameProfileCredentials.GetUserAccessToken());
-		FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/profiles"), *GameProfileSettings.GameProfileServerUrl, *GameProfileCredentials.GetUserNamespace());
-		FString Verb = TEXT("GET");
-		FString ContentType = TEXT("application/json");
-		FString Accept = TEXT("application/json");
-		FString Content;
-
-		for (int i = 0 ; i < UserIds.Num() ; i++)
+		FHttpQuery Query;
+		for (const FString& UserId : UserIds)
 		{
-			Url.Append((i == 0) ? TEXT("?") : TEXT("&")).Append(TEXT("userIds=")).Append(UserIds[i]);
+			Query.Add(TEXT("userIds"), UserId);
 		}
 
-		FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-		Request->SetURL(Url);
-		Request->SetHeader(TEXT("Authorization"), Authorization);
-		Request->SetVerb(Verb);
-		Request->SetHeader(TEXT("Content-Type"), ContentType);
-		Request->SetHeader(TEXT("Accept"), Accept);
-		Request->SetContentAsString(Content);
-		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+		FHttpRequestPtr Request = RequestFactory.Create(Endpoints::GameProfile::BatchGetPublicGameProfiles, {}, Query);
+
+		FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Interactive, FHttpRetryPolicy::Hedged());
 	}
 }
 
 void GameProfile::GetAllGameProfiles(const THandler<TArray<FAccelByteModelsGameProfile>>& OnSuccess, const FErrorHandler & OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *GameProfileCredentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles"), *GameProfileSettings.GameProfileServerUrl, *GameProfileCredentials.GetUserNamespace(), *GameProfileCredentials.GetUserId());
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
+	FHttpRequestPtr Request = RequestFactory.Create(Endpoints::GameProfile::GetAllGameProfiles);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void GameProfile::CreateGameProfile(const FAccelByteModelsGameProfileRequest & GameProfileRequest, const THandler<FAccelByteModelsGameProfile>& OnSuccess, const FErrorHandler & OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *GameProfileCredentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles"), *GameProfileSettings.GameProfileServerUrl, *GameProfileCredentials.GetUserNamespace(), *GameProfileCredentials.GetUserId());
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString<FAccelByteModelsGameProfileRequest>(GameProfileRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = RequestFactory.Create(Endpoints::GameProfile::CreateGameProfile);
+	RequestFactory.SetContent(Request, Endpoints::GameProfile::CreateGameProfile, Content);
+
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void GameProfile::GetGameProfile(const FString & ProfileId, const THandler<FAccelByteModelsGameProfile>& OnSuccess, const FErrorHandler & OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *GameProfileCredentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles/%s"), *GameProfileSettings.GameProfileServerUrl, *GameProfileCredentials.GetUserNamespace(), *GameProfileCredentials.GetUserId(), *ProfileId);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
+	FHttpRequestPtr Request = RequestFactory.Create(Endpoints::GameProfile::GetGameProfile, { *ProfileId });
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void GameProfile::UpdateGameProfile(const FString & ProfileId, const FAccelByteModelsGameProfileRequest & GameProfileRequest, const THandler<FAccelByteModelsGameProfile>& OnSuccess, const FErrorHandler & OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *GameProfileCredentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles/%s"), *GameProfileSettings.GameProfileServerUrl, *GameProfileCredentials.GetUserNamespace(), *GameProfileCredentials.GetUserId(), *ProfileId);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(GameProfileRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = RequestFactory.Create(Endpoints::GameProfile::UpdateGameProfile, { *ProfileId });
+	RequestFactory.SetContent(Request, Endpoints::GameProfile::UpdateGameProfile, Content);
+
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void GameProfile::DeleteGameProfile(const FString & ProfileId, const FVoidHandler& OnSuccess, const FErrorHandler & OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *GameProfileCredentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles/%s"), *GameProfileSettings.GameProfileServerUrl, *GameProfileCredentials.GetUserNamespace(), *GameProfileCredentials.GetUserId(), *ProfileId);
-	FString Verb = TEXT("DELETE");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
+	FHttpRequestPtr Request = RequestFactory.Create(Endpoints::GameProfile::DeleteGameProfile, { *ProfileId });
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void GameProfile::GetGameProfileAttribute(const FString & ProfileId, const FString & AttributeName, const THandler<FAccelByteModelsGameProfileAttribute>& OnSuccess, const FErrorHandler & OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *GameProfileCredentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles/%s/attributes/%s"), *GameProfileSettings.GameProfileServerUrl, *GameProfileCredentials.GetUserNamespace(), *GameProfileCredentials.GetUserId(), *ProfileId, *AttributeName);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
+	FHttpRequestPtr Request = RequestFactory.Create(Endpoints::GameProfile::GetGameProfileAttribute, { *ProfileId, *AttributeName });
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void GameProfile::UpdateGameProfileAttribute(const FString & ProfileId, const FAccelByteModelsGameProfileAttribute& Attribute, const THandler<FAccelByteModelsGameProfile>& OnSuccess, const FErrorHandler & OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *GameProfileCredentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/users/%s/profiles/%s/attributes/%s"), *GameProfileSettings.GameProfileServerUrl, *GameProfileCredentials.GetUserNamespace(), *GameProfileCredentials.GetUserId(), *ProfileId, *Attribute.name);
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(Attribute, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FHttpRequestPtr Request = RequestFactory.Create(Endpoints::GameProfile::UpdateGameProfileAttribute, { *ProfileId, *Attribute.name });
+	RequestFactory.SetContent(Request, Endpoints::GameProfile::UpdateGameProfileAttribute, Content);
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Interactive, FHttpRetryPolicy::Durable());
 }
 
 } // Namespace Api
@@ -7,6 +7,8 @@
 #include "JsonUtilities.h"
 #include "AccelByteRegistry.h"
 #include "AccelByteHttpRetryScheduler.h"
+#include "AccelByteHttpRequestFactory.h"
+#include "Core/AccelByteEndpoints.h"
 
 namespace AccelByte
 {
@@ -29,70 +31,28 @@ FString EAccelByteItemStatusToString(const EAccelByteItemStatus& EnumValue) {
 
 void Item::GetItemById(const FString& ItemId, const FString& Language, const FString& Region, const THandler<FAccelByteModelsItemInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/items/%s/locale"), *FRegistry::Settings.PlatformServerUrl, *FRegistry::Credentials.GetUserNamespace(), *ItemId);
-	if (!Region.IsEmpty() || !Language.IsEmpty())
-	{
-		Url.Append(FString::Printf(TEXT("?")));
-		if (!Region.IsEmpty())
-		{
-			Url.Append(FString::Printf(TEXT("region=%s"), *Region));
-			if (!Language.IsEmpty())
-			{
-				Url.Append(FString::Printf(TEXT("&language=%s"), *Language));
-			}
-		}
-		else if (!Language.IsEmpty())
-		{
-			Url.Append(FString::Printf(TEXT("language=%s"), *Language));
-		}
-	}
-
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::Item::GetItemById, { *ItemId }, FHttpQuery().Add(TEXT("region"), Region).Add(TEXT("language"), Language));
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
-
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Interactive, FHttpRetryPolicy::Hedged());
 }
 
 void Item::GetItemsByCriteria(const FString& Language, const FString& Region, const FString& CategoryPath, const EAccelByteItemType& ItemType, const EAccelByteItemStatus& Status, int32 Page, int32 Size, const THandler<FAccelByteModelsItemPagingSlicedResult>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/public/namespaces/%s/items/byCriteria?categoryPath=%s&region=%s"), *FRegistry::Settings.PlatformServerUrl, *FRegistry::Settings.Namespace, *FGenericPlatformHttp::UrlEncode(CategoryPath), *Region);
-	if (!Language.IsEmpty())
-	{
-		Url.Append(FString::Printf(TEXT("&language=%s"), *Language));
-	}	
+	FHttpQuery Query;
+	Query.AddRequired(TEXT("categoryPath"), FGenericPlatformHttp::UrlEncode(CategoryPath));
+	Query.AddRequired(TEXT("region"), Region);
+	Query.Add(TEXT("language"), Language);
 	if (ItemType != EAccelByteItemType::NONE)
 	{
-		Url.Append(FString::Printf(TEXT("&itemType=%s"), *EAccelByteItemTypeToString(ItemType)));
+		Query.Add(TEXT("itemType"), EAccelByteItemTypeToString(ItemType));
 	}
-	Url.Append(FString::Printf(TEXT("&page=%d"), Page));
+	Query.Add(TEXT("page"), Page);
 	if (Size > 0)
 	{
-		Url.Append(FString::Printf(TEXT("&size=%d"), Size));
+		Query.Add(TEXT("size"), Size);
 	}
-	FString Verb		= TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept		= TEXT("application/json");
-	FString Content		= TEXT("");
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::Item::GetItemsByCriteria, {}, Query);
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
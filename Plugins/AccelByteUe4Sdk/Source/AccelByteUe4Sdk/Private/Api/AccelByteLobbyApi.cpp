@@ -9,6 +9,7 @@
 #include "AccelByteCredentials.h"
 #include "AccelByteRegistry.h"
 #include "AccelByteSettings.h"
+#include "AccelByteTrace.h"
 
 namespace AccelByte
 {
@@ -348,6 +349,8 @@ FString Lobby::SendRawRequest(FString MessageType, FString MessageIDPrefix, FStr
         {
             Content.Append(FString::Printf(TEXT("\n%s"), *CustomPayload));
         }
+        // Closed by the response carrying the same id, see OnMessage
+        Trace::Begin(TEXT("Lobby"), TEXT("Request"), Trace::GetId(MessageID), MessageType);
         WebSocket->Send(Content);
         UE_LOG(LogTemp, Display, TEXT("Sending request: %s"), *Content);
         return MessageID;
@@ -404,18 +407,33 @@ FString Lobby::LobbyMessageToJson(FString Message)
 
 void Lobby::OnMessage(const FString& Message)
 {
+    Trace::FScope TraceScope(TEXT("Lobby"), TEXT("OnMessage"));
     UE_LOG(LogTemp, Display, TEXT("Raw Lobby Response\n%s"), *Message);
     FString ParsedJson = LobbyMessageToJson(Message);
     UE_LOG(LogTemp, Display, TEXT("JSON Version: %s"), *ParsedJson);  
     TSharedPtr<FJsonObject> JsonParsed;
     TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ParsedJson);
-    if (!FJsonSerializer::Deserialize(JsonReader, JsonParsed))
+    bool bIsDeserialized = false;
+    {
+        Trace::FScope ParseScope(TEXT("Json"), TEXT("Parse"));
+        bIsDeserialized = FJsonSerializer::Deserialize(JsonReader, JsonParsed);
+    }
+    if (!bIsDeserialized)
     {
         UE_LOG(LogTemp, Display, TEXT("Failed to Deserialize. Json: %s"), *ParsedJson);
         return;
     }
     FString lobbyResponseType = JsonParsed->GetStringField("type");
     UE_LOG(LogTemp, Display, TEXT("Type: %s"), *lobbyResponseType);
+    if (Trace::IsEnabled())
+    {
+        TraceScope.SetDetail(lobbyResponseType);
+        FString MessageID;
+        if (JsonParsed->TryGetStringField(TEXT("id"), MessageID))
+        {
+            Trace::End(TEXT("Lobby"), TEXT("Request"), Trace::GetId(MessageID), lobbyResponseType);
+        }
+    }
 
 #define HANDLE_LOBBY_MESSAGE(MessageType, Model, ResponseCallback) \
     if (lobbyResponseType.Equals(MessageType)) \
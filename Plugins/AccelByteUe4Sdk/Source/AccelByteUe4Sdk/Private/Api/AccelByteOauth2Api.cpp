@@ -4,8 +4,10 @@
 
 #include "AccelByteOauth2Api.h"
 #include "AccelByteRegistry.h"
+#include "AccelByteHttpRetryScheduler.h"
+#include "AccelByteHttpRequestFactory.h"
+#include "Core/AccelByteEndpoints.h"
 #include "JsonUtilities.h"
-#include "Base64.h"
 
 namespace AccelByte
 {
@@ -13,82 +15,46 @@ namespace Api
 {
 void Oauth2::GetAccessTokenWithAuthorizationCodeGrant(const FString& ClientId, const FString& ClientSecret, const FString& AuthorizationCode, const FString& RedirectUri, const THandler<FOauth2Token>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret));
-	FString Url = FString::Printf(TEXT("%s/oauth/token"), *FRegistry::Settings.IamServerUrl);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/x-www-form-urlencoded");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("grant_type=authorization_code&code=%s&redirect_uri=%s"), *AuthorizationCode, *RedirectUri);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::Oauth2::Token);
+	Request->SetHeader(TEXT("Authorization"), FRegistry::HttpRequestFactory.GetBasicAuthorization(ClientId, ClientSecret));
 	Request->SetContentAsString(Content);
-	Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-	Request->ProcessRequest();
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Auth);
 }
 
 void Oauth2::GetAccessTokenWithPasswordGrant(const FString& ClientId, const FString& ClientSecret, const FString& Username, const FString& Password, const THandler<FOauth2Token>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret));
-	FString Url = FString::Printf(TEXT("%s/oauth/token"), *FRegistry::Settings.IamServerUrl);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/x-www-form-urlencoded");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("grant_type=password&username=%s&password=%s"), *FGenericPlatformHttp::UrlEncode(Username), *FGenericPlatformHttp::UrlEncode(Password));
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::Oauth2::Token);
+	Request->SetHeader(TEXT("Authorization"), FRegistry::HttpRequestFactory.GetBasicAuthorization(ClientId, ClientSecret));
 	Request->SetContentAsString(Content);
-	Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-	Request->ProcessRequest();
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Auth);
 }
 
 void Oauth2::GetAccessTokenWithClientCredentialsGrant(const FString& ClientId, const FString& ClientSecret, const THandler<FOauth2Token>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret));
-	FString Url = FString::Printf(TEXT("%s/oauth/token"), *FRegistry::Settings.IamServerUrl);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/x-www-form-urlencoded");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("grant_type=client_credentials"));
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::Oauth2::Token);
+	Request->SetHeader(TEXT("Authorization"), FRegistry::HttpRequestFactory.GetBasicAuthorization(ClientId, ClientSecret));
 	Request->SetContentAsString(Content);
-	Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-	Request->ProcessRequest();
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Auth);
 }
 
 void Oauth2::GetAccessTokenWithRefreshTokenGrant(const FString& ClientId, const FString& ClientSecret, const FString& RefreshToken, const THandler<FOauth2Token>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret));
-	FString Url = FString::Printf(TEXT("%s/oauth/token"), *FRegistry::Settings.IamServerUrl);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/x-www-form-urlencoded");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("grant_type=refresh_token&refresh_token=%s"), *FGenericPlatformHttp::UrlEncode(RefreshToken));
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::Oauth2::Token);
+	Request->SetHeader(TEXT("Authorization"), FRegistry::HttpRequestFactory.GetBasicAuthorization(ClientId, ClientSecret));
 	Request->SetContentAsString(Content);
-	Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-	Request->ProcessRequest();
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Auth);
 }
 
 //
@@ -99,42 +65,24 @@ void Oauth2::GetAccessTokenWithDeviceGrant(const FString& ClientId, const FStrin
 {
 	FString DeviceId = FGenericPlatformMisc::GetDeviceId();
 
-	FString Authorization = TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret));
-	FString Url = FString::Printf(TEXT("%s/oauth/platforms/device/token"), *FRegistry::Settings.IamServerUrl);;
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/x-www-form-urlencoded");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("device_id=%s"), *DeviceId);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::Oauth2::PlatformToken, { TEXT("device") });
+	Request->SetHeader(TEXT("Authorization"), FRegistry::HttpRequestFactory.GetBasicAuthorization(ClientId, ClientSecret));
 	Request->SetContentAsString(Content);
-	Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-	Request->ProcessRequest();
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Auth);
 }
 
 void Oauth2::GetAccessTokenWithPlatformGrant(const FString& ClientId, const FString& ClientSecret, const FString& PlatformId, const FString& PlatformToken, const THandler<FOauth2Token>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = TEXT("Basic " + FBase64::Encode(ClientId + ":" + ClientSecret));
-    FString Url = FString::Printf(TEXT("%s/oauth/platforms/%s/token"), *FRegistry::Settings.IamServerUrl, *PlatformId);
-    FString Verb = TEXT("POST");
-    FString ContentType = TEXT("application/x-www-form-urlencoded");
-    FString Accept = TEXT("application/json");
-    FString Content = FString::Printf(TEXT("platform_token=%s"), *PlatformToken);
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
+	FString Content = FString::Printf(TEXT("platform_token=%s"), *PlatformToken);
+
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::Oauth2::PlatformToken, { *PlatformId });
+	Request->SetHeader(TEXT("Authorization"), FRegistry::HttpRequestFactory.GetBasicAuthorization(ClientId, ClientSecret));
 	Request->SetContentAsString(Content);
-	Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-	Request->ProcessRequest();
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Auth);
 }
 
 } // Namespace Api
@@ -6,8 +6,9 @@
 
 #include "AccelByteRegistry.h"
 #include "AccelByteHttpRetryScheduler.h"
+#include "AccelByteHttpRequestFactory.h"
+#include "Core/AccelByteEndpoints.h"
 #include "AccelByteOauth2Api.h"
-#include "Base64.h"
 
 using AccelByte::Api::Oauth2;
 
@@ -116,62 +117,29 @@ void User::Register(const FString& Username, const FString& Password, const FStr
 	NewUserRequest.LoginId = Username;
 	NewUserRequest.AuthType = TEXT("EMAILPASSWD");
 
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users"), *FRegistry::Settings.IamServerUrl, *FRegistry::Credentials.GetClientNamespace());
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(NewUserRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::Register);
+	FRegistry::HttpRequestFactory.SetContent(Request, Endpoints::User::Register, Content);
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EHttpRequestClass::Interactive, FRegistry::Settings.bRetryKeyedWrites ? FHttpRetryPolicy::Keyed() : FHttpRetryPolicy());
 }
 
 void User::GetData(const THandler<FUserData>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/%s"), *FRegistry::Settings.IamServerUrl, *FRegistry::Credentials.GetUserNamespace(), *FRegistry::Credentials.GetUserId());
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::GetData);
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::Update(const FUserUpdateRequest& UpdateRequest, const THandler<FUserData>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/%s"), *FRegistry::Settings.IamServerUrl, *FRegistry::Credentials.GetUserNamespace(), *FRegistry::Credentials.GetUserId());
-	FString Verb = TEXT("PUT");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(UpdateRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::Update);
+	FRegistry::HttpRequestFactory.SetContent(Request, Endpoints::User::Update, Content);
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(
 		Request,
@@ -212,20 +180,10 @@ void User::SendUpgradeVerificationCode(const FString& Username, const FVoidHandl
 
 void User::UpgradeAndVerify(const FString& Username, const FString& Password, const FString& VerificationCode, const THandler<FUserData>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/%s/upgradeHeadlessAccountWithVerificationCode"), *FRegistry::Settings.IamServerUrl, *FRegistry::Credentials.GetUserNamespace(), *FRegistry::Credentials.GetUserId());
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("{ \"Code\": \"%s\", \"LoginId\": \"%s\", \"Password\": \"%s\"}"), *VerificationCode, *Username, *Password);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::UpgradeAndVerify);
+	FRegistry::HttpRequestFactory.SetContent(Request, Endpoints::User::UpgradeAndVerify, Content);
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(
 		Request,
@@ -242,20 +200,10 @@ void User::UpgradeAndVerify(const FString& Username, const FString& Password, co
 
 void User::Upgrade(const FString& Username, const FString& Password, const THandler<FUserData>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/%s/upgradeHeadlessAccount"), *FRegistry::Settings.IamServerUrl, *FRegistry::Credentials.GetUserNamespace(), *FRegistry::Credentials.GetUserId());
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("{ \"LoginId\": \"%s\", \"Password\": \"%s\"}"), *Username, *Password);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::Upgrade);
+	FRegistry::HttpRequestFactory.SetContent(Request, Endpoints::User::Upgrade, Content);
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(
 		Request,
@@ -273,40 +221,20 @@ void User::Upgrade(const FString& Username, const FString& Password, const THand
 void User::Verify(const FString& VerificationCode, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
 	FString ContactType = TEXT("email");
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/%s/verification"), *FRegistry::Settings.IamServerUrl, *FRegistry::Credentials.GetClientNamespace(), *FRegistry::Credentials.GetUserId());
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("{ \"Code\": \"%s\",\"ContactType\":\"%s\"}"), *VerificationCode, *ContactType);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::Verify);
+	FRegistry::HttpRequestFactory.SetContent(Request, Endpoints::User::Verify, Content);
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::SendResetPasswordCode(const FString& Username, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = TEXT("Basic " + FBase64::Encode(FRegistry::Settings.ClientId + ":" + FRegistry::Settings.ClientSecret));
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/forgotPassword"), *FRegistry::Settings.IamServerUrl, *FRegistry::Settings.Namespace);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("{\"LoginId\": \"%s\"}"), *Username);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::SendResetPasswordCode);
+	FRegistry::HttpRequestFactory.SetContent(Request, Endpoints::User::SendResetPasswordCode, Content);
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
@@ -317,147 +245,63 @@ void User::ResetPassword(const FString& VerificationCode, const FString& Usernam
 	ResetPasswordRequest.Code = VerificationCode;
 	ResetPasswordRequest.LoginId = Username;
 	ResetPasswordRequest.NewPassword = NewPassword;
-	FString Authorization = TEXT("Basic " + FBase64::Encode(FRegistry::Settings.ClientId + ":" + FRegistry::Settings.ClientSecret));
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/resetPassword"), *FRegistry::Settings.IamServerUrl, *FRegistry::Settings.Namespace);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
+
 	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(ResetPasswordRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::ResetPassword);
+	FRegistry::HttpRequestFactory.SetContent(Request, Endpoints::User::ResetPassword, Content);
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::GetPlatformLinks(const THandler<TArray<FPlatformLink>>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/%s/platforms"), *FRegistry::Settings.IamServerUrl, *FRegistry::Credentials.GetClientNamespace(), *FRegistry::Credentials.GetUserId());
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::GetPlatformLinks);
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::LinkOtherPlatform(const FString& PlatformId, const FString& Ticket, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/%s/platforms/%s/link"), *FRegistry::Settings.IamServerUrl, *FRegistry::Credentials.GetClientNamespace(), *FRegistry::Credentials.GetUserId(), *PlatformId);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/x-www-form-urlencoded");
-	FString Accept = TEXT("application/json");
 	FString Content = FString::Printf(TEXT("ticket=%s"), *Ticket);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::LinkOtherPlatform, { *PlatformId });
+	FRegistry::HttpRequestFactory.SetContent(Request, Endpoints::User::LinkOtherPlatform, Content);
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::UnlinkOtherPlatform(const FString& PlatformId, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetClientAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/%s/platforms/%s/unlink"), *FRegistry::Settings.IamServerUrl, *FRegistry::Credentials.GetClientNamespace(), *FRegistry::Credentials.GetUserId(), *PlatformId);
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::UnlinkOtherPlatform, { *PlatformId });
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::SendVerificationCode(const FVerificationCodeRequest& VerificationCodeRequest, const FVoidHandler& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = TEXT("");
-	FString Namespace = TEXT("");
-	
-	Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-	Namespace = FRegistry::Credentials.GetUserNamespace();
-	
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/%s/verificationcode"), *FRegistry::Settings.IamServerUrl, *Namespace, *FRegistry::Credentials.GetUserId());
-	FString Verb = TEXT("POST");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content = TEXT("");
+	FString Content;
 	FJsonObjectConverter::UStructToJsonObjectString(VerificationCodeRequest, Content);
 
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::SendVerificationCode);
+	FRegistry::HttpRequestFactory.SetContent(Request, Endpoints::User::SendVerificationCode, Content);
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::GetUserByLoginId(const FString& LoginId, const THandler<FUserData>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/byLoginId?loginId=%s"), *FRegistry::Settings.IamServerUrl, *FRegistry::Credentials.GetUserNamespace(), *FGenericPlatformHttp::UrlEncode(LoginId));
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-	FString Content;
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->SetContentAsString(Content);
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::GetUserByLoginId, {}, FHttpQuery().Add(TEXT("loginId"), FGenericPlatformHttp::UrlEncode(LoginId)));
 
 	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 void User::GetPublicUserInfo(const FString& UserID, const THandler<FPublicUserInfo>& OnSuccess, const FErrorHandler& OnError)
 {
-	FString Authorization = FString::Printf(TEXT("Bearer %s"), *FRegistry::Credentials.GetUserAccessToken());
-	FString Url = FString::Printf(TEXT("%s/namespaces/%s/users/%s"), *FRegistry::Settings.IamServerUrl, *FRegistry::Credentials.GetUserNamespace(), *UserID);
-	FString Verb = TEXT("GET");
-	FString ContentType = TEXT("application/json");
-	FString Accept = TEXT("application/json");
-
-	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(Url);
-	Request->SetHeader(TEXT("Authorization"), Authorization);
-	Request->SetVerb(Verb);
-	Request->SetHeader(TEXT("Content-Type"), ContentType);
-	Request->SetHeader(TEXT("Accept"), Accept);
-	Request->OnProcessRequestComplete() = CreateHttpResultHandler(OnSuccess, OnError);
-	Request->ProcessRequest();
+	FHttpRequestPtr Request = FRegistry::HttpRequestFactory.Create(Endpoints::User::GetPublicUserInfo, { *UserID });
+
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
 }
 
 } // Namespace Api
@@ -0,0 +1,60 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteHttpMetricsBlueprints.h"
+#include "AccelByteRegistry.h"
+#include "AccelByteHttpRetryScheduler.h"
+
+using AccelByte::FRegistry;
+using AccelByte::FHttpMetrics;
+using AccelByte::FHttpEndpointMetrics;
+using AccelByte::EHttpFailureReason;
+
+FAccelByteModelsHttpMetrics UAccelByteBlueprintsHttpMetrics::GetHttpMetrics()
+{
+	FHttpMetrics& Metrics = FRegistry::HttpRetryScheduler.GetMetrics();
+	FAccelByteModelsHttpMetrics Result;
+	Result.QueuedRequests = Metrics.QueuedRequests.GetValue();
+	Result.InFlightRequests = Metrics.InFlightRequests.GetValue();
+
+	for (const FString& Endpoint : Metrics.GetEndpoints())
+	{
+		TSharedPtr<FHttpEndpointMetrics, ESPMode::ThreadSafe> Recorded = Metrics.Find(Endpoint);
+
+		if (!Recorded.IsValid())
+		{
+			continue;
+		}
+
+		FAccelByteModelsHttpEndpointMetrics EndpointMetrics;
+		EndpointMetrics.Endpoint = Endpoint;
+		EndpointMetrics.Requests = Recorded->Latency.GetCount();
+		EndpointMetrics.LatencyP50Ms = Recorded->Latency.GetPercentile(0.5f) / 1000.0f;
+		EndpointMetrics.LatencyP95Ms = Recorded->Latency.GetPercentile(0.95f) / 1000.0f;
+		EndpointMetrics.LatencyP99Ms = Recorded->Latency.GetPercentile(0.99f) / 1000.0f;
+		EndpointMetrics.LatencyMaxMs = Recorded->Latency.GetMax() / 1000.0f;
+		EndpointMetrics.QueueWaitP95Ms = Recorded->QueueWait.GetPercentile(0.95f) / 1000.0f;
+		EndpointMetrics.TimeToFirstByteP95Ms = Recorded->TimeToFirstByte.GetPercentile(0.95f) / 1000.0f;
+		EndpointMetrics.AverageAttempts = Recorded->Attempts.GetMean();
+		EndpointMetrics.RequestBytesP95 = Recorded->RequestBytes.GetPercentile(0.95f);
+		EndpointMetrics.ResponseBytesP95 = Recorded->ResponseBytes.GetPercentile(0.95f);
+
+		for (int32 i = 0; i < static_cast<int32>(EHttpFailureReason::Count); i++)
+		{
+			if (Recorded->Failures[i].GetValue() > 0)
+			{
+				EndpointMetrics.Failures.Add(FHttpMetrics::GetFailureReasonName(static_cast<EHttpFailureReason>(i)), Recorded->Failures[i].GetValue());
+			}
+		}
+
+		Result.Endpoints.Add(MoveTemp(EndpointMetrics));
+	}
+
+	return Result;
+}
+
+void UAccelByteBlueprintsHttpMetrics::ResetHttpMetrics()
+{
+	FRegistry::HttpRetryScheduler.GetMetrics().Reset();
+}
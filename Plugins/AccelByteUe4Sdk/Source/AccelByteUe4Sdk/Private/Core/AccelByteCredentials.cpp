@@ -5,6 +5,7 @@
 #include "AccelByteCredentials.h"
 #include "AccelByteOauth2Api.h"
 #include "AccelByteOauth2Models.h"
+#include "AccelByteTrace.h"
 
 using namespace AccelByte::Api;
 
@@ -96,15 +97,29 @@ void Credentials::PollRefreshToken(double CurrentTime)
 	case ETokenState::Valid:
 		if (UserRefreshTime <= CurrentTime)
 		{
+			uint64 TraceId = Trace::NewId();
+			Trace::Begin(TEXT("Credentials"), TEXT("RefreshToken"), TraceId);
+
 			Oauth2::GetAccessTokenWithRefreshTokenGrant(
 				ClientId, ClientSecret, 
 				UserRefreshToken, 
-				THandler<FOauth2Token>::CreateLambda([this, CurrentTime](const FOauth2Token& Result)
+				THandler<FOauth2Token>::CreateLambda([this, CurrentTime, TraceId](const FOauth2Token& Result)
 				{
+					// Same guard as the error handler, whose detail is only formatted for a traced refresh
+					if (TraceId != 0 && Trace::IsEnabled())
+					{
+						Trace::End(TEXT("Credentials"), TEXT("RefreshToken"), TraceId);
+					}
+
 					SetUserToken(Result.Access_token, Result.Refresh_token, CurrentTime + (Result.Expires_in * FMath::FRandRange(0.7, 0.9)), Result.User_id, Result.Display_name, Result.Namespace);
 				}), 
-				FErrorHandler::CreateLambda([this, CurrentTime](int32 ErrorCode, const FString& ErrorMessage)
+				FErrorHandler::CreateLambda([this, CurrentTime, TraceId](int32 ErrorCode, const FString& ErrorMessage)
 				{
+					if (TraceId != 0 && Trace::IsEnabled())
+					{
+						Trace::End(TEXT("Credentials"), TEXT("RefreshToken"), TraceId, FString::Printf(TEXT("error %d"), ErrorCode));
+					}
+
 					if (UserRefreshBackoff <= 0.0)
 					{
 						UserRefreshBackoff = 10.0;
@@ -0,0 +1,106 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "AccelByteHttpRequestFactory.h"
+
+namespace AccelByte
+{
+namespace Endpoints
+{
+
+static const TCHAR* const Json = TEXT("application/json");
+static const TCHAR* const Form = TEXT("application/x-www-form-urlencoded");
+static const TCHAR* const AnyType = TEXT("*/*");
+
+namespace Oauth2
+{
+	const FHttpEndpoint Token{ TEXT("POST"), EHttpService::Iam, TEXT("/oauth/token"), EHttpAuthorization::None, Form };
+	const FHttpEndpoint PlatformToken{ TEXT("POST"), EHttpService::Iam, TEXT("/oauth/platforms/{}/token"), EHttpAuthorization::None, Form };
+}
+
+namespace User
+{
+	const FHttpEndpoint Register{ TEXT("POST"), EHttpService::Iam, TEXT("/namespaces/{clientNamespace}/users"), EHttpAuthorization::Client, Json };
+	const FHttpEndpoint GetData{ TEXT("GET"), EHttpService::Iam, TEXT("/namespaces/{namespace}/users/{userId}"), EHttpAuthorization::User };
+	const FHttpEndpoint Update{ TEXT("PUT"), EHttpService::Iam, TEXT("/namespaces/{namespace}/users/{userId}"), EHttpAuthorization::User, Json };
+	const FHttpEndpoint UpgradeAndVerify{ TEXT("POST"), EHttpService::Iam, TEXT("/namespaces/{namespace}/users/{userId}/upgradeHeadlessAccountWithVerificationCode"), EHttpAuthorization::User, Json };
+	const FHttpEndpoint Upgrade{ TEXT("POST"), EHttpService::Iam, TEXT("/namespaces/{namespace}/users/{userId}/upgradeHeadlessAccount"), EHttpAuthorization::Client, Json };
+	const FHttpEndpoint Verify{ TEXT("POST"), EHttpService::Iam, TEXT("/namespaces/{clientNamespace}/users/{userId}/verification"), EHttpAuthorization::Client, Json };
+	const FHttpEndpoint SendResetPasswordCode{ TEXT("POST"), EHttpService::Iam, TEXT("/namespaces/{gameNamespace}/users/forgotPassword"), EHttpAuthorization::Basic, Json };
+	const FHttpEndpoint ResetPassword{ TEXT("POST"), EHttpService::Iam, TEXT("/namespaces/{gameNamespace}/users/resetPassword"), EHttpAuthorization::Basic, Json };
+	const FHttpEndpoint GetPlatformLinks{ TEXT("GET"), EHttpService::Iam, TEXT("/namespaces/{clientNamespace}/users/{userId}/platforms"), EHttpAuthorization::Client };
+	const FHttpEndpoint LinkOtherPlatform{ TEXT("POST"), EHttpService::Iam, TEXT("/namespaces/{clientNamespace}/users/{userId}/platforms/{}/link"), EHttpAuthorization::Client, Form };
+	const FHttpEndpoint UnlinkOtherPlatform{ TEXT("POST"), EHttpService::Iam, TEXT("/namespaces/{clientNamespace}/users/{userId}/platforms/{}/unlink"), EHttpAuthorization::Client, Json };
+	const FHttpEndpoint SendVerificationCode{ TEXT("POST"), EHttpService::Iam, TEXT("/namespaces/{namespace}/users/{userId}/verificationcode"), EHttpAuthorization::User, Json };
+	const FHttpEndpoint GetUserByLoginId{ TEXT("GET"), EHttpService::Iam, TEXT("/namespaces/{namespace}/users/byLoginId"), EHttpAuthorization::User };
+	const FHttpEndpoint GetPublicUserInfo{ TEXT("GET"), EHttpService::Iam, TEXT("/namespaces/{namespace}/users/{}"), EHttpAuthorization::User };
+}
+
+namespace UserProfile
+{
+	const FHttpEndpoint GetUserProfile{ TEXT("GET"), EHttpService::Basic, TEXT("/public/namespaces/{namespace}/users/me/profiles"), EHttpAuthorization::User };
+	const FHttpEndpoint GetPublicUserProfileInfo{ TEXT("GET"), EHttpService::Basic, TEXT("/public/namespaces/{namespace}/users/{}/profiles/public"), EHttpAuthorization::User };
+	const FHttpEndpoint UpdateUserProfile{ TEXT("PUT"), EHttpService::Basic, TEXT("/public/namespaces/{namespace}/users/me/profiles"), EHttpAuthorization::User, Json };
+	const FHttpEndpoint CreateUserProfile{ TEXT("POST"), EHttpService::Basic, TEXT("/public/namespaces/{namespace}/users/me/profiles"), EHttpAuthorization::User, Json };
+}
+
+namespace Category
+{
+	const FHttpEndpoint GetRootCategories{ TEXT("GET"), EHttpService::Platform, TEXT("/public/namespaces/{namespace}/categories"), EHttpAuthorization::User };
+	const FHttpEndpoint GetCategory{ TEXT("GET"), EHttpService::Platform, TEXT("/public/namespaces/{namespace}/categories/{}"), EHttpAuthorization::User };
+	const FHttpEndpoint GetChildCategories{ TEXT("GET"), EHttpService::Platform, TEXT("/public/namespaces/{namespace}/categories/{}/children"), EHttpAuthorization::User };
+	const FHttpEndpoint GetDescendantCategories{ TEXT("GET"), EHttpService::Platform, TEXT("/public/namespaces/{namespace}/categories/{}/descendants"), EHttpAuthorization::User };
+}
+
+namespace Item
+{
+	const FHttpEndpoint GetItemById{ TEXT("GET"), EHttpService::Platform, TEXT("/public/namespaces/{namespace}/items/{}/locale"), EHttpAuthorization::User };
+	const FHttpEndpoint GetItemsByCriteria{ TEXT("GET"), EHttpService::Platform, TEXT("/public/namespaces/{gameNamespace}/items/byCriteria"), EHttpAuthorization::User };
+}
+
+namespace Order
+{
+	const FHttpEndpoint CreateNewOrder{ TEXT("POST"), EHttpService::Platform, TEXT("/public/namespaces/{namespace}/users/{userId}/orders"), EHttpAuthorization::User, Json };
+	const FHttpEndpoint GetUserOrder{ TEXT("GET"), EHttpService::Platform, TEXT("/public/namespaces/{namespace}/users/{userId}/orders/{}"), EHttpAuthorization::User };
+	const FHttpEndpoint GetUserOrders{ TEXT("GET"), EHttpService::Platform, TEXT("/public/namespaces/{namespace}/users/{userId}/orders"), EHttpAuthorization::User };
+	const FHttpEndpoint FulfillOrder{ TEXT("PUT"), EHttpService::Platform, TEXT("/public/namespaces/{namespace}/users/{userId}/orders/{}/fulfill"), EHttpAuthorization::User, Json };
+	const FHttpEndpoint GetUserOrderHistory{ TEXT("GET"), EHttpService::Platform, TEXT("/public/namespaces/{namespace}/users/{userId}/orders/{}/history"), EHttpAuthorization::User };
+}
+
+namespace Entitlement
+{
+	const FHttpEndpoint QueryUserEntitlement{ TEXT("GET"), EHttpService::Platform, TEXT("/public/namespaces/{namespace}/users/{userId}/entitlements"), EHttpAuthorization::User };
+}
+
+namespace Wallet
+{
+	const FHttpEndpoint GetWalletInfoByCurrencyCode{ TEXT("GET"), EHttpService::Platform, TEXT("/public/namespaces/{namespace}/users/{userId}/wallets/{}"), EHttpAuthorization::User };
+}
+
+namespace CloudStorage
+{
+	const FHttpEndpoint GetAllSlots{ TEXT("GET"), EHttpService::CloudStorage, TEXT("/public/namespaces/{namespace}/users/{userId}/slots"), EHttpAuthorization::User };
+	const FHttpEndpoint CreateSlot{ TEXT("POST"), EHttpService::CloudStorage, TEXT("/public/namespaces/{namespace}/users/{userId}/slots"), EHttpAuthorization::User, nullptr, AnyType };
+	const FHttpEndpoint GetSlot{ TEXT("GET"), EHttpService::CloudStorage, TEXT("/public/namespaces/{namespace}/users/{userId}/slots/{}"), EHttpAuthorization::User, nullptr, AnyType };
+	const FHttpEndpoint UpdateSlot{ TEXT("PUT"), EHttpService::CloudStorage, TEXT("/public/namespaces/{namespace}/users/{userId}/slots/{}"), EHttpAuthorization::User, nullptr, AnyType };
+	const FHttpEndpoint UpdateSlotMetadata{ TEXT("PUT"), EHttpService::CloudStorage, TEXT("/public/namespaces/{namespace}/users/{userId}/slots/{}/metadata"), EHttpAuthorization::User, nullptr, AnyType };
+	const FHttpEndpoint DeleteSlot{ TEXT("DELETE"), EHttpService::CloudStorage, TEXT("/public/namespaces/{namespace}/users/{userId}/slots/{}"), EHttpAuthorization::User, nullptr, AnyType };
+}
+
+namespace GameProfile
+{
+	const FHttpEndpoint BatchGetPublicGameProfiles{ TEXT("GET"), EHttpService::GameProfile, TEXT("/public/namespaces/{namespace}/profiles"), EHttpAuthorization::User };
+	const FHttpEndpoint GetAllGameProfiles{ TEXT("GET"), EHttpService::GameProfile, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles"), EHttpAuthorization::User };
+	const FHttpEndpoint CreateGameProfile{ TEXT("POST"), EHttpService::GameProfile, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles"), EHttpAuthorization::User, Json };
+	const FHttpEndpoint GetGameProfile{ TEXT("GET"), EHttpService::GameProfile, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles/{}"), EHttpAuthorization::User };
+	const FHttpEndpoint UpdateGameProfile{ TEXT("PUT"), EHttpService::GameProfile, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles/{}"), EHttpAuthorization::User, Json };
+	const FHttpEndpoint DeleteGameProfile{ TEXT("DELETE"), EHttpService::GameProfile, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles/{}"), EHttpAuthorization::User };
+	const FHttpEndpoint GetGameProfileAttribute{ TEXT("GET"), EHttpService::GameProfile, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles/{}/attributes/{}"), EHttpAuthorization::User };
+	const FHttpEndpoint UpdateGameProfileAttribute{ TEXT("PUT"), EHttpService::GameProfile, TEXT("/public/namespaces/{namespace}/users/{userId}/profiles/{}/attributes/{}"), EHttpAuthorization::User, Json };
+}
+
+}
+}
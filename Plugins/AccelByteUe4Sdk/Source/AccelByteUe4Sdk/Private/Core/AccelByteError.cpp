@@ -243,6 +243,8 @@ const std::unordered_map<std::underlying_type<ErrorCodes>::type, FString> ErrorM
 	{ static_cast<int32>(ErrorCodes::UnknownError), TEXT("Unknown error.") },
 	{ static_cast<int32>(ErrorCodes::JsonDeserializationFailed), TEXT("JSON deserialization failed.") },
 	{ static_cast<int32>(ErrorCodes::NetworkError), TEXT("There is no response.") },
+	{ static_cast<int32>(ErrorCodes::ServiceCircuitOpen), TEXT("Service is unavailable, the request was not sent.") },
+	{ static_cast<int32>(ErrorCodes::ResponseTooLarge), TEXT("Response is too large to decompress.") },
 	{ static_cast<int32>(ErrorCodes::WebSocketConnectFailed), TEXT("WebSocket connect failed.") },
 
 
@@ -255,7 +257,7 @@ void HandleHttpError(FHttpRequestPtr Request, FHttpResponsePtr Response, int& Ou
 	OutMessage = "";
 	if (Response.IsValid())
 	{
-		if (FJsonObjectConverter::JsonObjectStringToUStruct(Response->GetContentAsString(), &Error, 0, 0))
+		if (JsonDecoder::Decode(Response, Error))
 		{
 			Code = Error.NumericErrorCode;
 		}
@@ -305,5 +307,33 @@ void HandleHttpError(FHttpRequestPtr Request, FHttpResponsePtr Response, int& Ou
 	OutCode = Code;
 }
 
-} // Namespace AccelByte
+/** Kept out of the class, thread_local data cannot be part of an exported interface. */
+static thread_local FHttpResultFanOut* CurrentFanOut = nullptr;
+
+FHttpResultFanOut* FHttpResultFanOut::GetCurrent()
+{
+	return CurrentFanOut;
+}
+
+FHttpResultFanOut::FHttpResultFanOut(const FHttpResponsePtr& Response)
+	: Response(Response)
+	, Results(MakeShared<FHttpDecodedResults, ESPMode::ThreadSafe>())
+	, Previous(CurrentFanOut)
+{
+	CurrentFanOut = this;
+}
 
+FHttpResultFanOut::FHttpResultFanOut(const FHttpResponsePtr& Response, const TSharedRef<FHttpDecodedResults, ESPMode::ThreadSafe>& Results)
+	: Response(Response)
+	, Results(Results)
+	, Previous(CurrentFanOut)
+{
+	CurrentFanOut = this;
+}
+
+FHttpResultFanOut::~FHttpResultFanOut()
+{
+	CurrentFanOut = Previous;
+}
+
+} // Namespace AccelByte
@@ -0,0 +1,254 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteHttpCompression.h"
+#include "AccelByteError.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace AccelByte
+{
+namespace HttpCompression
+{
+	const TCHAR* const AcceptEncoding = TEXT("gzip, deflate");
+
+	/** Decoded bodies larger than this are refused rather than allocated. */
+	static const int32 MaxDecompressedSize = 64 * 1024 * 1024;
+	/** Largest inflate buffer a thread keeps between responses; one large body does not pin its size for good. */
+	static const int32 MaxKeptBufferSize = 256 * 1024;
+
+	enum class EInflateResult
+	{
+		Inflated,
+		Damaged,
+		TooLarge
+	};
+
+	static FThreadSafeCounter CompressedRequests;
+	static FThreadSafeCounter64 RequestBytesSaved;
+	static FThreadSafeCounter DecompressedResponses;
+	static FThreadSafeCounter64 ResponseBytesSaved;
+
+	/**
+	 * @brief Response whose body was decoded by the SDK, everything else is read from the platform's response.
+	 */
+	class FDecompressedHttpResponse : public IHttpResponse
+	{
+	public:
+		FDecompressedHttpResponse(const FHttpResponsePtr& Response, TArray<uint8>&& Content, int32 ResponseCode = 0)
+			: Response(Response)
+			, Content(MoveTemp(Content))
+			, ResponseCode(ResponseCode)
+		{
+		}
+
+		FString GetURL() override { return Response->GetURL(); }
+		FString GetURLParameter(const FString& ParameterName) override { return Response->GetURLParameter(ParameterName); }
+
+		FString GetHeader(const FString& HeaderName) override
+		{
+			return HeaderName == TEXT("Content-Encoding") ? FString() : Response->GetHeader(HeaderName);
+		}
+
+		TArray<FString> GetAllHeaders() override
+		{
+			TArray<FString> Headers = Response->GetAllHeaders();
+			Headers.RemoveAll([](const FString& Header)
+			{
+				return Header.StartsWith(TEXT("Content-Encoding:"));
+			});
+
+			return Headers;
+		}
+
+		FString GetContentType() override { return Response->GetContentType(); }
+		int32 GetContentLength() override { return Content.Num(); }
+		const TArray<uint8>& GetContent() override { return Content; }
+		int32 GetResponseCode() override { return (ResponseCode != 0) ? ResponseCode : Response->GetResponseCode(); }
+
+		FString GetContentAsString() override
+		{
+			FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+
+			return FString(Converted.Length(), Converted.Get());
+		}
+
+	private:
+		const FHttpResponsePtr Response;
+		const TArray<uint8> Content;
+		/** Replaces the platform's when the body could not be decoded, 0 otherwise. */
+		const int32 ResponseCode;
+	};
+
+	static EInflateResult Inflate(const TArray<uint8>& Content, int32 WindowBits, TArray<uint8>& OutContent)
+	{
+		// Inflated into a buffer kept by the thread, each response only allocates its final size
+		static thread_local TArray<uint8> Buffer;
+
+		if (Buffer.Num() < 16 * 1024)
+		{
+			Buffer.SetNumUninitialized(16 * 1024);
+		}
+
+		z_stream Stream;
+		FMemory::Memzero(Stream);
+
+		if (inflateInit2(&Stream, WindowBits) != Z_OK)
+		{
+			return EInflateResult::Damaged;
+		}
+
+		Stream.next_in = const_cast<Bytef*>(Content.GetData());
+		Stream.avail_in = Content.Num();
+		int Result = Z_OK;
+		bool bIsTooLarge = false;
+
+		while (Result == Z_OK)
+		{
+			if (Stream.total_out == static_cast<uLong>(Buffer.Num()))
+			{
+				if (Buffer.Num() >= MaxDecompressedSize)
+				{
+					bIsTooLarge = true;
+					break;
+				}
+
+				Buffer.SetNumUninitialized(Buffer.Num() * 2);
+			}
+
+			Stream.next_out = Buffer.GetData() + Stream.total_out;
+			Stream.avail_out = Buffer.Num() - Stream.total_out;
+			Result = inflate(&Stream, Z_NO_FLUSH);
+		}
+
+		int32 Size = Stream.total_out;
+		inflateEnd(&Stream);
+
+		if (Result == Z_STREAM_END)
+		{
+			OutContent.SetNumUninitialized(Size);
+			FMemory::Memcpy(OutContent.GetData(), Buffer.GetData(), Size);
+		}
+
+		if (Buffer.Num() > MaxKeptBufferSize)
+		{
+			Buffer.Empty();
+		}
+
+		if (bIsTooLarge)
+		{
+			return EInflateResult::TooLarge;
+		}
+
+		return (Result == Z_STREAM_END) ? EInflateResult::Inflated : EInflateResult::Damaged;
+	}
+
+	static EInflateResult Decode(const FString& Encoding, const TArray<uint8>& Content, TArray<uint8>& OutContent)
+	{
+		if (Content.Num() < 2)
+		{
+			return EInflateResult::Damaged;
+		}
+		else if (Encoding == TEXT("gzip"))
+		{
+			// Some platforms decode gzip themselves and keep the header, their body has no gzip magic
+			if (Content[0] != 0x1f || Content[1] != 0x8b)
+			{
+				return EInflateResult::Damaged;
+			}
+
+			return Inflate(Content, 16 + MAX_WBITS, OutContent);
+		}
+		else if (Encoding == TEXT("deflate"))
+		{
+			// zlib wrapped as the RFC says, or raw deflate as some servers send it
+			bool bIsZlib = (Content[0] & 0x0f) == Z_DEFLATED && ((Content[0] << 8) | Content[1]) % 31 == 0;
+
+			return Inflate(Content, bIsZlib ? MAX_WBITS : -MAX_WBITS, OutContent);
+		}
+
+		return EInflateResult::Damaged;
+	}
+
+	bool Compress(const uint8* Content, int32 ContentSize, TArray<uint8>& OutCompressed)
+	{
+		z_stream Stream;
+		FMemory::Memzero(Stream);
+
+		// 16 more window bits write a gzip header instead of a zlib one
+		if (deflateInit2(&Stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		{
+			return false;
+		}
+
+		OutCompressed.SetNumUninitialized(deflateBound(&Stream, ContentSize));
+		Stream.next_in = const_cast<Bytef*>(Content);
+		Stream.avail_in = ContentSize;
+		Stream.next_out = OutCompressed.GetData();
+		Stream.avail_out = OutCompressed.Num();
+		int Result = deflate(&Stream, Z_FINISH);
+		int32 CompressedSize = Stream.total_out;
+		deflateEnd(&Stream);
+
+		if (Result != Z_STREAM_END || CompressedSize >= ContentSize)
+		{
+			OutCompressed.Reset();
+
+			return false;
+		}
+
+		OutCompressed.SetNum(CompressedSize, false);
+		CompressedRequests.Increment();
+		RequestBytesSaved.Add(ContentSize - CompressedSize);
+
+		return true;
+	}
+
+	bool Decompress(const FString& Encoding, const TArray<uint8>& Content, TArray<uint8>& OutContent)
+	{
+		return Decode(Encoding, Content, OutContent) == EInflateResult::Inflated;
+	}
+
+	FHttpResponsePtr Decompress(const FHttpResponsePtr& Response)
+	{
+		if (!Response.IsValid())
+		{
+			return Response;
+		}
+
+		FString Encoding = Response->GetHeader(TEXT("Content-Encoding")).TrimStartAndEnd();
+		const TArray<uint8>& Content = Response->GetContent();
+		TArray<uint8> Decompressed;
+		EInflateResult Result = Decode(Encoding, Content, Decompressed);
+
+		if (Result == EInflateResult::TooLarge)
+		{
+			// Handed on still encoded it would only fail later as a malformed body
+			FString Error = FString::Printf(TEXT("{\"numericErrorCode\":%d,\"errorCode\":\"response_too_large\",\"errorMessage\":\"Decoded body is over %d bytes\"}"), static_cast<int32>(ErrorCodes::ResponseTooLarge), MaxDecompressedSize);
+			FTCHARToUTF8 Converted(*Error);
+			Decompressed.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+
+			return MakeShared<FDecompressedHttpResponse, ESPMode::ThreadSafe>(Response, MoveTemp(Decompressed), EHttpResponseCodes::BadGateway);
+		}
+		else if (Result != EInflateResult::Inflated)
+		{
+			return Response;
+		}
+
+		DecompressedResponses.Increment();
+		ResponseBytesSaved.Add(Decompressed.Num() - Content.Num());
+
+		return MakeShared<FDecompressedHttpResponse, ESPMode::ThreadSafe>(Response, MoveTemp(Decompressed));
+	}
+
+	FCompressionStats GetStats()
+	{
+		return FCompressionStats{ CompressedRequests.GetValue(), RequestBytesSaved.GetValue(), DecompressedResponses.GetValue(), ResponseBytesSaved.GetValue() };
+	}
+}
+}
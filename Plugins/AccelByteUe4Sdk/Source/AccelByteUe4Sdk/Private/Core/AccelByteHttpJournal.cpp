@@ -0,0 +1,315 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteHttpJournal.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteHttpJournal, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteHttpJournal);
+
+namespace AccelByte
+{
+
+static const uint32 JournalMagic = 0x4e4a4241;
+static const int32 JournalVersion = 1;
+static const int32 JournalHeaderSize = sizeof(uint32) + sizeof(int32);
+/** Size and CRC in front of each record's payload. */
+static const int32 RecordHeaderSize = 2 * sizeof(uint32);
+
+enum class EJournalRecord : uint8
+{
+	Write = 1,
+	Done = 2
+};
+
+/**
+ * @brief Size, CRC and payload of one record; Entry is only written for a Write record.
+ */
+static void AppendRecord(TArray<uint8>& OutData, uint8 Type, int64 Sequence, FHttpJournal::FEntry* Entry)
+{
+	TArray<uint8> Payload;
+	FMemoryWriter PayloadWriter(Payload);
+	PayloadWriter << Type;
+	PayloadWriter << Sequence;
+
+	if (Entry != nullptr)
+	{
+		PayloadWriter << Entry->Verb;
+		PayloadWriter << Entry->Url;
+		PayloadWriter << Entry->Headers;
+		PayloadWriter << Entry->Content;
+	}
+
+	FMemoryWriter Writer(OutData);
+	Writer.Seek(OutData.Num());
+	uint32 PayloadSize = Payload.Num();
+	uint32 Crc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+	Writer << PayloadSize;
+	Writer << Crc;
+	Writer.Serialize(Payload.GetData(), Payload.Num());
+}
+
+FHttpJournal::FHttpJournal()
+	: NextSequence(1)
+	, DeadRecords(0)
+{
+}
+
+void FHttpJournal::Open(const FString& JournalPath)
+{
+	if (JournalPath == Path)
+	{
+		return;
+	}
+
+	Close();
+	Path = JournalPath;
+
+	if (Path.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<uint8> Data;
+	uint32 Magic = 0;
+	int32 Version = 0;
+
+	if (FFileHelper::LoadFileToArray(Data, *Path, FILEREAD_Silent) && Data.Num() >= JournalHeaderSize)
+	{
+		FMemoryReader Header(Data);
+		Header << Magic;
+		Header << Version;
+	}
+
+	if (Magic != JournalMagic || Version != JournalVersion)
+	{
+		// Missing or unreadable, started empty
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), true);
+		Compact();
+
+		return;
+	}
+
+	int32 Offset = JournalHeaderSize;
+
+	while (Offset + RecordHeaderSize <= Data.Num())
+	{
+		uint32 PayloadSize = 0;
+		uint32 Crc = 0;
+		FMemory::Memcpy(&PayloadSize, Data.GetData() + Offset, sizeof(uint32));
+		FMemory::Memcpy(&Crc, Data.GetData() + Offset + sizeof(uint32), sizeof(uint32));
+		int32 PayloadOffset = Offset + RecordHeaderSize;
+
+		if (PayloadSize > static_cast<uint32>(Data.Num() - PayloadOffset) || FCrc::MemCrc32(Data.GetData() + PayloadOffset, PayloadSize) != Crc)
+		{
+			break;
+		}
+
+		FMemoryReader Reader(Data);
+		Reader.Seek(PayloadOffset);
+		uint8 Type = 0;
+		int64 Sequence = 0;
+		Reader << Type;
+		Reader << Sequence;
+
+		if (Type == static_cast<uint8>(EJournalRecord::Write))
+		{
+			FEntry Entry;
+			Entry.Sequence = Sequence;
+			Entry.bIsInFlight = false;
+			Entry.UnsettledAnswers = 0;
+			Reader << Entry.Verb;
+			Reader << Entry.Url;
+			Reader << Entry.Headers;
+			Reader << Entry.Content;
+			Entries.Add(MoveTemp(Entry));
+		}
+		else
+		{
+			Entries.RemoveAll([Sequence](const FEntry& Entry)
+			{
+				return Entry.Sequence == Sequence;
+			});
+			DeadRecords += 2;
+		}
+
+		NextSequence = FMath::Max(NextSequence, Sequence + 1);
+		Offset = PayloadOffset + PayloadSize;
+	}
+
+	// A crash while appending leaves part of a record behind, the next append would follow the garbage
+	if (Offset != Data.Num() || DeadRecords > Entries.Num())
+	{
+		Compact();
+	}
+}
+
+void FHttpJournal::Close()
+{
+	Path.Empty();
+	Entries.Empty();
+	NextSequence = 1;
+	DeadRecords = 0;
+}
+
+bool FHttpJournal::IsOpen() const
+{
+	return !Path.IsEmpty();
+}
+
+const FString& FHttpJournal::GetPath() const
+{
+	return Path;
+}
+
+int64 FHttpJournal::Append(const FHttpRequestPtr& Request)
+{
+	if (!IsOpen())
+	{
+		return 0;
+	}
+
+	FEntry Entry;
+	Entry.Sequence = NextSequence++;
+	Entry.Verb = Request->GetVerb();
+	Entry.Url = Request->GetURL();
+	Entry.Content = Request->GetContent();
+	Entry.bIsInFlight = true;
+	Entry.UnsettledAnswers = 0;
+
+	for (const FString& Header : Request->GetAllHeaders())
+	{
+		if (!Header.StartsWith(TEXT("Authorization:")))
+		{
+			Entry.Headers.Add(Header);
+		}
+	}
+
+	if (Entry.Verb == TEXT("PUT") || Entry.Verb == TEXT("DELETE"))
+	{
+		// Only the last state of a resource matters, the writes before it would be overwritten by the replay anyway
+		for (int32 i = Entries.Num() - 1; i >= 0; i--)
+		{
+			if (!Entries[i].bIsInFlight && Entries[i].Url == Entry.Url && (Entries[i].Verb == TEXT("PUT") || Entries[i].Verb == TEXT("DELETE")))
+			{
+				Complete(Entries[i].Sequence);
+			}
+		}
+	}
+
+	if (!WriteRecord(static_cast<uint8>(EJournalRecord::Write), Entry.Sequence, &Entry))
+	{
+		return 0;
+	}
+
+	int64 Sequence = Entry.Sequence;
+	Entries.Add(MoveTemp(Entry));
+
+	return Sequence;
+}
+
+void FHttpJournal::Complete(int64 Sequence)
+{
+	int32 Index = Entries.IndexOfByPredicate([Sequence](const FEntry& Entry)
+	{
+		return Entry.Sequence == Sequence;
+	});
+
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	Entries.RemoveAt(Index);
+	WriteRecord(static_cast<uint8>(EJournalRecord::Done), Sequence, nullptr);
+	DeadRecords += 2;
+
+	if (DeadRecords >= 32 && DeadRecords > Entries.Num())
+	{
+		Compact();
+	}
+}
+
+void FHttpJournal::Release(int64 Sequence, bool bIsAnswered)
+{
+	FEntry* Entry = Entries.FindByPredicate([Sequence](const FEntry& Candidate)
+	{
+		return Candidate.Sequence == Sequence;
+	});
+
+	if (Entry == nullptr)
+	{
+		return;
+	}
+
+	Entry->bIsInFlight = false;
+
+	if (bIsAnswered && ++Entry->UnsettledAnswers >= MaxUnsettledAnswers)
+	{
+		UE_LOG(LogAccelByteHttpJournal, Warning, TEXT("Dropped %s %s from the write journal, the backend answered it %d times without accepting it"), *Entry->Verb, *Entry->Url, Entry->UnsettledAnswers);
+		Complete(Sequence);
+	}
+}
+
+FHttpJournal::FEntry* FHttpJournal::GetNextReplay()
+{
+	if (Entries.Num() == 0 || Entries[0].bIsInFlight)
+	{
+		return nullptr;
+	}
+
+	return &Entries[0];
+}
+
+int32 FHttpJournal::Num() const
+{
+	return Entries.Num();
+}
+
+void FHttpJournal::Compact()
+{
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	uint32 Magic = JournalMagic;
+	int32 Version = JournalVersion;
+	Writer << Magic;
+	Writer << Version;
+
+	for (FEntry& Entry : Entries)
+	{
+		AppendRecord(Data, static_cast<uint8>(EJournalRecord::Write), Entry.Sequence, &Entry);
+	}
+
+	// Replaced in one move, a crash while compacting leaves the previous journal intact
+	FString TempPath = Path + TEXT(".tmp");
+
+	if (FFileHelper::SaveArrayToFile(Data, *TempPath) && IFileManager::Get().Move(*Path, *TempPath, true, true))
+	{
+		DeadRecords = 0;
+	}
+}
+
+bool FHttpJournal::WriteRecord(uint8 Type, int64 Sequence, FEntry* Entry)
+{
+	TArray<uint8> Record;
+	AppendRecord(Record, Type, Sequence, Entry);
+
+	TUniquePtr<FArchive> File(IFileManager::Get().CreateFileWriter(*Path, FILEWRITE_Append));
+
+	if (!File.IsValid())
+	{
+		return false;
+	}
+
+	File->Serialize(Record.GetData(), Record.Num());
+	File->Flush();
+
+	return File->Close();
+}
+
+} // Namespace AccelByte
@@ -0,0 +1,207 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteHttpMetrics.h"
+#include "Misc/ScopeLock.h"
+
+namespace AccelByte
+{
+
+FHttpHistogram::FHttpHistogram()
+	: Max(0)
+{
+}
+
+void FHttpHistogram::Record(int64 Value)
+{
+	Value = FMath::Clamp<int64>(Value, 0, (1LL << MaxValueBits) - 1);
+	Counts[GetBucketIndex(Value)].Increment();
+	Count.Increment();
+	Sum.Add(Value);
+
+	int64 Current = Max;
+
+	while (Value > Current)
+	{
+		int64 Previous = FPlatformAtomics::InterlockedCompareExchange(&Max, Value, Current);
+
+		if (Previous == Current)
+		{
+			break;
+		}
+
+		Current = Previous;
+	}
+}
+
+int64 FHttpHistogram::GetCount() const
+{
+	return Count.GetValue();
+}
+
+int64 FHttpHistogram::GetSum() const
+{
+	return Sum.GetValue();
+}
+
+int64 FHttpHistogram::GetMax() const
+{
+	return Max;
+}
+
+double FHttpHistogram::GetMean() const
+{
+	int64 Recorded = Count.GetValue();
+
+	return Recorded > 0 ? static_cast<double>(Sum.GetValue()) / Recorded : 0.0;
+}
+
+int64 FHttpHistogram::GetPercentile(float Percentile) const
+{
+	int64 Recorded = 0;
+
+	for (int32 i = 0; i < BucketCount; i++)
+	{
+		Recorded += Counts[i].GetValue();
+	}
+
+	if (Recorded == 0)
+	{
+		return 0;
+	}
+
+	int64 Target = FMath::Max<int64>(1, FMath::CeilToInt(FMath::Clamp(Percentile, 0.0f, 1.0f) * Recorded));
+	int64 Cumulated = 0;
+
+	for (int32 i = 0; i < BucketCount; i++)
+	{
+		Cumulated += Counts[i].GetValue();
+
+		if (Cumulated >= Target)
+		{
+			// The top of a bucket may lie above anything recorded in it
+			return FMath::Min(GetBucketUpperBound(i), GetMax());
+		}
+	}
+
+	return GetMax();
+}
+
+void FHttpHistogram::Reset()
+{
+	for (int32 i = 0; i < BucketCount; i++)
+	{
+		Counts[i].Reset();
+	}
+
+	Count.Reset();
+	Sum.Reset();
+	FPlatformAtomics::InterlockedExchange(&Max, 0);
+}
+
+int32 FHttpHistogram::GetBucketIndex(int64 Value)
+{
+	if (Value < SubBucketCount)
+	{
+		return static_cast<int32>(Value);
+	}
+
+	// Values of [2^e, 2^(e+1)) share their top SubBucketBits + 1 bits with the bucket they land in
+	int32 Shift = static_cast<int32>(FPlatformMath::FloorLog2_64(static_cast<uint64>(Value))) - SubBucketBits;
+
+	return Shift * SubBucketCount + static_cast<int32>(Value >> Shift);
+}
+
+int64 FHttpHistogram::GetBucketUpperBound(int32 Index)
+{
+	if (Index < 2 * SubBucketCount)
+	{
+		return Index;
+	}
+
+	int32 Shift = Index / SubBucketCount - 1;
+	int64 Mantissa = Index % SubBucketCount + SubBucketCount;
+
+	return ((Mantissa + 1) << Shift) - 1;
+}
+
+void FHttpEndpointMetrics::Reset()
+{
+	QueueWait.Reset();
+	TimeToFirstByte.Reset();
+	Latency.Reset();
+	Attempts.Reset();
+	RequestBytes.Reset();
+	ResponseBytes.Reset();
+
+	for (FThreadSafeCounter& Failure : Failures)
+	{
+		Failure.Reset();
+	}
+}
+
+FHttpMetrics::FEndpointRef FHttpMetrics::FindOrAdd(const FString& EndpointTemplate)
+{
+	// Only this thread adds endpoints, it reads the map without the lock
+	if (const FEndpointRef* Found = Endpoints.Find(EndpointTemplate))
+	{
+		return *Found;
+	}
+
+	FScopeLock Lock(&Mutex);
+
+	return Endpoints.Add(EndpointTemplate, MakeShared<FHttpEndpointMetrics, ESPMode::ThreadSafe>());
+}
+
+TSharedPtr<FHttpEndpointMetrics, ESPMode::ThreadSafe> FHttpMetrics::Find(const FString& EndpointTemplate) const
+{
+	FScopeLock Lock(&Mutex);
+	const FEndpointRef* Found = Endpoints.Find(EndpointTemplate);
+
+	return Found != nullptr ? TSharedPtr<FHttpEndpointMetrics, ESPMode::ThreadSafe>(*Found) : nullptr;
+}
+
+TArray<FString> FHttpMetrics::GetEndpoints() const
+{
+	FScopeLock Lock(&Mutex);
+	TArray<FString> Result;
+	Endpoints.GetKeys(Result);
+
+	return Result;
+}
+
+void FHttpMetrics::Reset()
+{
+	FScopeLock Lock(&Mutex);
+
+	for (auto& Endpoint : Endpoints)
+	{
+		Endpoint.Value->Reset();
+	}
+}
+
+const TCHAR* FHttpMetrics::GetFailureReasonName(EHttpFailureReason Reason)
+{
+	switch (Reason)
+	{
+	case EHttpFailureReason::ConnectionError:
+		return TEXT("ConnectionError");
+	case EHttpFailureReason::Timeout:
+		return TEXT("Timeout");
+	case EHttpFailureReason::Expired:
+		return TEXT("Expired");
+	case EHttpFailureReason::CircuitOpen:
+		return TEXT("CircuitOpen");
+	case EHttpFailureReason::RateLimited:
+		return TEXT("RateLimited");
+	case EHttpFailureReason::ClientError:
+		return TEXT("ClientError");
+	case EHttpFailureReason::ServerError:
+		return TEXT("ServerError");
+	default:
+		return TEXT("None");
+	}
+}
+
+} // Namespace AccelByte
@@ -0,0 +1,254 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteHttpRequestFactory.h"
+#include "AccelByteHttpCompression.h"
+#include "AccelByteHttpTransport.h"
+#include "Base64.h"
+
+namespace AccelByte
+{
+
+FHttpQuery& FHttpQuery::Add(const TCHAR* Name, const FString& Value)
+{
+	if (!Value.IsEmpty())
+	{
+		Append(Name, *Value, Value.Len());
+	}
+
+	return *this;
+}
+
+FHttpQuery& FHttpQuery::AddRequired(const TCHAR* Name, const FString& Value)
+{
+	Append(Name, *Value, Value.Len());
+
+	return *this;
+}
+
+FHttpQuery& FHttpQuery::Add(const TCHAR* Name, int32 Value)
+{
+	TCHAR Buffer[16];
+	int32 Length = FCString::Sprintf(Buffer, TEXT("%d"), Value);
+	Append(Name, Buffer, Length);
+
+	return *this;
+}
+
+void FHttpQuery::Append(const TCHAR* Name, const TCHAR* Value, int32 ValueLength)
+{
+	int32 NameLength = FCString::Strlen(Name);
+	Query.Reserve(Query.Len() + NameLength + ValueLength + 2);
+	Query.AppendChar(Query.IsEmpty() ? TEXT('?') : TEXT('&'));
+	Query.AppendChars(Name, NameLength);
+	Query.AppendChar(TEXT('='));
+	Query.AppendChars(Value, ValueLength);
+}
+
+FHttpRequestFactory::FHttpRequestFactory(const Settings& Settings, const Credentials& Credentials)
+	: FactorySettings(Settings)
+	, FactoryCredentials(Credentials)
+	, CompressionThreshold(1024)
+{
+}
+
+FHttpRequestPtr FHttpRequestFactory::Create(const FHttpEndpoint& Endpoint, std::initializer_list<const TCHAR*> Arguments, const FHttpQuery& Query)
+{
+	FHttpRequestPtr Request = HttpTransport::CreateRequest();
+	Request->SetURL(CreateUrl(Endpoint, Arguments, Query));
+	Request->SetVerb(Endpoint.Verb);
+
+	if (Endpoint.Authorization != EHttpAuthorization::None)
+	{
+		Request->SetHeader(TEXT("Authorization"), GetAuthorization(Endpoint.Authorization));
+	}
+
+	// Requests without a body don't send a content type nor an empty content
+	if (Endpoint.ContentType != nullptr)
+	{
+		Request->SetHeader(TEXT("Content-Type"), Endpoint.ContentType);
+	}
+
+	Request->SetHeader(TEXT("Accept"), Endpoint.Accept);
+	Request->SetHeader(TEXT("Accept-Encoding"), HttpCompression::AcceptEncoding);
+
+	return Request;
+}
+
+void FHttpRequestFactory::SetContent(const FHttpRequestPtr& Request, const FHttpEndpoint& Endpoint, const FString& Content)
+{
+	FTCHARToUTF8 Converted(*Content);
+	const uint8* Data = reinterpret_cast<const uint8*>(Converted.Get());
+	TArray<uint8> Compressed;
+
+	if (Endpoint.bCompressBody && CompressionThreshold > 0 && Converted.Length() >= CompressionThreshold && HttpCompression::Compress(Data, Converted.Length(), Compressed))
+	{
+		Request->SetHeader(TEXT("Content-Encoding"), TEXT("gzip"));
+		Request->SetContent(Compressed);
+
+		return;
+	}
+
+	Request->SetContent(TArray<uint8>(Data, Converted.Length()));
+}
+
+void FHttpRequestFactory::SetCompressionThreshold(int32 Threshold)
+{
+	CompressionThreshold = Threshold;
+}
+
+FString FHttpRequestFactory::CreateUrl(const FHttpEndpoint& Endpoint, std::initializer_list<const TCHAR*> Arguments, const FHttpQuery& Query) const
+{
+	const FString& ServiceUrl = GetServiceUrl(Endpoint.Service);
+	int32 Length = ServiceUrl.Len() + Query.ToString().Len();
+
+	// The first pass sizes the buffer, the second one fills it
+	ForEachPathSegment(Endpoint, Arguments, [&Length](const TCHAR* Segment, int32 SegmentLength)
+	{
+		Length += SegmentLength;
+	});
+
+	FString Url;
+	Url.Reserve(Length);
+	Url.Append(ServiceUrl);
+
+	ForEachPathSegment(Endpoint, Arguments, [&Url](const TCHAR* Segment, int32 SegmentLength)
+	{
+		Url.AppendChars(Segment, SegmentLength);
+	});
+
+	Url.Append(Query.ToString());
+
+	return Url;
+}
+
+const FString& FHttpRequestFactory::GetBasicAuthorization(const FString& ClientId, const FString& ClientSecret)
+{
+	checkSlow(IsInGameThread());
+
+	if (!BasicAuthorization.Credential.Equals(ClientId, ESearchCase::CaseSensitive) || !BasicAuthorization.Secret.Equals(ClientSecret, ESearchCase::CaseSensitive) || BasicAuthorization.Header.IsEmpty())
+	{
+		BasicAuthorization.Credential = ClientId;
+		BasicAuthorization.Secret = ClientSecret;
+		BasicAuthorization.Header = TEXT("Basic ") + FBase64::Encode(ClientId + TEXT(":") + ClientSecret);
+	}
+
+	return BasicAuthorization.Header;
+}
+
+const FString& FHttpRequestFactory::GetServiceUrl(EHttpService Service) const
+{
+	switch (Service)
+	{
+	case EHttpService::Iam:
+		return FactorySettings.IamServerUrl;
+	case EHttpService::Platform:
+		return FactorySettings.PlatformServerUrl;
+	case EHttpService::Basic:
+		return FactorySettings.BasicServerUrl;
+	case EHttpService::CloudStorage:
+		return FactorySettings.CloudStorageServerUrl;
+	case EHttpService::GameProfile:
+	default:
+		return FactorySettings.GameProfileServerUrl;
+	}
+}
+
+const FString& FHttpRequestFactory::GetAuthorization(EHttpAuthorization Authorization)
+{
+	checkSlow(IsInGameThread());
+
+	FCachedAuthorization* Cached = nullptr;
+	const FString* Token = nullptr;
+
+	switch (Authorization)
+	{
+	case EHttpAuthorization::User:
+		Cached = &UserAuthorization;
+		Token = &FactoryCredentials.GetUserAccessToken();
+		break;
+	case EHttpAuthorization::Client:
+		Cached = &ClientAuthorization;
+		Token = &FactoryCredentials.GetClientAccessToken();
+		break;
+	case EHttpAuthorization::Basic:
+		return GetBasicAuthorization(FactorySettings.ClientId, FactorySettings.ClientSecret);
+	default:
+		return EmptyAuthorization;
+	}
+
+	// Compared case sensitively, tokens that differ only in case are different tokens
+	if (!Cached->Credential.Equals(*Token, ESearchCase::CaseSensitive) || Cached->Header.IsEmpty())
+	{
+		Cached->Credential = *Token;
+		Cached->Header = TEXT("Bearer ") + *Token;
+	}
+
+	return Cached->Header;
+}
+
+void FHttpRequestFactory::ForEachPathSegment(const FHttpEndpoint& Endpoint, std::initializer_list<const TCHAR*> Arguments, TFunctionRef<void(const TCHAR*, int32)> Visit) const
+{
+	const TCHAR* const* Argument = Arguments.begin();
+	const TCHAR* Literal = Endpoint.Path;
+	const TCHAR* Character = Endpoint.Path;
+
+	while (*Character != TEXT('\0'))
+	{
+		if (*Character != TEXT('{'))
+		{
+			Character++;
+
+			continue;
+		}
+
+		const TCHAR* PlaceholderEnd = FCString::Strchr(Character, TEXT('}'));
+		check(PlaceholderEnd != nullptr);
+
+		Visit(Literal, Character - Literal);
+
+		int32 NameLength = PlaceholderEnd - Character - 1;
+		const TCHAR* Name = Character + 1;
+		const FString* Value = nullptr;
+
+		if (NameLength == 0)
+		{
+			check(Argument != Arguments.end());
+			Visit(*Argument, FCString::Strlen(*Argument));
+			Argument++;
+		}
+		else if (FCString::Strncmp(Name, TEXT("namespace}"), NameLength + 1) == 0)
+		{
+			Value = &FactoryCredentials.GetUserNamespace();
+		}
+		else if (FCString::Strncmp(Name, TEXT("clientNamespace}"), NameLength + 1) == 0)
+		{
+			Value = &FactoryCredentials.GetClientNamespace();
+		}
+		else if (FCString::Strncmp(Name, TEXT("gameNamespace}"), NameLength + 1) == 0)
+		{
+			Value = &FactorySettings.Namespace;
+		}
+		else if (FCString::Strncmp(Name, TEXT("userId}"), NameLength + 1) == 0)
+		{
+			Value = &FactoryCredentials.GetUserId();
+		}
+		else
+		{
+			checkf(false, TEXT("Unknown placeholder in endpoint %s"), Endpoint.Path);
+		}
+
+		if (Value != nullptr)
+		{
+			Visit(**Value, Value->Len());
+		}
+
+		Character = PlaceholderEnd + 1;
+		Literal = Character;
+	}
+
+	Visit(Literal, Character - Literal);
+}
+
+}
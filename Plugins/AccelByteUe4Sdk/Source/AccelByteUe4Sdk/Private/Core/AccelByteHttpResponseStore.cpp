@@ -0,0 +1,370 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteHttpResponseStore.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace AccelByte
+{
+
+static const uint32 IndexMagic = 0x43524241;
+static const int32 IndexVersion = 1;
+
+/**
+ * @brief 200 response read back from the store.
+ */
+class FStoredHttpResponse : public IHttpResponse
+{
+public:
+	FStoredHttpResponse(const FHttpResponseStore::FEntry& Entry, TArray<uint8>&& Content)
+		: Entry(Entry)
+		, Content(MoveTemp(Content))
+	{
+	}
+
+	FString GetURL() override { return Entry.Url; }
+	FString GetURLParameter(const FString& ParameterName) override { return FString(); }
+
+	FString GetHeader(const FString& HeaderName) override
+	{
+		if (HeaderName == TEXT("ETag"))
+		{
+			return Entry.ETag;
+		}
+		else if (HeaderName == TEXT("Last-Modified"))
+		{
+			return Entry.LastModified;
+		}
+		else if (HeaderName == TEXT("Content-Type"))
+		{
+			return Entry.ContentType;
+		}
+
+		return FString();
+	}
+
+	TArray<FString> GetAllHeaders() override
+	{
+		TArray<FString> Headers;
+
+		for (const TCHAR* Name : { TEXT("ETag"), TEXT("Last-Modified"), TEXT("Content-Type") })
+		{
+			FString Value = GetHeader(Name);
+
+			if (!Value.IsEmpty())
+			{
+				Headers.Add(FString::Printf(TEXT("%s: %s"), Name, *Value));
+			}
+		}
+
+		return Headers;
+	}
+
+	FString GetContentType() override { return Entry.ContentType; }
+	int32 GetContentLength() override { return Content.Num(); }
+	const TArray<uint8>& GetContent() override { return Content; }
+	int32 GetResponseCode() override { return EHttpResponseCodes::Ok; }
+
+	FString GetContentAsString() override
+	{
+		FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+
+		return FString(Converted.Length(), Converted.Get());
+	}
+
+private:
+	const FHttpResponseStore::FEntry Entry;
+	const TArray<uint8> Content;
+};
+
+static FArchive& operator<<(FArchive& Ar, FHttpResponseStore::FEntry& Entry)
+{
+	Ar << Entry.Url;
+	Ar << Entry.ContentType;
+	Ar << Entry.ETag;
+	Ar << Entry.LastModified;
+	Ar << Entry.FreshUntil;
+	Ar << Entry.StaleUntil;
+	Ar << Entry.LastUsed;
+	Ar << Entry.Crc;
+	Ar << Entry.Size;
+
+	return Ar;
+}
+
+FHttpResponseStore::FHttpResponseStore()
+	: Size(0)
+	, bIsDirty(false)
+{
+}
+
+FHttpResponseStore::~FHttpResponseStore()
+{
+	Close();
+}
+
+FString FHttpResponseStore::GetPartitionDirectory(const FString& RootDirectory, const FString& Namespace, const FString& UserId)
+{
+	return RootDirectory / FPaths::MakeValidFileName(Namespace) / FPaths::MakeValidFileName(UserId);
+}
+
+void FHttpResponseStore::Open(const FString& PartitionDirectory)
+{
+	if (PartitionDirectory == Directory)
+	{
+		return;
+	}
+
+	Close();
+	Directory = PartitionDirectory;
+
+	if (!Directory.IsEmpty())
+	{
+		IFileManager::Get().MakeDirectory(*Directory, true);
+		LoadIndex();
+	}
+}
+
+void FHttpResponseStore::Close()
+{
+	Flush();
+	Directory.Empty();
+	Entries.Empty();
+	Size = 0;
+}
+
+bool FHttpResponseStore::IsOpen() const
+{
+	return !Directory.IsEmpty();
+}
+
+const FString& FHttpResponseStore::GetDirectory() const
+{
+	return Directory;
+}
+
+const FHttpResponseStore::FEntry* FHttpResponseStore::Find(const FString& Key) const
+{
+	return Entries.Find(Key);
+}
+
+FHttpResponsePtr FHttpResponseStore::Read(const FString& Key)
+{
+	FEntry* Entry = Entries.Find(Key);
+
+	if (Entry == nullptr)
+	{
+		return nullptr;
+	}
+
+	TArray<uint8> Content;
+
+	if (!FFileHelper::LoadFileToArray(Content, *GetBodyPath(Key), FILEREAD_Silent) || Content.Num() != Entry->Size || FCrc::MemCrc32(Content.GetData(), Content.Num()) != Entry->Crc)
+	{
+		Remove(Key);
+
+		return nullptr;
+	}
+
+	Entry->LastUsed = FDateTime::UtcNow();
+	bIsDirty = true;
+
+	return MakeShared<FStoredHttpResponse, ESPMode::ThreadSafe>(*Entry, MoveTemp(Content));
+}
+
+void FHttpResponseStore::Write(const FString& Key, const FString& Url, const FHttpResponsePtr& Response, const FDateTime& FreshUntil, const FDateTime& StaleUntil)
+{
+	if (!IsOpen())
+	{
+		return;
+	}
+
+	Remove(Key);
+
+	const TArray<uint8>& Content = Response->GetContent();
+
+	if (!FFileHelper::SaveArrayToFile(Content, *GetBodyPath(Key)))
+	{
+		return;
+	}
+
+	FEntry Entry;
+	Entry.Url = Url;
+	Entry.ContentType = Response->GetContentType();
+	Entry.ETag = Response->GetHeader(TEXT("ETag"));
+	Entry.LastModified = Response->GetHeader(TEXT("Last-Modified"));
+	Entry.FreshUntil = FreshUntil;
+	Entry.StaleUntil = StaleUntil;
+	Entry.LastUsed = FDateTime::UtcNow();
+	Entry.Crc = FCrc::MemCrc32(Content.GetData(), Content.Num());
+	Entry.Size = Content.Num();
+	Size += Entry.Size;
+	Entries.Add(Key, MoveTemp(Entry));
+	bIsDirty = true;
+}
+
+void FHttpResponseStore::Touch(const FString& Key, const FDateTime& FreshUntil, const FDateTime& StaleUntil)
+{
+	if (FEntry* Entry = Entries.Find(Key))
+	{
+		Entry->FreshUntil = FreshUntil;
+		Entry->StaleUntil = StaleUntil;
+		Entry->LastUsed = FDateTime::UtcNow();
+		bIsDirty = true;
+	}
+}
+
+void FHttpResponseStore::Remove(const FString& Key)
+{
+	FEntry Entry;
+
+	if (Entries.RemoveAndCopyValue(Key, Entry))
+	{
+		IFileManager::Get().Delete(*GetBodyPath(Key), false, false, true);
+		Size -= Entry.Size;
+		bIsDirty = true;
+	}
+}
+
+void FHttpResponseStore::RemoveIf(TFunctionRef<bool(const FEntry&)> Predicate)
+{
+	TArray<FString> Keys;
+
+	for (const auto& Entry : Entries)
+	{
+		if (Predicate(Entry.Value))
+		{
+			Keys.Add(Entry.Key);
+		}
+	}
+
+	for (const FString& Key : Keys)
+	{
+		Remove(Key);
+	}
+}
+
+void FHttpResponseStore::Trim(int64 Budget)
+{
+	if (Size <= Budget)
+	{
+		return;
+	}
+
+	// Sorted once, least recently used first, instead of searching the oldest entry for every eviction
+	TArray<TPair<FDateTime, FString>> ByLastUse;
+	ByLastUse.Reserve(Entries.Num());
+
+	for (const auto& Entry : Entries)
+	{
+		ByLastUse.Emplace(Entry.Value.LastUsed, Entry.Key);
+	}
+
+	ByLastUse.Sort([](const TPair<FDateTime, FString>& A, const TPair<FDateTime, FString>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	for (int32 i = 0; i < ByLastUse.Num() && Size > Budget; i++)
+	{
+		Remove(ByLastUse[i].Value);
+	}
+}
+
+void FHttpResponseStore::Flush()
+{
+	if (!bIsDirty || !IsOpen())
+	{
+		return;
+	}
+
+	TArray<uint8> Index;
+	FMemoryWriter Writer(Index);
+	uint32 Magic = IndexMagic;
+	int32 Version = IndexVersion;
+	Writer << Magic;
+	Writer << Version;
+	Writer << Entries;
+	uint32 Crc = FCrc::MemCrc32(Index.GetData(), Index.Num());
+	Writer << Crc;
+
+	// Replaced in one move, a crash while writing leaves the previous index intact
+	FString TempPath = GetIndexPath() + TEXT(".tmp");
+
+	if (FFileHelper::SaveArrayToFile(Index, *TempPath) && IFileManager::Get().Move(*GetIndexPath(), *TempPath, true, true))
+	{
+		bIsDirty = false;
+	}
+}
+
+int64 FHttpResponseStore::GetSize() const
+{
+	return Size;
+}
+
+FString FHttpResponseStore::GetBodyPath(const FString& Key) const
+{
+	return Directory / FMD5::HashAnsiString(*Key) + TEXT(".bin");
+}
+
+FString FHttpResponseStore::GetIndexPath() const
+{
+	return Directory / TEXT("index.bin");
+}
+
+void FHttpResponseStore::LoadIndex()
+{
+	TArray<uint8> Index;
+
+	if (!FFileHelper::LoadFileToArray(Index, *GetIndexPath(), FILEREAD_Silent))
+	{
+		return;
+	}
+
+	bool bIsValid = false;
+
+	if (Index.Num() > sizeof(uint32))
+	{
+		int32 PayloadSize = Index.Num() - sizeof(uint32);
+		uint32 Crc = 0;
+		FMemory::Memcpy(&Crc, Index.GetData() + PayloadSize, sizeof(uint32));
+
+		if (Crc == FCrc::MemCrc32(Index.GetData(), PayloadSize))
+		{
+			FMemoryReader Reader(Index);
+			uint32 Magic = 0;
+			int32 Version = 0;
+			Reader << Magic;
+			Reader << Version;
+
+			if (Magic == IndexMagic && Version == IndexVersion)
+			{
+				Reader << Entries;
+				bIsValid = !Reader.IsError();
+			}
+		}
+	}
+
+	if (!bIsValid)
+	{
+		// Nothing in a damaged partition can be trusted, it is started again
+		Entries.Empty();
+		IFileManager::Get().DeleteDirectory(*Directory, false, true);
+		IFileManager::Get().MakeDirectory(*Directory, true);
+
+		return;
+	}
+
+	for (const auto& Entry : Entries)
+	{
+		Size += Entry.Value.Size;
+	}
+}
+
+} // Namespace AccelByte
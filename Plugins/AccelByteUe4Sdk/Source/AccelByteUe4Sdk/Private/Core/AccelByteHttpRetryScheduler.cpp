@@ -3,6 +3,11 @@
 // and restrictions contact your company contract manager.
 
 #include "AccelByteHttpRetryScheduler.h"
+#include "AccelByteHttpWorker.h"
+#include "AccelByteHttpCompression.h"
+#include "AccelByteHttpTransport.h"
+#include "AccelByteTrace.h"
+#include "Misc/ScopeLock.h"
 #include <algorithm>
 
 using namespace std;
@@ -18,114 +23,2531 @@ namespace HttpRequest
 			Request->GetStatus() == EHttpRequestStatus::Failed_ConnectionError ||
 			Request->GetStatus() == EHttpRequestStatus::Succeeded;
 	}
+
+	FString GetServiceUrl(const FString& Url)
+	{
+		int32 SchemeEnd = Url.Find(TEXT("://"));
+		int32 Index = (SchemeEnd == INDEX_NONE) ? 0 : SchemeEnd + 3;
+		int32 SlashCount = 0;
+
+		for (; Index < Url.Len(); Index++)
+		{
+			TCHAR Character = Url[Index];
+
+			if (Character == TEXT('?') || Character == TEXT('#'))
+			{
+				break;
+			}
+
+			// The host ends at the first slash, the service prefix at the second one
+			if (Character == TEXT('/') && ++SlashCount == 2)
+			{
+				break;
+			}
+		}
+
+		return Url.Left(Index);
+	}
+
+	FString GetParentPath(const FString& Url)
+	{
+		int32 PathEnd = Url.Len();
+		int32 Index;
+
+		if (Url.FindChar(TEXT('?'), Index))
+		{
+			PathEnd = Index;
+		}
+
+		if (Url.FindChar(TEXT('#'), Index))
+		{
+			PathEnd = FMath::Min(PathEnd, Index);
+		}
+
+		FString Path = Url.Left(PathEnd);
+		Path.RemoveFromEnd(TEXT("/"));
+		FString ServiceUrl = GetServiceUrl(Path);
+
+		if (Path.FindLastChar(TEXT('/'), Index) && Index >= ServiceUrl.Len())
+		{
+			return Path.Left(Index);
+		}
+
+		return ServiceUrl;
+	}
+
+	/** Whether the URL is the path itself or below it. */
+	static bool IsUnderPath(const FString& Url, const FString& Path)
+	{
+		if (!Url.StartsWith(Path, ESearchCase::CaseSensitive))
+		{
+			return false;
+		}
+
+		TCHAR Next = (Url.Len() > Path.Len()) ? Url[Path.Len()] : TEXT('/');
+
+		return Next == TEXT('/') || Next == TEXT('?') || Next == TEXT('#');
+	}
+
+	bool IsRetrySafe(const FHttpRequestPtr& Request)
+	{
+		FString Verb = Request->GetVerb();
+
+		return (Verb != TEXT("POST") && Verb != TEXT("PATCH")) || !Request->GetHeader(TEXT("Idempotency-Key")).IsEmpty();
+	}
+
+	static bool IsIdSegment(const FString& Segment)
+	{
+		bool bIsNumber = Segment.Len() > 0;
+		bool bIsHex = Segment.Len() >= 16;
+
+		for (TCHAR Character : Segment)
+		{
+			bIsNumber = bIsNumber && FChar::IsDigit(Character);
+			bIsHex = bIsHex && (FChar::IsHexDigit(Character) || Character == TEXT('-'));
+		}
+
+		return bIsNumber || bIsHex;
+	}
+
+	FString GetEndpointTemplate(const FString& Verb, const FString& Url)
+	{
+		int32 QueryStart = Url.Len();
+		int32 QueryIndex;
+		int32 FragmentIndex;
+
+		if (Url.FindChar(TEXT('?'), QueryIndex))
+		{
+			QueryStart = QueryIndex;
+		}
+
+		if (Url.FindChar(TEXT('#'), FragmentIndex))
+		{
+			QueryStart = FMath::Min(QueryStart, FragmentIndex);
+		}
+
+		int32 SchemeEnd = Url.Find(TEXT("://"));
+		int32 PathStart = Url.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, (SchemeEnd == INDEX_NONE) ? 0 : SchemeEnd + 3);
+
+		if (PathStart == INDEX_NONE || PathStart > QueryStart)
+		{
+			return Verb + TEXT(" ") + Url.Left(QueryStart);
+		}
+
+		TArray<FString> Segments;
+		Url.Mid(PathStart, QueryStart - PathStart).ParseIntoArray(Segments, TEXT("/"), false);
+		FString Result = Verb + TEXT(" ") + Url.Left(PathStart);
+
+		for (int32 i = 1; i < Segments.Num(); i++)
+		{
+			Result += IsIdSegment(Segments[i]) ? FString(TEXT("/{id}")) : TEXT("/") + Segments[i];
+		}
+
+		return Result;
+	}
+
+	double GetRetryAfter(const FHttpResponsePtr& Response)
+	{
+		FString Value = Response->GetHeader(TEXT("Retry-After")).TrimStartAndEnd();
+
+		if (Value.IsNumeric())
+		{
+			return FMath::Max(0.0, FCString::Atod(*Value));
+		}
+
+		FDateTime Date;
+
+		if (!Value.IsEmpty() && FDateTime::ParseHttpDate(Value, Date))
+		{
+			return FMath::Max(0.0, (Date - FDateTime::UtcNow()).GetTotalSeconds());
+		}
+
+		return -1.0;
+	}
+
+	static void SetValidators(const FHttpRequestPtr& Request, const FString& ETag, const FString& LastModified)
+	{
+		if (!ETag.IsEmpty())
+		{
+			Request->SetHeader(TEXT("If-None-Match"), ETag);
+		}
+
+		if (!LastModified.IsEmpty())
+		{
+			Request->SetHeader(TEXT("If-Modified-Since"), LastModified);
+		}
+	}
+
+	/**
+	 * @brief Seconds a response stays fresh and may then be served while it is revalidated, from its Cache-Control and Age headers; false when it must not be stored.
+	 */
+	static bool GetCacheLifetime(const FHttpResponsePtr& Response, double& OutMaxAge, double& OutStaleWhileRevalidate)
+	{
+		TArray<FString> Directives;
+		Response->GetHeader(TEXT("Cache-Control")).ParseIntoArray(Directives, TEXT(","));
+		bool bIsNoCache = false;
+		OutMaxAge = 0.0;
+		OutStaleWhileRevalidate = 0.0;
+
+		for (FString& Directive : Directives)
+		{
+			FString Name;
+			FString Value;
+
+			if (!Directive.Split(TEXT("="), &Name, &Value))
+			{
+				Name = Directive;
+			}
+
+			Name.TrimStartAndEndInline();
+			Value.TrimStartAndEndInline();
+
+			if (Name == TEXT("no-store"))
+			{
+				return false;
+			}
+			else if (Name == TEXT("no-cache"))
+			{
+				bIsNoCache = true;
+			}
+			else if (Name == TEXT("max-age") && Value.IsNumeric())
+			{
+				OutMaxAge = FCString::Atod(*Value);
+			}
+			else if (Name == TEXT("stale-while-revalidate") && Value.IsNumeric())
+			{
+				OutStaleWhileRevalidate = FCString::Atod(*Value);
+			}
+		}
+
+		FString Age = Response->GetHeader(TEXT("Age")).TrimStartAndEnd();
+
+		if (bIsNoCache)
+		{
+			OutMaxAge = 0.0;
+		}
+		else if (Age.IsNumeric())
+		{
+			OutMaxAge = FMath::Max(0.0, OutMaxAge - FCString::Atod(*Age));
+		}
+
+		return true;
+	}
+
+	static bool GetRateLimitHeader(const FHttpResponsePtr& Response, const TCHAR* Field, double& OutValue)
+	{
+		FString Value = Response->GetHeader(FString(TEXT("X-RateLimit-")) + Field);
+
+		if (Value.IsEmpty())
+		{
+			Value = Response->GetHeader(FString(TEXT("RateLimit-")) + Field);
+		}
+
+		Value.TrimStartAndEndInline();
+
+		if (!Value.IsNumeric())
+		{
+			return false;
+		}
+
+		OutValue = FCString::Atod(*Value);
+
+		return true;
+	}
+}
+
+static const int32 LatencyHistorySize = 64;
+static const int32 MinimumLatencySamples = 20;
+/** Share of hedged requests that may get a second copy. */
+static const double HedgeBudgetRatio = 0.1;
+static const double MinimumHedgeDelay = 0.05;
+/** Bytes per second an upload is given time for, so a congested mobile uplink still finishes before the deadline. */
+static const double MinimumUploadRate = 16 * 1024;
+
+/**
+ * @brief Response made up by the scheduler for a request that was not sent.
+ */
+class FHttpLocalResponse : public IHttpResponse
+{
+public:
+	FHttpLocalResponse(const FString& Url, int32 ResponseCode, const FString& ContentString)
+		: Url(Url)
+		, ResponseCode(ResponseCode)
+		, ContentString(ContentString)
+	{
+		FTCHARToUTF8 Converted(*ContentString);
+		Content.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	}
+
+	FString GetURL() override { return Url; }
+	FString GetURLParameter(const FString& ParameterName) override { return FString(); }
+	FString GetHeader(const FString& HeaderName) override { return (HeaderName == TEXT("Content-Type")) ? GetContentType() : FString(); }
+	TArray<FString> GetAllHeaders() override { return TArray<FString>{ TEXT("Content-Type: ") + GetContentType() }; }
+	FString GetContentType() override { return TEXT("application/json"); }
+	int32 GetContentLength() override { return Content.Num(); }
+	const TArray<uint8>& GetContent() override { return Content; }
+	int32 GetResponseCode() override { return ResponseCode; }
+	FString GetContentAsString() override { return ContentString; }
+
+private:
+	FString Url;
+	int32 ResponseCode;
+	FString ContentString;
+	TArray<uint8> Content;
+};
+
+FHttpRetryPolicy::FHttpRetryPolicy()
+	: AttemptTimeout(0.0)
+	, MaxAttempts(0)
+	, InitialDelay(FHttpRetryScheduler::InitialDelay)
+	, MaximumDelay(FHttpRetryScheduler::MaximumDelay)
+	, BackoffMultiplier(2.0f)
+	, Jitter(0.25f)
+	, RetryableStatuses{ EHttpResponseCodes::ServerError, EHttpResponseCodes::BadGateway, EHttpResponseCodes::ServiceUnavail, EHttpResponseCodes::GatewayTimeout }
+	, Timeout(FHttpRetryScheduler::TotalTimeout)
+	, Deadline(0.0)
+	, bIsHedged(false)
+	, HedgePercentile(0.95f)
+	, bIsDurable(false)
+	, bIsIdempotencyKeyed(false)
+{
+}
+
+FHttpRetryPolicy FHttpRetryPolicy::Interactive()
+{
+	FHttpRetryPolicy Policy;
+	Policy.AttemptTimeout = 5.0;
+	Policy.MaxAttempts = 3;
+	Policy.InitialDelay = 0.5;
+	Policy.MaximumDelay = 2.0;
+	Policy.Timeout = 15.0;
+
+	return Policy;
+}
+
+FHttpRetryPolicy FHttpRetryPolicy::Background()
+{
+	FHttpRetryPolicy Policy;
+	Policy.InitialDelay = 2.0;
+	Policy.MaximumDelay = 60.0;
+	Policy.Timeout = 600.0;
+
+	return Policy;
+}
+
+FHttpRetryPolicy FHttpRetryPolicy::Upload(int64 ContentLength)
+{
+	FHttpRetryPolicy Policy = Background();
+	Policy.Timeout = FMath::Max(Policy.Timeout, ContentLength / MinimumUploadRate);
+
+	return Policy;
+}
+
+FHttpRetryPolicy FHttpRetryPolicy::Hedged()
+{
+	FHttpRetryPolicy Policy;
+	Policy.bIsHedged = true;
+
+	return Policy;
+}
+
+FHttpRetryPolicy FHttpRetryPolicy::Durable()
+{
+	FHttpRetryPolicy Policy = Interactive();
+	Policy.bIsDurable = true;
+
+	return Policy;
+}
+
+FHttpRetryPolicy FHttpRetryPolicy::Keyed(FHttpRetryPolicy Policy)
+{
+	Policy.bIsIdempotencyKeyed = true;
+
+	return Policy;
+}
+
+FHttpRetryScheduler::FCircuitBreakerConfig::FCircuitBreakerConfig()
+	: Window(30.0)
+	, MinimumCalls(10)
+	, FailureRateThreshold(0.5f)
+	, SlowCallDuration(10.0)
+	, SlowCallRateThreshold(0.8f)
+	, OpenDuration(5.0)
+	, MaximumOpenDuration(60.0)
+{
+}
+
+FHttpRetryScheduler::FHttpRetryTask::FHttpRetryTask(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, const FHttpRetryPolicy& Policy)
+	: Request(Request)
+	, CompleteDelegate(CompleteDelegate)
+	, RequestTime(RequestTime)
+	, Policy(Policy)
+	, Deadline((Policy.Deadline > 0.0) ? Policy.Deadline : RequestTime + Policy.Timeout)
+	, AttemptCount(0)
+	, bIsAttemptTimedOut(false)
+	, NextDelay(Policy.InitialDelay)
+	, NextRetryTime(RequestTime + Policy.InitialDelay)
+	, bIsRetryPending(false)
+	, RequestClass(EHttpRequestClass::Interactive)
+	, bIsDispatched(false)
+	, ThrottledSince(-1.0)
+	, DispatchTime(RequestTime)
+	, bIsProbe(false)
+	, bIsReplayed(false)
+	, ParkedSince(-1.0)
+	, HedgeTime(0.0)
+	, HedgeResponseBytes(-1)
+	, bIsServedFromCache(false)
+	, JournalSequence(0)
+	, bIsJournalReplay(false)
+	, DispatchCycles(0)
+	, TraceId(0)
+{
+}
+
+/** Innermost batch scope open on this thread. */
+static thread_local FHttpBatchScope* CurrentBatchScope = nullptr;
+
+FHttpBatchScope::FHttpBatchScope(FHttpRetryScheduler& Scheduler, const FVoidHandler& OnComplete)
+	: Scheduler(Scheduler)
+	, OnComplete(OnComplete)
+	, Previous(CurrentBatchScope)
+{
+	CurrentBatchScope = this;
+}
+
+FHttpBatchScope::~FHttpBatchScope()
+{
+	CurrentBatchScope = Previous;
+
+	if (Requests.Num() == 0)
+	{
+		FVoidHandler BatchComplete = OnComplete;
+
+		RunOnGameThread([BatchComplete]()
+		{
+			BatchComplete.ExecuteIfBound();
+		});
+
+		return;
+	}
+
+	// Requests to one service go out back to back, in the order the game sent them
+	Requests.StableSort([](const FHeldRequest& A, const FHeldRequest& B)
+	{
+		return HttpRequest::GetServiceUrl(A.Request->GetURL()) < HttpRequest::GetServiceUrl(B.Request->GetURL());
+	});
+
+	if (OnComplete.IsBound())
+	{
+		// Only touched from the scheduler's thread, where the requests complete
+		TSharedRef<int32, ESPMode::ThreadSafe> Remaining = MakeShared<int32, ESPMode::ThreadSafe>(Requests.Num());
+		FVoidHandler BatchComplete = OnComplete;
+
+		for (FHeldRequest& Held : Requests)
+		{
+			FHttpRequestCompleteDelegate CompleteDelegate = Held.CompleteDelegate;
+
+			Held.CompleteDelegate = FHttpRequestCompleteDelegate::CreateLambda([CompleteDelegate, Remaining, BatchComplete](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccessful)
+			{
+				CompleteDelegate.ExecuteIfBound(Request, Response, bSuccessful);
+
+				// Queued behind the handlers of the last request, which its delegate has just queued
+				if (--Remaining.Get() == 0)
+				{
+					RunOnGameThread([BatchComplete]()
+					{
+						BatchComplete.ExecuteIfBound();
+					});
+				}
+			});
+		}
+	}
+
+	Scheduler.ProcessBatch(MoveTemp(Requests));
+}
+
+int32 FHttpBatchScope::Num() const
+{
+	return Requests.Num();
+}
+
+FHttpBatchScope* FHttpBatchScope::Find(const FHttpRetryScheduler& Scheduler)
+{
+	for (FHttpBatchScope* Scope = CurrentBatchScope; Scope != nullptr; Scope = Scope->Previous)
+	{
+		if (&Scope->Scheduler == &Scheduler)
+		{
+			return Scope;
+		}
+	}
+
+	return nullptr;
+}
+
+FHttpRetryScheduler::FHttpRetryScheduler()
+	: CoalescingStats{ 0, 0 }
+	, MaxInFlightPerService(16)
+	, ThrottlingStats{ 0, 0, 0.0, 0 }
+	, InheritedDeadline(0.0)
+	, HedgingStats{ 0, 0, 0, 0 }
+	, HedgesInFlight(0)
+	, MaxHedgesInFlight(4)
+	, HedgeTokens(0.0)
+	, ResponseCacheStats{ 0, 0, 0, 0, 0, 0, 0 }
+	, ResponseCacheBudget(8 * 1024 * 1024)
+	, bIsRevalidating(false)
+	, ResponseStoreMaxStaleAge(0.0)
+	, ResponseStoreFlushTime(0.0)
+	, ReplayingSequence(0)
+	, bIsReplayInFlight(false)
+	, NextReplayTime(0.0)
+	, ReplayDelay(InitialDelay)
+	, Worker(nullptr)
+	, LastPollTime(0.0)
+	, ClockOffset(TNumericLimits<double>::Lowest())
+	, bIsRefreshTokenRequested(false)
+	, bIsDispatchingQueue(false)
+	, bIsDispatchQueuePending(false)
+{
+	FMemory::Memzero(LaneStats);
+	LaneMaxInFlight[static_cast<int32>(EHttpRequestClass::Auth)] = 4;
+	LaneMaxInFlight[static_cast<int32>(EHttpRequestClass::Commerce)] = 4;
+	LaneMaxInFlight[static_cast<int32>(EHttpRequestClass::Interactive)] = 8;
+	LaneMaxInFlight[static_cast<int32>(EHttpRequestClass::Background)] = 2;
+}
+
+bool FHttpRetryScheduler::ProcessRequest(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, EHttpRequestClass RequestClass, const FHttpRetryPolicy& Policy)
+{
+	// The scheduler binds the request's completion itself, a binding of the caller's would be silently replaced
+	check(!Request->OnProcessRequestComplete().IsBound());
+
+	if (FHttpBatchScope* Batch = FHttpBatchScope::Find(*this))
+	{
+		Batch->Requests.Add(FHttpBatchScope::FHeldRequest{ Request, CompleteDelegate, RequestTime, RequestClass, Policy });
+
+		return true;
+	}
+
+	if (IsOffSchedulerThread())
+	{
+		// Tasks belong to the worker; a request sent from a delivered handler keeps that request's deadline
+		double Deadline = Worker->GetHandlerDeadline();
+
+		Worker->RunOnWorker([this, Request, CompleteDelegate, RequestTime, RequestClass, Policy, Deadline]()
+		{
+			TGuardValue<double> DeadlineGuard(InheritedDeadline, Deadline > 0.0 ? Deadline : InheritedDeadline);
+
+			if (!ProcessRequest(Request, CompleteDelegate, RequestTime, RequestClass, Policy))
+			{
+				// The caller has already returned, it learns about the failure from its delegate
+				CompleteDelegate.ExecuteIfBound(Request, nullptr, false);
+			}
+		});
+
+		return true;
+	}
+
+	if (Policy.bIsIdempotencyKeyed && !HttpRequest::IsRetrySafe(Request))
+	{
+		// Set once on the request object, every attempt and every journal replay of it sends the same key
+		Request->SetHeader(TEXT("Idempotency-Key"), FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphens).ToLower());
+	}
+
+	FString CoalescingKey = GetCoalescingKey(Request);
+
+	if (!CoalescingKey.IsEmpty() && ResponseCacheBudget > 0 && ResponseStore.IsOpen() && !ResponseCache.Contains(CoalescingKey))
+	{
+		RestoreResponse(Request, CoalescingKey, RequestTime);
+	}
+
+	// A current cached response answers before an identical request in flight would
+	if (!CoalescingKey.IsEmpty() && ResponseCacheBudget > 0 && ServeFromCache(Request, CompleteDelegate, CoalescingKey, RequestTime))
+	{
+		return true;
+	}
+
+	if (!CoalescingKey.IsEmpty())
+	{
+		TSharedPtr<FHttpRetryTask, ESPMode::ThreadSafe> InFlightTask = InFlightGets.FindRef(CoalescingKey).Pin();
+
+		if (InFlightTask.IsValid() && Tasks.Contains(InFlightTask.ToSharedRef()))
+		{
+			InFlightTask->JoinedDelegates.Add(CompleteDelegate);
+			CoalescingStats.Hits++;
+			Trace::Instant(TEXT("Http"), TEXT("Joined"), InFlightTask->TraceId);
+
+			return true;
+		}
+
+		CoalescingStats.Misses++;
+	}
+
+	TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe> Task = MakeShared<FHttpRetryTask, ESPMode::ThreadSafe>(Request, CompleteDelegate, RequestTime, Policy);
+	TWeakPtr<FHttpRetryTask, ESPMode::ThreadSafe> WeakTask = Task;
+	Task->RequestClass = RequestClass;
+	Task->ServiceUrl = HttpRequest::GetServiceUrl(Request->GetURL());
+	Task->EndpointTemplate = HttpRequest::GetEndpointTemplate(Request->GetVerb(), Request->GetURL());
+
+	Task->Metrics = Metrics.FindOrAdd(Task->EndpointTemplate);
+	Task->TraceId = Trace::NewId();
+	Trace::Begin(TEXT("Http"), TEXT("Request"), Task->TraceId, Task->EndpointTemplate);
+
+	// Time to first byte is only visible through download progress; the caller's own progress delegate still runs
+	FHttpRequestProgressDelegate Progress = Request->OnRequestProgress();
+	Request->OnRequestProgress().BindLambda([WeakTask, Progress](FHttpRequestPtr ProgressRequest, int32 BytesSent, int32 BytesReceived)
+	{
+		TSharedPtr<FHttpRetryTask, ESPMode::ThreadSafe> ProgressTask = WeakTask.Pin();
+
+		if (BytesReceived > 0 && ProgressTask.IsValid() && ProgressTask->FirstByteCycles.GetValue() == 0)
+		{
+			ProgressTask->FirstByteCycles.Set(FPlatformTime::Cycles64());
+		}
+
+		Progress.ExecuteIfBound(ProgressRequest, BytesSent, BytesReceived);
+	});
+
+	if (ReplayingSequence != 0)
+	{
+		Task->JournalSequence = ReplayingSequence;
+		Task->JournalPath = Journal.GetPath();
+		Task->bIsJournalReplay = true;
+	}
+	else if (Policy.bIsDurable && Journal.IsOpen())
+	{
+		// On disk before it is sent, a crash while it is in flight replays it in the next session
+		Task->JournalSequence = Journal.Append(Request);
+		Task->JournalPath = Journal.GetPath();
+	}
+
+	if (!CoalescingKey.IsEmpty() && ResponseCacheBudget > 0)
+	{
+		Task->CacheKey = CoalescingKey;
+		const FCachedResponse* Cached = ResponseCache.Find(CoalescingKey);
+
+		if (Cached != nullptr)
+		{
+			// An expired response is asked for again with its validators, the backend answers 304 when it is still current
+			if (Request->GetHeader(TEXT("If-None-Match")).IsEmpty() && Request->GetHeader(TEXT("If-Modified-Since")).IsEmpty())
+			{
+				HttpRequest::SetValidators(Request, Cached->ETag, Cached->LastModified);
+			}
+
+			// A 304 only stands for the cached response when the validators were taken from it
+			if (Request->GetHeader(TEXT("If-None-Match")).Equals(Cached->ETag, ESearchCase::CaseSensitive) && Request->GetHeader(TEXT("If-Modified-Since")).Equals(Cached->LastModified, ESearchCase::CaseSensitive))
+			{
+				Task->ValidatedResponse = Cached->Response;
+			}
+		}
+	}
+
+	if (InheritedDeadline > 0.0)
+	{
+		Task->Deadline = FMath::Min(Task->Deadline, InheritedDeadline);
+	}
+
+	// A caller ahead of the last poll moves the clock forward, one that queued its request earlier never winds it back
+	if (RequestTime > GetCurrentTime())
+	{
+		ClockOffset = RequestTime - FPlatformTime::Seconds();
+	}
+
+	// The response is classified as soon as the request reports it; timers only drive backoff and deadline
+	Request->OnProcessRequestComplete().BindLambda([this, WeakTask](FHttpRequestPtr, FHttpResponsePtr, bool)
+	{
+		// Timed when the transport reports it, not when the scheduler thread gets to it
+		double FinishedSeconds = FPlatformTime::Seconds();
+
+		RunOnSchedulerThread([this, WeakTask, FinishedSeconds]()
+		{
+			TSharedPtr<FHttpRetryTask, ESPMode::ThreadSafe> Task = WeakTask.Pin();
+
+			if (Task.IsValid() && Tasks.Contains(Task.ToSharedRef()))
+			{
+				OnRequestFinished(Task.ToSharedRef(), FinishedSeconds + ClockOffset);
+			}
+		});
+	});
+
+	Tasks.Add(Task);
+
+	if (RequestTime >= Task->Deadline)
+	{
+		// A child of a request that ran out of time, nothing is sent
+		LocalTasks.Add(Task);
+	}
+	else if (!AdmitThroughCircuit(Task))
+	{
+		// Failed from the next poll, callers never get their callback from inside ProcessRequest
+		Reject(Task);
+		LocalTasks.Add(Task);
+	}
+	else if (HasFreeSlot(Task) && !IsThrottled(Task))
+	{
+		if (!Dispatch(Task))
+		{
+			Request->OnProcessRequestComplete().Unbind();
+			Request->OnRequestProgress() = Progress;
+			Tasks.Remove(Task);
+
+			if (Task->JournalSequence != 0 && !Task->bIsJournalReplay)
+			{
+				Journal.Release(Task->JournalSequence);
+			}
+
+			return false;
+		}
+	}
+	else
+	{
+		LaneQueues[static_cast<int32>(RequestClass)].Add(Task);
+		LaneStats[static_cast<int32>(RequestClass)].QueueDepth++;
+		Metrics.QueuedRequests.Increment();
+	}
+
+	if (!CoalescingKey.IsEmpty() && Tasks.Contains(Task))
+	{
+		Task->CoalescingKey = MoveTemp(CoalescingKey);
+		InFlightGets.Add(Task->CoalescingKey, Task);
+	}
+
+	return true;
+}
+
+void FHttpRetryScheduler::ProcessBatch(TArray<FHttpBatchScope::FHeldRequest>&& Requests)
+{
+	if (IsOffSchedulerThread())
+	{
+		// Handed over at once, the worker wakes up once for the whole batch
+		TSharedRef<TArray<FHttpBatchScope::FHeldRequest>, ESPMode::ThreadSafe> Batch = MakeShared<TArray<FHttpBatchScope::FHeldRequest>, ESPMode::ThreadSafe>(MoveTemp(Requests));
+
+		Worker->RunOnWorker([this, Batch]()
+		{
+			ProcessBatch(MoveTemp(Batch.Get()));
+		});
+
+		return;
+	}
+
+	for (const FHttpBatchScope::FHeldRequest& Held : Requests)
+	{
+		if (!ProcessRequest(Held.Request, Held.CompleteDelegate, Held.RequestTime, Held.RequestClass, Held.Policy))
+		{
+			// The caller has already returned, it learns about the failure from its delegate
+			Held.CompleteDelegate.ExecuteIfBound(Held.Request, nullptr, false);
+		}
+	}
+}
+
+bool FHttpRetryScheduler::PollRetry(double CurrentTime, Credentials& UserCredentials)
+{
+	// Completions are timed between two polls, the clock never runs back behind them
+	CurrentTime = FMath::Max(CurrentTime, GetCurrentTime());
+	LastPollTime = CurrentTime;
+	ClockOffset = CurrentTime - FPlatformTime::Seconds();
+
+	if (!ResponseStoreRoot.IsEmpty())
+	{
+		PollResponseStore(CurrentTime, UserCredentials);
+	}
+
+	if (!JournalRoot.IsEmpty())
+	{
+		PollJournal(CurrentTime, UserCredentials);
+	}
+
+	if (bIsRefreshTokenRequested)
+	{
+		ScheduleRefreshToken(UserCredentials, CurrentTime);
+		bIsRefreshTokenRequested = false;
+	}
+
+	if (ParkedTasks.Num() > 0)
+	{
+		PollParkedTasks(CurrentTime, UserCredentials);
+	}
+
+	if (LocalTasks.Num() > 0)
+	{
+		TArray<TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>> Local = MoveTemp(LocalTasks);
+		LocalTasks.Reset();
+
+		for (const auto& Task : Local)
+		{
+			if (Tasks.Contains(Task))
+			{
+				CompleteTask(Task, CurrentTime);
+			}
+		}
+	}
+
+	if (Tasks.Num() == 0)
+	{
+		PublishStats();
+
+		return false;
+	}
+
+	DispatchQueued();
+
+	while (RetryTimers.Num() > 0 && RetryTimers.HeapTop().Time <= CurrentTime)
+	{
+		FHttpRetryTimer Timer;
+		RetryTimers.HeapPop(Timer, false);
+		TSharedPtr<FHttpRetryTask, ESPMode::ThreadSafe> Task = Timer.Task.Pin();
+
+		// Requeued tasks wait for the rate limiter, their old timers don't apply anymore
+		if (Task.IsValid() && Task->bIsDispatched && Task->NextRetryTime == Timer.Time && Tasks.Contains(Task.ToSharedRef()))
+		{
+			OnTimerExpired(Task.ToSharedRef(), CurrentTime);
+		}
+	}
+
+	while (HedgeTimers.Num() > 0 && HedgeTimers.HeapTop().Time <= CurrentTime)
+	{
+		FHttpRetryTimer Timer;
+		HedgeTimers.HeapPop(Timer, false);
+		TSharedPtr<FHttpRetryTask, ESPMode::ThreadSafe> Task = Timer.Task.Pin();
+
+		// Only a first attempt that is still waiting gets a copy
+		if (Task.IsValid() && Task->HedgeTime == Timer.Time && Task->bIsDispatched && !Task->bIsRetryPending && Task->AttemptCount == 1
+			&& !Task->HedgeRequest.IsValid() && Task->Request->GetStatus() == EHttpRequestStatus::Processing && Tasks.Contains(Task.ToSharedRef()))
+		{
+			if (HedgesInFlight < MaxHedgesInFlight && HedgeTokens >= 1.0)
+			{
+				SendHedge(Task.ToSharedRef());
+			}
+			else
+			{
+				HedgingStats.Capped++;
+			}
+		}
+	}
+
+	PublishStats();
+
+	return true;
+}
+
+int32 FHttpRetryScheduler::GetTaskCount() const
+{
+	if (IsOffSchedulerThread())
+	{
+		FScopeLock Lock(&StatsLock);
+
+		return PublishedStats.TaskCount;
+	}
+
+	return Tasks.Num();
+}
+
+SIZE_T FHttpRetryScheduler::GetAllocatedSize() const
+{
+	SIZE_T Size = Tasks.GetAllocatedSize()
+		+ RetryTimers.GetAllocatedSize()
+		+ HedgeTimers.GetAllocatedSize()
+		+ InFlightGets.GetAllocatedSize()
+		+ LocalTasks.GetAllocatedSize()
+		+ ParkedTasks.GetAllocatedSize()
+		+ ServiceSlots.GetAllocatedSize()
+		+ RateLimitBuckets.GetAllocatedSize()
+		+ CircuitBreakers.GetAllocatedSize()
+		+ LatencyHistories.GetAllocatedSize();
+
+	for (const TArray<TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>>& Queue : LaneQueues)
+	{
+		Size += Queue.GetAllocatedSize();
+	}
+
+	for (const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task : Tasks)
+	{
+		Size += Task->GetAllocatedSize();
+	}
+
+	for (const TPair<FString, TWeakPtr<FHttpRetryTask, ESPMode::ThreadSafe>>& Get : InFlightGets)
+	{
+		Size += Get.Key.GetAllocatedSize();
+	}
+
+	return Size;
+}
+
+FHttpRetryScheduler::FCoalescingStats FHttpRetryScheduler::GetCoalescingStats() const
+{
+	if (IsOffSchedulerThread())
+	{
+		FScopeLock Lock(&StatsLock);
+
+		return PublishedStats.Coalescing;
+	}
+
+	return CoalescingStats;
+}
+
+FHttpRetryScheduler::FLaneStats FHttpRetryScheduler::GetLaneStats(EHttpRequestClass RequestClass) const
+{
+	if (IsOffSchedulerThread())
+	{
+		FScopeLock Lock(&StatsLock);
+
+		return PublishedStats.Lanes[static_cast<int32>(RequestClass)];
+	}
+
+	return LaneStats[static_cast<int32>(RequestClass)];
+}
+
+FHttpRetryScheduler::FThrottlingStats FHttpRetryScheduler::GetThrottlingStats() const
+{
+	if (IsOffSchedulerThread())
+	{
+		FScopeLock Lock(&StatsLock);
+
+		return PublishedStats.Throttling;
+	}
+
+	FThrottlingStats Stats = ThrottlingStats;
+	Stats.ThrottledEndpoints = 0;
+
+	for (const auto& Bucket : RateLimitBuckets)
+	{
+		if (LastPollTime < Bucket.Value.BlockedUntil || (Bucket.Value.Capacity > 0.0 && Bucket.Value.Tokens < 1.0))
+		{
+			Stats.ThrottledEndpoints++;
+		}
+	}
+
+	return Stats;
+}
+
+ECircuitState FHttpRetryScheduler::GetCircuitState(const FString& Url) const
+{
+	if (IsOffSchedulerThread())
+	{
+		FScopeLock Lock(&StatsLock);
+		const ECircuitState* State = PublishedStats.CircuitStates.Find(HttpRequest::GetServiceUrl(Url));
+
+		return (State == nullptr) ? ECircuitState::Closed : *State;
+	}
+
+	const FCircuitBreaker* Breaker = CircuitBreakers.Find(HttpRequest::GetServiceUrl(Url));
+
+	return (Breaker == nullptr) ? ECircuitState::Closed : Breaker->State;
+}
+
+void FHttpRetryScheduler::SetCircuitBreakerConfig(const FCircuitBreakerConfig& Config)
+{
+	if (IsOffSchedulerThread())
+	{
+		Worker->RunOnWorker([this, Config]()
+		{
+			SetCircuitBreakerConfig(Config);
+		});
+
+		return;
+	}
+
+	CircuitBreakerConfig = Config;
+}
+
+FHttpRetryScheduler::FCircuitStateChanged& FHttpRetryScheduler::OnCircuitStateChanged()
+{
+	return CircuitStateChanged;
+}
+
+FHttpRetryScheduler::FHedgingStats FHttpRetryScheduler::GetHedgingStats() const
+{
+	if (IsOffSchedulerThread())
+	{
+		FScopeLock Lock(&StatsLock);
+
+		return PublishedStats.Hedging;
+	}
+
+	return HedgingStats;
+}
+
+FHttpRetryScheduler::FResponseCacheStats FHttpRetryScheduler::GetResponseCacheStats() const
+{
+	if (IsOffSchedulerThread())
+	{
+		FScopeLock Lock(&StatsLock);
+
+		return PublishedStats.ResponseCache;
+	}
+
+	FResponseCacheStats Stats = ResponseCacheStats;
+	Stats.Entries = ResponseCache.Num();
+
+	return Stats;
+}
+
+void FHttpRetryScheduler::SetResponseCacheBudget(int64 Budget)
+{
+	if (IsOffSchedulerThread())
+	{
+		Worker->RunOnWorker([this, Budget]()
+		{
+			SetResponseCacheBudget(Budget);
+		});
+
+		return;
+	}
+
+	ResponseCacheBudget = FMath::Max<int64>(Budget, 0);
+	TrimResponseCache();
+	ResponseStore.Trim(ResponseCacheBudget);
+}
+
+void FHttpRetryScheduler::SetResponseStoreDirectory(const FString& Directory, double MaxStaleAge)
+{
+	if (IsOffSchedulerThread())
+	{
+		Worker->RunOnWorker([this, Directory, MaxStaleAge]()
+		{
+			SetResponseStoreDirectory(Directory, MaxStaleAge);
+		});
+
+		return;
+	}
+
+	ResponseStoreRoot = Directory;
+	ResponseStoreMaxStaleAge = MaxStaleAge;
+
+	if (ResponseStoreRoot.IsEmpty())
+	{
+		ResponseStore.Close();
+	}
+}
+
+void FHttpRetryScheduler::SetJournalDirectory(const FString& Directory)
+{
+	if (IsOffSchedulerThread())
+	{
+		Worker->RunOnWorker([this, Directory]()
+		{
+			SetJournalDirectory(Directory);
+		});
+
+		return;
+	}
+
+	JournalRoot = Directory;
+
+	if (JournalRoot.IsEmpty())
+	{
+		Journal.Close();
+	}
+}
+
+int32 FHttpRetryScheduler::GetPendingWriteCount() const
+{
+	if (IsOffSchedulerThread())
+	{
+		FScopeLock Lock(&StatsLock);
+
+		return PublishedStats.PendingWrites;
+	}
+
+	return Journal.Num();
+}
+
+FHttpMetrics& FHttpRetryScheduler::GetMetrics()
+{
+	return Metrics;
+}
+
+void FHttpRetryScheduler::SetMaxHedgesInFlight(int32 MaxInFlight)
+{
+	if (IsOffSchedulerThread())
+	{
+		Worker->RunOnWorker([this, MaxInFlight]()
+		{
+			SetMaxHedgesInFlight(MaxInFlight);
+		});
+
+		return;
+	}
+
+	MaxHedgesInFlight = FMath::Max(0, MaxInFlight);
+}
+
+void FHttpRetryScheduler::SetRequestFactory(const TFunction<FHttpRequestPtr()>& Factory)
+{
+	if (IsOffSchedulerThread())
+	{
+		Worker->RunOnWorker([this, Factory]()
+		{
+			SetRequestFactory(Factory);
+		});
+
+		return;
+	}
+
+	RequestFactory = Factory;
+}
+
+void FHttpRetryScheduler::SetWorker(FHttpWorker* HttpWorker)
+{
+	Worker = HttpWorker;
+}
+
+double FHttpRetryScheduler::GetInheritedDeadline() const
+{
+	return InheritedDeadline;
+}
+
+void FHttpRetryScheduler::SetMaxInFlight(EHttpRequestClass RequestClass, int32 MaxInFlight)
+{
+	if (IsOffSchedulerThread())
+	{
+		Worker->RunOnWorker([this, RequestClass, MaxInFlight]()
+		{
+			SetMaxInFlight(RequestClass, MaxInFlight);
+		});
+
+		return;
+	}
+
+	LaneMaxInFlight[static_cast<int32>(RequestClass)] = FMath::Max(1, MaxInFlight);
+	DispatchQueued();
+}
+
+void FHttpRetryScheduler::SetMaxInFlightPerService(int32 MaxInFlight)
+{
+	if (IsOffSchedulerThread())
+	{
+		Worker->RunOnWorker([this, MaxInFlight]()
+		{
+			SetMaxInFlightPerService(MaxInFlight);
+		});
+
+		return;
+	}
+
+	MaxInFlightPerService = FMath::Max(1, MaxInFlight);
+	DispatchQueued();
+}
+
+bool FHttpRetryScheduler::HasFreeSlot(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task) const
+{
+	const FServiceSlots* Slots = ServiceSlots.Find(Task->ServiceUrl);
+
+	return Slots == nullptr || 
+		(Slots->InFlight < MaxInFlightPerService && Slots->LaneInFlight[static_cast<int32>(Task->RequestClass)] < LaneMaxInFlight[static_cast<int32>(Task->RequestClass)]);
+}
+
+bool FHttpRetryScheduler::Dispatch(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task)
+{
+	int32 Lane = static_cast<int32>(Task->RequestClass);
+	FServiceSlots& Slots = ServiceSlots.FindOrAdd(Task->ServiceUrl);
+	Slots.InFlight++;
+	Slots.LaneInFlight[Lane]++;
+	LaneStats[Lane].InFlight++;
+	Metrics.InFlightRequests.Increment();
+	double CurrentTime = GetCurrentTime();
+	Task->bIsDispatched = true;
+	Task->DispatchTime = CurrentTime;
+	Task->AttemptCount++;
+	Task->DispatchCycles = FPlatformTime::Cycles64();
+	Task->FirstByteCycles.Reset();
+
+	if (Task->TraceId != 0 && Trace::IsEnabled())
+	{
+		Trace::Instant(TEXT("Http"), Task->AttemptCount == 1 ? TEXT("Dispatch") : TEXT("Retry"), Task->TraceId, FString::Printf(TEXT("attempt %d"), Task->AttemptCount));
+	}
+
+	double WaitTime = FMath::Max(0.0, CurrentTime - Task->RequestTime);
+	LaneStats[Lane].DispatchedCount++;
+	LaneStats[Lane].TotalWaitTime += WaitTime;
+	LaneStats[Lane].MaxWaitTime = FMath::Max(LaneStats[Lane].MaxWaitTime, WaitTime);
+
+	if (Task->AttemptCount == 1 && Task->Metrics.IsValid())
+	{
+		Task->Metrics->QueueWait.Record(static_cast<int64>(WaitTime * 1000000.0));
+	}
+
+	FRateLimitBucket* Bucket = RateLimitBuckets.Find(Task->EndpointTemplate);
+
+	if (Bucket != nullptr && Bucket->Capacity > 0.0)
+	{
+		Bucket->Tokens = FMath::Max(0.0, Bucket->Tokens - 1.0);
+	}
+
+	if (Task->ThrottledSince >= 0.0)
+	{
+		ThrottlingStats.TotalDelayTime += CurrentTime - Task->ThrottledSince;
+		Task->ThrottledSince = -1.0;
+	}
+
+	if (!Task->Request->ProcessRequest())
+	{
+		ReleaseSlot(Task);
+
+		return false;
+	}
+
+	// The request may have completed from inside ProcessRequest
+	if (Tasks.Contains(Task))
+	{
+		Task->ScheduleNextCheck(CurrentTime);
+
+		if (Task->Policy.bIsHedged && Task->AttemptCount == 1)
+		{
+			ArmHedge(Task);
+		}
+
+		ArmTimer(Task);
+	}
+
+	return true;
+}
+
+bool FHttpRetryScheduler::ReleaseSlot(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task)
+{
+	if (!Task->bIsDispatched)
+	{
+		return false;
+	}
+
+	int32 Lane = static_cast<int32>(Task->RequestClass);
+	Task->bIsDispatched = false;
+	LaneStats[Lane].InFlight--;
+	Metrics.InFlightRequests.Decrement();
+	FServiceSlots& Slots = ServiceSlots.FindChecked(Task->ServiceUrl);
+	Slots.InFlight--;
+	Slots.LaneInFlight[Lane]--;
+
+	if (Slots.InFlight == 0)
+	{
+		ServiceSlots.Remove(Task->ServiceUrl);
+	}
+
+	return true;
+}
+
+void FHttpRetryScheduler::DispatchQueued()
+{
+	// A dispatch can complete a request synchronously and free a slot, don't walk the queues recursively
+	if (bIsDispatchingQueue)
+	{
+		bIsDispatchQueuePending = true;
+
+		return;
+	}
+
+	bIsDispatchingQueue = true;
+	double CurrentTime = GetCurrentTime();
+
+	do
+	{
+		bIsDispatchQueuePending = false;
+
+		for (int32 Lane = 0; Lane < static_cast<int32>(EHttpRequestClass::Count); Lane++)
+		{
+			TArray<TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>>& Queue = LaneQueues[Lane];
+
+			for (int32 i = 0; i < Queue.Num();)
+			{
+				TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe> Task = Queue[i];
+				bool bIsExpired = CurrentTime >= Task->Deadline;
+				bool bIsRejected = !bIsExpired && !AdmitThroughCircuit(Task);
+
+				if (!bIsExpired && !bIsRejected && (!HasFreeSlot(Task) || IsThrottled(Task)))
+				{
+					i++;
+
+					continue;
+				}
+
+				Queue.RemoveAt(i);
+				LaneStats[Lane].QueueDepth--;
+				Metrics.QueuedRequests.Decrement();
+
+				if (bIsRejected)
+				{
+					Reject(Task);
+				}
+
+				if (bIsExpired || bIsRejected || !Dispatch(Task))
+				{
+					if (Tasks.Contains(Task))
+					{
+						CompleteTask(Task, CurrentTime);
+					}
+				}
+			}
+		}
+	} while (bIsDispatchQueuePending);
+
+	bIsDispatchingQueue = false;
+}
+
+bool FHttpRetryScheduler::IsThrottled(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task)
+{
+	FRateLimitBucket* Bucket = RateLimitBuckets.Find(Task->EndpointTemplate);
+
+	if (Bucket == nullptr)
+	{
+		return false;
+	}
+
+	double CurrentTime = GetCurrentTime();
+
+	if (Bucket->Capacity <= 0.0 && CurrentTime >= Bucket->BlockedUntil)
+	{
+		RateLimitBuckets.Remove(Task->EndpointTemplate);
+
+		return false;
+	}
+
+	if (Bucket->Capacity > 0.0)
+	{
+		Bucket->Tokens = FMath::Min(Bucket->Capacity, Bucket->Tokens + FMath::Max(0.0, CurrentTime - Bucket->LastRefillTime) * Bucket->RefillRate);
+		Bucket->LastRefillTime = CurrentTime;
+	}
+
+	bool bIsThrottled = CurrentTime < Bucket->BlockedUntil || (Bucket->Capacity > 0.0 && Bucket->Tokens < 1.0);
+
+	if (bIsThrottled && Task->ThrottledSince < 0.0)
+	{
+		Task->ThrottledSince = CurrentTime;
+		ThrottlingStats.DelayedRequests++;
+	}
+
+	return bIsThrottled;
+}
+
+void FHttpRetryScheduler::UpdateRateLimit(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime)
+{
+	FHttpResponsePtr Response = Task->Request->GetResponse();
+
+	if (!Response.IsValid())
+	{
+		return;
+	}
+
+	bool bIsRateLimited = Response->GetResponseCode() == static_cast<int32>(ErrorCodes::StatusTooManyRequests);
+	double RetryAfter = HttpRequest::GetRetryAfter(Response);
+	double Limit = 0.0;
+	double Remaining = 0.0;
+	bool bHasLimit = GetRateLimitHeader(Response, TEXT("Limit"), Limit) && GetRateLimitHeader(Response, TEXT("Remaining"), Remaining) && Limit > 0.0;
+
+	if (!bHasLimit && RetryAfter < 0.0 && !bIsRateLimited)
+	{
+		return;
+	}
+
+	FRateLimitBucket& Bucket = RateLimitBuckets.FindOrAdd(Task->EndpointTemplate);
+
+	if (bHasLimit)
+	{
+		double Reset = 0.0;
+		bool bHasReset = GetRateLimitHeader(Response, TEXT("Reset"), Reset);
+
+		// Some backends send the reset as a unix timestamp instead of a delta
+		if (bHasReset && Reset > 1000000000.0)
+		{
+			Reset -= FDateTime::UtcNow().ToUnixTimestamp();
+		}
+
+		Bucket.Capacity = Limit;
+		Bucket.Tokens = FMath::Clamp(Remaining, 0.0, Limit);
+		Bucket.RefillRate = (bHasReset && Reset > 0.0) ? (Limit - Bucket.Tokens) / Reset : Limit;
+		// Keep refilling even when no further response tells us the window moved
+		Bucket.RefillRate = FMath::Max(Bucket.RefillRate, Limit / FHttpRetryScheduler::TotalTimeout);
+		Bucket.LastRefillTime = CurrentTime;
+	}
+
+	if (RetryAfter < 0.0 && bIsRateLimited)
+	{
+		// No hint from the backend, back off like a failed attempt
+		RetryAfter = Task->NextDelay;
+		Task->ScheduleNextRetry(CurrentTime);
+	}
+
+	if (RetryAfter >= 0.0)
+	{
+		Bucket.BlockedUntil = FMath::Max(Bucket.BlockedUntil, CurrentTime + RetryAfter);
+	}
+}
+
+void FHttpRetryScheduler::Requeue(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task)
+{
+	// The slot is given back while the task waits, other endpoints of the service keep flowing
+	ReleaseSlot(Task);
+	int32 Lane = static_cast<int32>(Task->RequestClass);
+	LaneQueues[Lane].Insert(Task, 0);
+	LaneStats[Lane].QueueDepth++;
+	Metrics.QueuedRequests.Increment();
+}
+
+bool FHttpRetryScheduler::AdmitThroughCircuit(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task)
+{
+	if (Task->bIsProbe)
+	{
+		return true;
+	}
+
+	FCircuitBreaker* Breaker = CircuitBreakers.Find(Task->ServiceUrl);
+
+	if (Breaker == nullptr || Breaker->State == ECircuitState::Closed)
+	{
+		return true;
+	}
+
+	double CurrentTime = GetCurrentTime();
+
+	if (Breaker->bIsProbeInFlight || (Breaker->State == ECircuitState::Open && CurrentTime < Breaker->OpenUntil))
+	{
+		return false;
+	}
+
+	Breaker->bIsProbeInFlight = true;
+	Task->bIsProbe = true;
+
+	if (Breaker->State == ECircuitState::Open)
+	{
+		SetCircuitState(Task->ServiceUrl, *Breaker, ECircuitState::HalfOpen, CurrentTime);
+	}
+
+	return true;
+}
+
+void FHttpRetryScheduler::RecordOutcome(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime)
+{
+	bool bIsFailure = false;
+
+	switch (Task->Request->GetStatus())
+	{
+	case EHttpRequestStatus::Succeeded:
+		switch (Task->Request->GetResponse()->GetResponseCode())
+		{
+		case static_cast<int32>(ErrorCodes::StatusTooManyRequests): //the service is up, the rate limiter handles it
+			return;
+		case EHttpResponseCodes::ServerError:
+		case EHttpResponseCodes::BadGateway:
+		case EHttpResponseCodes::ServiceUnavail:
+		case EHttpResponseCodes::GatewayTimeout:
+			bIsFailure = true;
+
+			break;
+		default:
+			break;
+		}
+
+		break;
+	case EHttpRequestStatus::Failed:
+	case EHttpRequestStatus::Failed_ConnectionError:
+		bIsFailure = true;
+
+		break;
+	default:
+		return;
+	}
+
+	bool bIsSlow = CurrentTime - Task->DispatchTime >= CircuitBreakerConfig.SlowCallDuration;
+	FCircuitBreaker& Breaker = CircuitBreakers.FindOrAdd(Task->ServiceUrl);
+
+	if (Task->bIsProbe)
+	{
+		Task->bIsProbe = false;
+		Breaker.bIsProbeInFlight = false;
+
+		if (bIsFailure)
+		{
+			Breaker.OpenDuration = FMath::Min(Breaker.OpenDuration * 2, CircuitBreakerConfig.MaximumOpenDuration);
+			SetCircuitState(Task->ServiceUrl, Breaker, ECircuitState::Open, CurrentTime);
+		}
+		else
+		{
+			SetCircuitState(Task->ServiceUrl, Breaker, ECircuitState::Closed, CurrentTime);
+		}
+
+		return;
+	}
+
+	// Requests sent before the breaker opened don't count anymore
+	if (Breaker.State != ECircuitState::Closed)
+	{
+		return;
+	}
+
+	int32 ExpiredCount = 0;
+
+	while (ExpiredCount < Breaker.Outcomes.Num() && Breaker.Outcomes[ExpiredCount].Time < CurrentTime - CircuitBreakerConfig.Window)
+	{
+		ExpiredCount++;
+	}
+
+	Breaker.Outcomes.RemoveAt(0, ExpiredCount, false);
+	Breaker.Outcomes.Add(FCircuitBreaker::FOutcome{ CurrentTime, bIsFailure, bIsSlow });
+
+	if (Breaker.Outcomes.Num() < CircuitBreakerConfig.MinimumCalls)
+	{
+		return;
+	}
+
+	int32 FailureCount = 0;
+	int32 SlowCount = 0;
+
+	for (const auto& Outcome : Breaker.Outcomes)
+	{
+		FailureCount += Outcome.bIsFailure ? 1 : 0;
+		SlowCount += Outcome.bIsSlow ? 1 : 0;
+	}
+
+	if (FailureCount >= Breaker.Outcomes.Num() * CircuitBreakerConfig.FailureRateThreshold || SlowCount >= Breaker.Outcomes.Num() * CircuitBreakerConfig.SlowCallRateThreshold)
+	{
+		Breaker.OpenDuration = CircuitBreakerConfig.OpenDuration;
+		SetCircuitState(Task->ServiceUrl, Breaker, ECircuitState::Open, CurrentTime);
+	}
+}
+
+void FHttpRetryScheduler::SetCircuitState(const FString& ServiceUrl, FCircuitBreaker& Breaker, ECircuitState State, double CurrentTime)
+{
+	Breaker.State = State;
+	Breaker.Outcomes.Reset();
+
+	if (State == ECircuitState::Open)
+	{
+		Breaker.OpenUntil = CurrentTime + Breaker.OpenDuration;
+	}
+
+	// Handlers may send requests and add breakers, Breaker must not be used after this
+	if (Worker != nullptr && Worker->IsInWorkerThread())
+	{
+		Worker->RunOnGameThread([this, ServiceUrl, State]()
+		{
+			CircuitStateChanged.Broadcast(ServiceUrl, State);
+		});
+	}
+	else
+	{
+		CircuitStateChanged.Broadcast(ServiceUrl, State);
+	}
+}
+
+bool FHttpRetryScheduler::IsCircuitOpen(const FString& ServiceUrl) const
+{
+	const FCircuitBreaker* Breaker = CircuitBreakers.Find(ServiceUrl);
+
+	return Breaker != nullptr && Breaker->State == ECircuitState::Open;
+}
+
+void FHttpRetryScheduler::Reject(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task)
+{
+	FString Content = FString::Printf(TEXT("{\"numericErrorCode\":%d,\"errorCode\":\"circuit_open\",\"errorMessage\":\"%s\"}"), static_cast<int32>(ErrorCodes::ServiceCircuitOpen), *Task->ServiceUrl);
+	Task->LocalResponse = MakeShared<FHttpLocalResponse, ESPMode::ThreadSafe>(Task->Request->GetURL(), EHttpResponseCodes::ServiceUnavail, Content);
+}
+
+bool FHttpRetryScheduler::Park(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime)
+{
+	FString Authorization = Task->Request->GetHeader(TEXT("Authorization"));
+
+	if (Task->bIsReplayed || !Authorization.StartsWith(TEXT("Bearer ")) || ParkedTasks.Num() >= FHttpRetryScheduler::MaxParkedRequests)
+	{
+		return false;
+	}
+
+	ReleaseSlot(Task);
+	Task->ParkedToken = Authorization.Mid(7);
+	Task->ParkedSince = CurrentTime;
+	ParkedTasks.Add(Task);
+	Trace::Instant(TEXT("Http"), TEXT("Parked"), Task->TraceId);
+
+	return true;
+}
+
+void FHttpRetryScheduler::PollParkedTasks(double CurrentTime, Credentials& UserCredentials)
+{
+	const FString& UserToken = UserCredentials.GetUserAccessToken();
+	Credentials::ETokenState TokenState = UserCredentials.GetTokenState();
+	bool bCanRefresh = !UserToken.IsEmpty() && TokenState != Credentials::ETokenState::Invalid;
+
+	for (int32 i = 0; i < ParkedTasks.Num();)
+	{
+		TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe> Task = ParkedTasks[i];
+		bool bIsExpired = CurrentTime >= Task->ParkedSince + FHttpRetryScheduler::ParkTimeout || CurrentTime >= Task->Deadline;
+		// Client tokens are not refreshed by Credentials, there is nothing to wait for
+		bool bIsUserRequest = bCanRefresh && Task->ParkedToken != UserCredentials.GetClientAccessToken();
+		bool bIsTokenStale = Task->ParkedToken == UserToken || TokenState == Credentials::ETokenState::Refreshing;
+
+		if (!bIsExpired && bIsUserRequest && bIsTokenStale)
+		{
+			// Single flight: every request rejected with the same token waits for the same refresh
+			if (Task->ParkedToken == UserToken && TokenState == Credentials::ETokenState::Valid && RefreshRequestedToken != UserToken)
+			{
+				RefreshRequestedToken = UserToken;
+				ScheduleRefreshToken(UserCredentials, CurrentTime);
+			}
+
+			i++;
+
+			continue;
+		}
+
+		ParkedTasks.RemoveAt(i);
+		Task->ParkedSince = -1.0;
+
+		if (bIsExpired || !bIsUserRequest)
+		{
+			CompleteTask(Task, CurrentTime);
+
+			continue;
+		}
+
+		Task->Request->SetHeader(TEXT("Authorization"), TEXT("Bearer ") + UserToken);
+		Task->bIsReplayed = true;
+		Requeue(Task);
+	}
+}
+
+void FHttpRetryScheduler::RecordLatency(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime)
+{
+	FLatencyHistory& History = LatencyHistories.FindOrAdd(Task->EndpointTemplate);
+	float Latency = static_cast<float>(CurrentTime - Task->DispatchTime);
+
+	if (History.Samples.Num() < LatencyHistorySize)
+	{
+		History.Samples.Add(Latency);
+	}
+	else
+	{
+		History.Samples[History.Next] = Latency;
+	}
+
+	History.Next = (History.Next + 1) % LatencyHistorySize;
+}
+
+bool FHttpRetryScheduler::GetLatencyPercentile(const FString& EndpointTemplate, float Percentile, double& OutLatency) const
+{
+	const FLatencyHistory* History = LatencyHistories.Find(EndpointTemplate);
+
+	if (History == nullptr || History->Samples.Num() < MinimumLatencySamples)
+	{
+		return false;
+	}
+
+	TArray<float> Samples = History->Samples;
+	Samples.Sort();
+	OutLatency = Samples[FMath::Clamp(FMath::FloorToInt(Percentile * Samples.Num()), 0, Samples.Num() - 1)];
+
+	return true;
+}
+
+void FHttpRetryScheduler::ArmHedge(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task)
+{
+	if (Task->Request->GetVerb() != TEXT("GET"))
+	{
+		return;
+	}
+
+	HedgeTokens = FMath::Min(HedgeTokens + HedgeBudgetRatio, static_cast<double>(FMath::Max(1, MaxHedgesInFlight)));
+	double Latency;
+
+	if (GetLatencyPercentile(Task->EndpointTemplate, Task->Policy.HedgePercentile, Latency))
+	{
+		Task->HedgeTime = Task->DispatchTime + FMath::Max(Latency, MinimumHedgeDelay);
+		HedgeTimers.HeapPush(FHttpRetryTimer{ Task->HedgeTime, Task });
+	}
+}
+
+FHttpRequestPtr FHttpRetryScheduler::CopyRequest(const FHttpRequestPtr& Request)
+{
+	FHttpRequestPtr Copy = RequestFactory ? RequestFactory() : HttpTransport::CreateRequest();
+	Copy->SetVerb(Request->GetVerb());
+	Copy->SetURL(Request->GetURL());
+
+	for (const FString& Header : Request->GetAllHeaders())
+	{
+		FString Name;
+		FString Value;
+
+		if (Header.Split(TEXT(": "), &Name, &Value))
+		{
+			Copy->SetHeader(Name, Value);
+		}
+	}
+
+	return Copy;
+}
+
+void FHttpRetryScheduler::SendHedge(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task)
+{
+	FHttpRequestPtr Hedge = CopyRequest(Task->Request);
+	TWeakPtr<FHttpRetryTask, ESPMode::ThreadSafe> WeakTask = Task;
+	Hedge->OnProcessRequestComplete().BindLambda([this, WeakTask](FHttpRequestPtr, FHttpResponsePtr, bool)
+	{
+		double FinishedSeconds = FPlatformTime::Seconds();
+
+		RunOnSchedulerThread([this, WeakTask, FinishedSeconds]()
+		{
+			TSharedPtr<FHttpRetryTask, ESPMode::ThreadSafe> Task = WeakTask.Pin();
+
+			if (Task.IsValid() && Tasks.Contains(Task.ToSharedRef()))
+			{
+				OnHedgeFinished(Task.ToSharedRef(), FinishedSeconds + ClockOffset);
+			}
+		});
+	});
+
+	Task->HedgeRequest = Hedge;
+	HedgesInFlight++;
+	HedgeTokens -= 1.0;
+	HedgingStats.Sent++;
+	Trace::Instant(TEXT("Http"), TEXT("Hedge"), Task->TraceId);
+
+	if (!Hedge->ProcessRequest() && Task->HedgeRequest == Hedge)
+	{
+		Hedge->OnProcessRequestComplete().Unbind();
+		Task->HedgeRequest.Reset();
+		HedgesInFlight--;
+	}
+}
+
+void FHttpRetryScheduler::OnHedgeFinished(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime)
+{
+	FHttpRequestPtr Hedge = Task->HedgeRequest;
+
+	if (!Hedge.IsValid() || Hedge->GetStatus() == EHttpRequestStatus::Processing)
+	{
+		return;
+	}
+
+	Task->HedgeRequest.Reset();
+	HedgesInFlight--;
+	FHttpResponsePtr Response = Hedge->GetResponse();
+
+	// A failed copy changes nothing, the original request still decides
+	if (Hedge->GetStatus() != EHttpRequestStatus::Succeeded || !Response.IsValid() || !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+	{
+		return;
+	}
+
+	HedgingStats.Won++;
+	// The original took at least this long, leaving it out would keep the hedge delay at the latency of the fast requests
+	RecordLatency(Task, CurrentTime);
+	Task->Request->OnProcessRequestComplete().Unbind();
+	Task->Request->CancelRequest();
+	Task->HedgeResponseBytes = Response->GetContentLength();
+	Task->LocalResponse = HttpCompression::Decompress(Response);
+	CompleteTask(Task, CurrentTime);
+}
+
+void FHttpRetryScheduler::CancelHedge(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task)
+{
+	FHttpRequestPtr Hedge = Task->HedgeRequest;
+	Task->HedgeRequest.Reset();
+	HedgesInFlight--;
+	HedgingStats.Cancelled++;
+	Hedge->OnProcessRequestComplete().Unbind();
+	Hedge->CancelRequest();
+}
+
+bool FHttpRetryScheduler::ServeFromCache(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, const FString& CacheKey, double RequestTime)
+{
+	FCachedResponse* Cached = ResponseCache.Find(CacheKey);
+
+	// Requests that carry their own validators want the backend's answer
+	if (Cached == nullptr || RequestTime >= Cached->StaleUntil || bIsRevalidating
+		|| !Request->GetHeader(TEXT("If-None-Match")).IsEmpty() || !Request->GetHeader(TEXT("If-Modified-Since")).IsEmpty())
+	{
+		return false;
+	}
+
+	TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe> Task = MakeShared<FHttpRetryTask, ESPMode::ThreadSafe>(Request, CompleteDelegate, RequestTime, FHttpRetryPolicy());
+	Task->CacheKey = CacheKey;
+	Task->bIsServedFromCache = true;
+	Task->LocalResponse = Cached->Response;
+	Cached->LastUsed = RequestTime;
+	Tasks.Add(Task);
+	Trace::Instant(TEXT("Http"), TEXT("CacheHit"), 0, CacheKey);
+	LocalTasks.Add(Task);
+
+	if (RequestTime < Cached->FreshUntil)
+	{
+		ResponseCacheStats.Hits++;
+	}
+	else
+	{
+		ResponseCacheStats.StaleHits++;
+		Revalidate(Request, *Cached, RequestTime);
+	}
+
+	return true;
+}
+
+void FHttpRetryScheduler::Revalidate(const FHttpRequestPtr& Request, const FCachedResponse& Cached, double RequestTime)
+{
+	FHttpRequestPtr Revalidation = CopyRequest(Request);
+	HttpRequest::SetValidators(Revalidation, Cached.ETag, Cached.LastModified);
+	TGuardValue<bool> RevalidatingGuard(bIsRevalidating, true);
+
+	// Nobody waits for it, it only refreshes the entry; a revalidation already in flight is joined
+	ProcessRequest(Revalidation, FHttpRequestCompleteDelegate(), RequestTime, EHttpRequestClass::Background);
+}
+
+void FHttpRetryScheduler::UpdateResponseCache(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, FHttpResponsePtr& Response, double CurrentTime)
+{
+	int32 ResponseCode = Response->GetResponseCode();
+
+	if (ResponseCode == EHttpResponseCodes::NotModified && Task->ValidatedResponse.IsValid())
+	{
+		ResponseCacheStats.Revalidations++;
+		FHttpResponsePtr NotModified = Response;
+		// The handlers get the body the validators were taken from
+		Response = Task->ValidatedResponse;
+		FCachedResponse* Cached = ResponseCache.Find(Task->CacheKey);
+
+		if (Cached == nullptr || Cached->Response != Response)
+		{
+			// Evicted or replaced while the request was in flight
+			return;
+		}
+
+		double MaxAge;
+		double StaleWhileRevalidate;
+
+		if (!HttpRequest::GetCacheLifetime(NotModified, MaxAge, StaleWhileRevalidate))
+		{
+			ResponseCacheStats.Size -= Cached->Size;
+			ResponseCache.Remove(Task->CacheKey);
+			ResponseStore.Remove(GetStoreKey(Task->Request));
+
+			return;
+		}
+
+		Cached->FreshUntil = CurrentTime + MaxAge;
+		Cached->StaleUntil = Cached->FreshUntil + StaleWhileRevalidate;
+		Cached->LastUsed = CurrentTime;
+		FDateTime Now = FDateTime::UtcNow();
+		ResponseStore.Touch(GetStoreKey(Task->Request), Now + FTimespan::FromSeconds(MaxAge), Now + FTimespan::FromSeconds(MaxAge + StaleWhileRevalidate));
+
+		return;
+	}
+
+	if (ResponseCode != EHttpResponseCodes::Ok)
+	{
+		return;
+	}
+
+	ResponseCacheStats.Misses++;
+
+	if (FCachedResponse* Previous = ResponseCache.Find(Task->CacheKey))
+	{
+		ResponseCacheStats.Size -= Previous->Size;
+		ResponseCache.Remove(Task->CacheKey);
+	}
+
+	FCachedResponse Cached;
+	Cached.ETag = Response->GetHeader(TEXT("ETag"));
+	Cached.LastModified = Response->GetHeader(TEXT("Last-Modified"));
+	double MaxAge;
+	double StaleWhileRevalidate;
+
+	FString StoreKey = GetStoreKey(Task->Request);
+
+	if (!HttpRequest::GetCacheLifetime(Response, MaxAge, StaleWhileRevalidate) || (MaxAge <= 0.0 && Cached.ETag.IsEmpty() && Cached.LastModified.IsEmpty()))
+	{
+		ResponseStore.Remove(StoreKey);
+
+		return;
+	}
+
+	Cached.Size = Response->GetContentLength();
+
+	if (Cached.Size > ResponseCacheBudget)
+	{
+		ResponseStore.Remove(StoreKey);
+
+		return;
+	}
+
+	Cached.Url = Task->Request->GetURL();
+	Cached.Response = Response;
+	Cached.FreshUntil = CurrentTime + MaxAge;
+	Cached.StaleUntil = Cached.FreshUntil + StaleWhileRevalidate;
+	Cached.LastUsed = CurrentTime;
+	ResponseCacheStats.Size += Cached.Size;
+	ResponseCache.Add(Task->CacheKey, MoveTemp(Cached));
+	TrimResponseCache();
+
+	if (ResponseStore.IsOpen())
+	{
+		FDateTime Now = FDateTime::UtcNow();
+		ResponseStore.Write(StoreKey, Task->Request->GetURL(), Response, Now + FTimespan::FromSeconds(MaxAge), Now + FTimespan::FromSeconds(MaxAge + StaleWhileRevalidate));
+		ResponseStore.Trim(ResponseCacheBudget);
+	}
+}
+
+void FHttpRetryScheduler::InvalidateResponseCache(const FString& Path)
+{
+	for (auto It = ResponseCache.CreateIterator(); It; ++It)
+	{
+		if (HttpRequest::IsUnderPath(It.Value().Url, Path))
+		{
+			ResponseCacheStats.Size -= It.Value().Size;
+			It.RemoveCurrent();
+		}
+	}
+
+	ResponseStore.RemoveIf([&Path](const FHttpResponseStore::FEntry& Entry)
+	{
+		return HttpRequest::IsUnderPath(Entry.Url, Path);
+	});
+}
+
+void FHttpRetryScheduler::TrimResponseCache()
+{
+	if (ResponseCacheStats.Size <= ResponseCacheBudget)
+	{
+		return;
+	}
+
+	// Sorted once, least recently used first, instead of searching the oldest entry for every eviction
+	TArray<TPair<double, FString>> ByLastUse;
+	ByLastUse.Reserve(ResponseCache.Num());
+
+	for (const auto& Cached : ResponseCache)
+	{
+		ByLastUse.Emplace(Cached.Value.LastUsed, Cached.Key);
+	}
+
+	ByLastUse.Sort([](const TPair<double, FString>& A, const TPair<double, FString>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	for (int32 i = 0; i < ByLastUse.Num() && ResponseCacheStats.Size > ResponseCacheBudget; i++)
+	{
+		ResponseCacheStats.Size -= ResponseCache.FindChecked(ByLastUse[i].Value).Size;
+		ResponseCache.Remove(ByLastUse[i].Value);
+	}
 }
 
-FHttpRetryScheduler::FHttpRetryTask::FHttpRetryTask(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, double NextDelay)
-	: Request(Request)
-	, CompleteDelegate(CompleteDelegate)
-	, RequestTime(RequestTime)
-	, NextDelay(NextDelay)
-	, NextRetryTime(RequestTime + NextDelay)
+FString FHttpRetryScheduler::GetStoreKey(const FHttpRequestPtr& Request)
 {
+	// Partitions are per user, the token of the session that stored a response does not matter
+	return FString::Printf(TEXT("%s\n%s"), *Request->GetURL(), *Request->GetHeader(TEXT("Accept")));
 }
 
-bool FHttpRetryScheduler::ProcessRequest(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime)
+void FHttpRetryScheduler::RestoreResponse(const FHttpRequestPtr& Request, const FString& CacheKey, double RequestTime)
 {
-	bool bIsStarted = Request->ProcessRequest();
+	FString StoreKey = GetStoreKey(Request);
+	const FHttpResponseStore::FEntry* Entry = ResponseStore.Find(StoreKey);
+
+	if (Entry == nullptr)
+	{
+		return;
+	}
+
+	FDateTime Now = FDateTime::UtcNow();
+	double FreshFor = (Entry->FreshUntil - Now).GetTotalSeconds();
+	double StaleFor = (Entry->StaleUntil - Now).GetTotalSeconds();
+	FHttpResponsePtr Response = ResponseStore.Read(StoreKey);
+
+	if (!Response.IsValid())
+	{
+		return;
+	}
 
-	if (bIsStarted)
+	// Shown on the first frames of a new session while it is revalidated; an older one still saves the download with its validators
+	if (FreshFor > -ResponseStoreMaxStaleAge)
 	{
-		RetryList.Add(MakeShared<FHttpRetryTask>(Request, CompleteDelegate, RequestTime, InitialDelay));
+		StaleFor = FMath::Max(StaleFor, 1.0);
 	}
 
-	return bIsStarted;
+	FCachedResponse Cached;
+	Cached.Url = Request->GetURL();
+	Cached.Response = Response;
+	Cached.ETag = Response->GetHeader(TEXT("ETag"));
+	Cached.LastModified = Response->GetHeader(TEXT("Last-Modified"));
+	Cached.FreshUntil = RequestTime + FreshFor;
+	Cached.StaleUntil = RequestTime + StaleFor;
+	Cached.LastUsed = RequestTime;
+	Cached.Size = Response->GetContentLength();
+	ResponseCacheStats.Restored++;
+	ResponseCacheStats.Size += Cached.Size;
+	ResponseCache.Add(CacheKey, MoveTemp(Cached));
+	TrimResponseCache();
 }
 
-bool FHttpRetryScheduler::PollRetry(double CurrentTime, Credentials& UserCredentials)
+void FHttpRetryScheduler::PollResponseStore(double CurrentTime, const Credentials& UserCredentials)
 {
-	if (RetryList.Num() == 0)
+	FString Partition;
+
+	if (!UserCredentials.GetUserId().IsEmpty())
 	{
-		return false;
+		Partition = FHttpResponseStore::GetPartitionDirectory(ResponseStoreRoot, UserCredentials.GetUserNamespace(), UserCredentials.GetUserId());
+	}
+
+	if (Partition != ResponseStore.GetDirectory())
+	{
+		// Responses of another user are never read from this partition, they are only kept until it is opened again
+		ResponseStore.Open(Partition);
 	}
+	else if (CurrentTime >= ResponseStoreFlushTime)
+	{
+		ResponseStore.Flush();
+		ResponseStoreFlushTime = CurrentTime + 5.0;
+	}
+}
 
-	TArray<TSharedRef<FHttpRetryTask>> CompletedTasks;
+void FHttpRetryScheduler::UpdateJournal(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, const FHttpResponsePtr& Response, double CurrentTime)
+{
+	// Only an answer of the backend settles a write; it is replayed after local rejections, lost connections, throttling, unavailable services and rejected tokens
+	bool bIsReached = !Task->LocalResponse.IsValid() && Task->Request->GetStatus() == EHttpRequestStatus::Succeeded && Response.IsValid();
+	int32 ResponseCode = bIsReached ? Response->GetResponseCode() : 0;
+	bool bIsSettled = bIsReached && ResponseCode != static_cast<int32>(ErrorCodes::StatusTooManyRequests) && ResponseCode != EHttpResponseCodes::Denied && !Task->Policy.RetryableStatuses.Contains(ResponseCode);
 
-	RetryList.RemoveAll([CurrentTime, &UserCredentials, &CompletedTasks](const TSharedRef<FHttpRetryTask>& CurrentTask)
+	if (Task->JournalSequence != 0 && Task->JournalPath == Journal.GetPath())
 	{
-		if (!CurrentTask->Request.IsValid())
+		if (bIsSettled)
 		{
-			return true;
+			Journal.Complete(Task->JournalSequence);
+		}
+		else
+		{
+			Journal.Release(Task->JournalSequence, bIsReached);
+		}
+	}
+
+	if (Task->bIsJournalReplay)
+	{
+		bIsReplayInFlight = false;
+
+		if (!bIsSettled)
+		{
+			NextReplayTime = CurrentTime + ReplayDelay;
+			ReplayDelay = FMath::Min(ReplayDelay * 2.0, static_cast<double>(MaximumDelay));
+
+			return;
+		}
+	}
+
+	if (bIsReached && ResponseCode < EHttpResponseCodes::ServerError)
+	{
+		// The backend is reachable again, what is left in the journal goes out without waiting for the backoff
+		NextReplayTime = CurrentTime;
+		ReplayDelay = InitialDelay;
+	}
+	else if (Task->JournalSequence != 0 && !bIsReplayInFlight)
+	{
+		NextReplayTime = FMath::Max(NextReplayTime, CurrentTime + ReplayDelay);
+	}
+}
+
+void FHttpRetryScheduler::PollJournal(double CurrentTime, const Credentials& UserCredentials)
+{
+	FString Path;
+
+	if (!UserCredentials.GetUserId().IsEmpty())
+	{
+		Path = FHttpResponseStore::GetPartitionDirectory(JournalRoot, UserCredentials.GetUserNamespace(), UserCredentials.GetUserId()) / TEXT("journal.bin");
+	}
+
+	if (Path != Journal.GetPath())
+	{
+		// Writes of another user wait in their own file until that user logs in again
+		Journal.Open(Path);
+		bIsReplayInFlight = false;
+		NextReplayTime = CurrentTime;
+		ReplayDelay = InitialDelay;
+	}
+
+	if (!bIsReplayInFlight && CurrentTime >= NextReplayTime && Journal.Num() > 0)
+	{
+		ReplayNextWrite(CurrentTime, UserCredentials);
+	}
+}
+
+void FHttpRetryScheduler::ReplayNextWrite(double CurrentTime, const Credentials& UserCredentials)
+{
+	FHttpJournal::FEntry* Entry = Journal.GetNextReplay();
+
+	if (Entry == nullptr || UserCredentials.GetUserAccessToken().IsEmpty())
+	{
+		return;
+	}
+
+	FHttpRequestPtr Request = RequestFactory ? RequestFactory() : HttpTransport::CreateRequest();
+	Request->SetVerb(Entry->Verb);
+	Request->SetURL(Entry->Url);
+
+	for (const FString& Header : Entry->Headers)
+	{
+		FString Name;
+		FString Value;
+
+		if (Header.Split(TEXT(": "), &Name, &Value))
+		{
+			Request->SetHeader(Name, Value);
+		}
+	}
+
+	// Signed with the token of the session it is replayed in
+	Request->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *UserCredentials.GetUserAccessToken()));
+	Request->SetContent(Entry->Content);
+
+	int64 Sequence = Entry->Sequence;
+	Entry->bIsInFlight = true;
+	bIsReplayInFlight = true;
+	bool bIsSent = false;
+
+	{
+		// The caller of the write got its failure long ago, only the journal hears about the replay
+		TGuardValue<int64> ReplayGuard(ReplayingSequence, Sequence);
+		FHttpRetryPolicy Policy = FHttpRetryPolicy::Background();
+		Policy.Timeout = TotalTimeout;
+		bIsSent = ProcessRequest(Request, FHttpRequestCompleteDelegate(), CurrentTime, EHttpRequestClass::Background, Policy);
+	}
+
+	if (!bIsSent)
+	{
+		Journal.Release(Sequence);
+		bIsReplayInFlight = false;
+		NextReplayTime = CurrentTime + ReplayDelay;
+		ReplayDelay = FMath::Min(ReplayDelay * 2.0, static_cast<double>(MaximumDelay));
+	}
+}
+
+void FHttpRetryScheduler::RecordMetrics(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime)
+{
+	FHttpEndpointMetrics& Endpoint = *Task->Metrics;
+	Endpoint.Latency.Record(static_cast<int64>(FMath::Max(0.0, CurrentTime - Task->RequestTime) * 1000000.0));
+	Endpoint.Attempts.Record(Task->AttemptCount);
+	Endpoint.RequestBytes.Record(Task->Request->GetContentLength());
+
+	if (Task->FirstByteCycles.GetValue() != 0)
+	{
+		uint64 Cycles = static_cast<uint64>(Task->FirstByteCycles.GetValue()) - Task->DispatchCycles;
+		Endpoint.TimeToFirstByte.Record(static_cast<int64>(Cycles * FPlatformTime::GetSecondsPerCycle64() * 1000000.0));
+	}
+
+	FHttpResponsePtr Response = Task->LocalResponse.IsValid() ? Task->LocalResponse : Task->Request->GetResponse();
+	EHttpFailureReason Reason = EHttpFailureReason::None;
+
+	if (Task->AttemptCount == 0)
+	{
+		// Answered locally: rejected by an open breaker, or out of time before leaving the queue
+		Reason = Task->LocalResponse.IsValid() ? EHttpFailureReason::CircuitOpen : EHttpFailureReason::Expired;
+	}
+	else if (Task->LocalResponse.IsValid() || Task->Request->GetStatus() == EHttpRequestStatus::Succeeded)
+	{
+		int32 ResponseCode = Response.IsValid() ? Response->GetResponseCode() : 0;
+		// Bytes as they came over the wire, a winning hedge's LocalResponse was already decoded
+		int32 ResponseBytes = (Task->HedgeResponseBytes >= 0) ? Task->HedgeResponseBytes : (Response.IsValid() ? Response->GetContentLength() : 0);
+		Endpoint.ResponseBytes.Record(ResponseBytes);
+
+		if (ResponseCode == static_cast<int32>(ErrorCodes::StatusTooManyRequests))
+		{
+			Reason = EHttpFailureReason::RateLimited;
+		}
+		else if (ResponseCode >= EHttpResponseCodes::ServerError)
+		{
+			Reason = EHttpFailureReason::ServerError;
+		}
+		else if (ResponseCode >= EHttpResponseCodes::BadRequest)
+		{
+			Reason = EHttpFailureReason::ClientError;
+		}
+	}
+	else
+	{
+		Reason = Task->Request->GetStatus() == EHttpRequestStatus::Failed_ConnectionError ? EHttpFailureReason::ConnectionError : EHttpFailureReason::Timeout;
+	}
+
+	Endpoint.Failures[static_cast<int32>(Reason)].Increment();
+}
+
+void FHttpRetryScheduler::RunOnSchedulerThread(TFunction<void()> Function)
+{
+	if (Worker != nullptr)
+	{
+		Worker->RunOnWorker(MoveTemp(Function));
+
+		return;
+	}
+
+	Function();
+}
+
+double FHttpRetryScheduler::GetCurrentTime() const
+{
+	return FPlatformTime::Seconds() + ClockOffset;
+}
+
+bool FHttpRetryScheduler::IsOffSchedulerThread() const
+{
+	return Worker != nullptr && Worker->IsRunning() && !Worker->IsInWorkerThread();
+}
+
+void FHttpRetryScheduler::PublishStats()
+{
+	// Nobody else reads the scheduler while it runs on the calling thread
+	if (Worker == nullptr || !Worker->IsInWorkerThread())
+	{
+		return;
+	}
+
+	FStatsSnapshot Stats;
+	Stats.TaskCount = GetTaskCount();
+	Stats.Coalescing = CoalescingStats;
+	FMemory::Memcpy(Stats.Lanes, LaneStats, sizeof(LaneStats));
+	Stats.Throttling = GetThrottlingStats();
+	Stats.Hedging = HedgingStats;
+	Stats.ResponseCache = GetResponseCacheStats();
+	Stats.PendingWrites = Journal.Num();
+
+	for (const auto& Breaker : CircuitBreakers)
+	{
+		if (Breaker.Value.State != ECircuitState::Closed)
+		{
+			Stats.CircuitStates.Add(Breaker.Key, Breaker.Value.State);
+		}
+	}
+
+	FScopeLock Lock(&StatsLock);
+	PublishedStats = MoveTemp(Stats);
+}
+
+void FHttpRetryScheduler::ScheduleRefreshToken(Credentials& UserCredentials, double CurrentTime)
+{
+	// The worker polls with a copy of the credentials, the refresh itself belongs to the game thread
+	if (Worker != nullptr && Worker->IsInWorkerThread())
+	{
+		Worker->ScheduleRefreshToken(CurrentTime);
+
+		return;
+	}
+
+	UserCredentials.ScheduleRefreshToken(CurrentTime);
+}
+
+FString FHttpRetryScheduler::GetCoalescingKey(const FHttpRequestPtr& Request)
+{
+	// Only reads without a body can share a response; the caller's identity and accepted format are part of the key
+	if (Request->GetVerb() != TEXT("GET") || Request->GetContentLength() != 0)
+	{
+		return FString();
+	}
+
+	return FString::Printf(TEXT("%s\n%s\n%s"), *Request->GetURL(), *Request->GetHeader(TEXT("Authorization")), *Request->GetHeader(TEXT("Accept")));
+}
+
+void FHttpRetryScheduler::ArmTimer(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task)
+{
+	RetryTimers.HeapPush(FHttpRetryTimer{ Task->NextRetryTime, Task });
+}
+
+void FHttpRetryScheduler::OnTimerExpired(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime)
+{
+	if (Task->bIsRetryPending)
+	{
+		Task->bIsRetryPending = false;
+		// Every attempt is admitted like the first one: circuit, lane and service caps, rate limits
+		ReleaseSlot(Task);
+
+		if (!AdmitThroughCircuit(Task))
+		{
+			Reject(Task);
+			CompleteTask(Task, CurrentTime);
+		}
+		else if (!HasFreeSlot(Task) || IsThrottled(Task))
+		{
+			Requeue(Task);
+		}
+		else if (!Dispatch(Task) && Tasks.Contains(Task))
+		{
+			CompleteTask(Task, CurrentTime);
+		}
+
+		return;
+	}
+
+	if (Task->Request->GetStatus() != EHttpRequestStatus::Processing)
+	{
+		// Request finished without calling back
+		OnRequestFinished(Task, CurrentTime);
+
+		return;
+	}
+
+	// A write without a key may still be processed by the backend, it is waited for instead of being sent twice
+	bool bIsAttemptTimedOut = Task->Policy.AttemptTimeout > 0.0 && HttpRequest::IsRetrySafe(Task->Request) && CurrentTime >= Task->DispatchTime + Task->Policy.AttemptTimeout;
+
+	if (CurrentTime >= Task->Deadline || (bIsAttemptTimedOut && !Task->CanRetry(CurrentTime)))
+	{
+		// Cancellation is reported through the completion callback, the timer only checks that it really happened
+		Task->Request->CancelRequest();
+		Task->NextRetryTime = CurrentTime + FHttpRetryScheduler::InitialDelay;
+	}
+	else if (bIsAttemptTimedOut)
+	{
+		// The cancelled attempt comes back as a failed request, which is then sent again
+		Task->bIsAttemptTimedOut = true;
+		Task->Request->CancelRequest();
+
+		if (Task->bIsRetryPending || !Tasks.Contains(Task))
+		{
+			return;
+		}
+
+		Task->NextRetryTime = CurrentTime + FHttpRetryScheduler::InitialDelay;
+	}
+	else
+	{
+		Task->ScheduleNextCheck(CurrentTime);
+	}
+
+	ArmTimer(Task);
+}
+
+void FHttpRetryScheduler::OnRequestFinished(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime)
+{
+	switch (Task->Request->GetStatus())
+	{
+	case EHttpRequestStatus::Processing: //already re-sent
+		return;
+	case EHttpRequestStatus::Succeeded: //got response
+		RecordOutcome(Task, CurrentTime);
+		UpdateRateLimit(Task, CurrentTime);
+
+		if (Task->Policy.bIsHedged && Task->AttemptCount == 1)
+		{
+			RecordLatency(Task, CurrentTime);
 		}
 
-		switch (CurrentTask->Request->GetStatus())
+		switch (Task->Request->GetResponse()->GetResponseCode())
 		{
-		case EHttpRequestStatus::Processing:
-			if (CurrentTime >= CurrentTask->RequestTime + FHttpRetryScheduler::TotalTimeout)
+		case static_cast<int32>(ErrorCodes::StatusTooManyRequests):
+			ThrottlingStats.RateLimitedResponses++;
+
+			if (Task->CanRetry(CurrentTime))
 			{
-				CurrentTask->Request->CancelRequest();
+				// Sent again by the queue once the endpoint's bucket allows it
+				Requeue(Task);
+
+				return;
 			}
-			else if (CurrentTime >= CurrentTask->NextRetryTime)
+
+			break;
+		case EHttpResponseCodes::Denied:
+		case EHttpResponseCodes::Forbidden:
+			// Requests signed with a user token wait for the refreshed token and are replayed once
+			if (CurrentTime < Task->Deadline && Park(Task, CurrentTime))
 			{
-				CurrentTask->ScheduleNextRetry(CurrentTime);
+				return;
 			}
 
-			return false;
-		case EHttpRequestStatus::Succeeded: //got response
-			switch (CurrentTask->Request->GetResponse()->GetResponseCode())
+			if (Task->Request->GetResponse()->GetResponseCode() == EHttpResponseCodes::Forbidden)
 			{
-			case EHttpResponseCodes::ServerError:
-			case EHttpResponseCodes::BadGateway:
-			case EHttpResponseCodes::ServiceUnavail:
-			case EHttpResponseCodes::GatewayTimeout:
-				CurrentTask->ScheduleNextRetry(CurrentTime);
-				CurrentTask->Request->ProcessRequest();
+				bIsRefreshTokenRequested = true;
+			}
 
-				return false;
-			case EHttpResponseCodes::Forbidden:
-				UserCredentials.ScheduleRefreshToken(CurrentTime);
-				CompletedTasks.Add(CurrentTask);
+			break;
+		default:
+			if (Task->Policy.RetryableStatuses.Contains(Task->Request->GetResponse()->GetResponseCode()) && Task->CanRetry(CurrentTime) && !IsCircuitOpen(Task->ServiceUrl) && HttpRequest::IsRetrySafe(Task->Request))
+			{
+				// An unavailable service that sent Retry-After is waited for like a 429
+				if (IsThrottled(Task))
+				{
+					Requeue(Task);
 
-				return true;
-			default:
-				CompletedTasks.Add(CurrentTask);
+					return;
+				}
 
-				return true;
+				if (DeferRetry(Task, CurrentTime))
+				{
+					return;
+				}
 			}
-		case EHttpRequestStatus::Failed: //request cancelled
-		case EHttpRequestStatus::Failed_ConnectionError: //network error
-		case EHttpRequestStatus::NotStarted:
-			CompletedTasks.Add(CurrentTask);
 
-			return true;
+			break;
 		}
 
-		return false;
-	});
+		break;
+	case EHttpRequestStatus::Failed: //request cancelled
+	case EHttpRequestStatus::Failed_ConnectionError: //network error
+		RecordOutcome(Task, CurrentTime);
+
+		if (Task->bIsAttemptTimedOut)
+		{
+			Task->bIsAttemptTimedOut = false;
+
+			if (Task->CanRetry(CurrentTime) && !IsCircuitOpen(Task->ServiceUrl) && DeferRetry(Task, CurrentTime))
+			{
+				return;
+			}
+		}
+
+		break;
+	case EHttpRequestStatus::NotStarted:
+		break;
+	}
+
+	CompleteTask(Task, CurrentTime);
+}
+
+bool FHttpRetryScheduler::DeferRetry(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime)
+{
+	Task->ScheduleNextRetry(CurrentTime);
 
-	for (const auto& Task : CompletedTasks)
+	// Nothing is gained by an attempt that would start at the deadline, the caller gets this one's outcome
+	if (Task->NextRetryTime >= Task->Deadline)
 	{
-		Task->CompleteDelegate.ExecuteIfBound(Task->Request, Task->Request->GetResponse(), Task->Request->GetResponse().IsValid());
+		return false;
 	}
 
+	// Re-sent by the poll the backoff delay ends in, never from inside the request's own completion callback
+	Task->bIsRetryPending = true;
+	ArmTimer(Task);
+
 	return true;
 }
 
+void FHttpRetryScheduler::CompleteTask(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime)
+{
+	Tasks.Remove(Task);
+
+	if (!Task->CoalescingKey.IsEmpty())
+	{
+		InFlightGets.Remove(Task->CoalescingKey);
+	}
+
+	int32 Lane = static_cast<int32>(Task->RequestClass);
+
+	if (ReleaseSlot(Task))
+	{
+		DispatchQueued();
+	}
+	else if (LaneQueues[Lane].Remove(Task) > 0)
+	{
+		LaneStats[Lane].QueueDepth--;
+		Metrics.QueuedRequests.Decrement();
+	}
+
+	if (Task->HedgeRequest.IsValid())
+	{
+		CancelHedge(Task);
+	}
+
+	if (Task->bIsProbe)
+	{
+		// The probe ended without an outcome (e.g. expired in its queue), the next request probes instead
+		Task->bIsProbe = false;
+		FCircuitBreaker* Breaker = CircuitBreakers.Find(Task->ServiceUrl);
+
+		if (Breaker != nullptr)
+		{
+			Breaker->bIsProbeInFlight = false;
+		}
+	}
+
+	FHttpResponsePtr Response = Task->LocalResponse.IsValid() ? Task->LocalResponse : HttpCompression::Decompress(Task->Request->GetResponse());
+	TSharedPtr<FHttpDecodedResults, ESPMode::ThreadSafe> CachedResults;
+
+	if (Response.IsValid() && !Task->CacheKey.IsEmpty())
+	{
+		if (!Task->bIsServedFromCache)
+		{
+			UpdateResponseCache(Task, Response, CurrentTime);
+		}
+
+		// Handlers of a cached response get the results decoded for it the first time
+		const FCachedResponse* Cached = ResponseCache.Find(Task->CacheKey);
+
+		if (Cached != nullptr && Cached->Response == Response)
+		{
+			CachedResults = Cached->Results;
+		}
+	}
+	else if (Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()) && Task->Request->GetVerb() != TEXT("GET") && (ResponseCache.Num() > 0 || ResponseStore.IsOpen()))
+	{
+		// A write changes its resource and what lists or embeds it, e.g. PUT .../slots/{id} the slot list, not the rest of the service
+		InvalidateResponseCache(HttpRequest::GetParentPath(Task->Request->GetURL()));
+	}
+
+	if (Task->JournalSequence != 0 || Journal.Num() > 0)
+	{
+		UpdateJournal(Task, Response, CurrentTime);
+	}
+
+	if (Task->Metrics.IsValid() && !Task->bIsServedFromCache)
+	{
+		RecordMetrics(Task, CurrentTime);
+	}
+
+	if (Task->TraceId != 0 && Trace::IsEnabled())
+	{
+		Trace::End(TEXT("Http"), TEXT("Request"), Task->TraceId, Response.IsValid() ? FString::FromInt(Response->GetResponseCode()) : FString(TEXT("no response")));
+	}
+
+	// Delegates run where the scheduler runs, see ProcessRequest
+	checkSlow(!IsOffSchedulerThread());
+
+	// Follow-up requests sent from the delegates share what is left of this request's deadline
+	double PreviousDeadline = InheritedDeadline;
+	InheritedDeadline = Task->Deadline;
+
+	if (Task->JoinedDelegates.Num() == 0 && !CachedResults.IsValid())
+	{
+		Task->CompleteDelegate.ExecuteIfBound(Task->Request, Response, Response.IsValid());
+	}
+	else
+	{
+		FHttpResultFanOut FanOut(Response, CachedResults.IsValid() ? CachedResults.ToSharedRef() : MakeShared<FHttpDecodedResults, ESPMode::ThreadSafe>());
+		Task->CompleteDelegate.ExecuteIfBound(Task->Request, Response, Response.IsValid());
+
+		for (const auto& JoinedDelegate : Task->JoinedDelegates)
+		{
+			JoinedDelegate.ExecuteIfBound(Task->Request, Response, Response.IsValid());
+		}
+	}
+
+	InheritedDeadline = PreviousDeadline;
+}
+
 void FHttpRetryScheduler::FHttpRetryTask::ScheduleNextRetry(double CurrentTime)
 {
-	NextDelay *= 2;
-	NextDelay += FMath::RandRange(-NextDelay, NextDelay) / 4;
+	NextDelay *= Policy.BackoffMultiplier;
+	NextDelay += FMath::FRandRange(-NextDelay, NextDelay) * Policy.Jitter;
 
-	if (NextDelay > FHttpRetryScheduler::MaximumDelay)
+	if (NextDelay > Policy.MaximumDelay)
 	{
-		NextDelay = FHttpRetryScheduler::MaximumDelay;
+		NextDelay = Policy.MaximumDelay;
 	}
 
-	NextRetryTime = CurrentTime + NextDelay;
+	NextRetryTime = FMath::Min(CurrentTime + NextDelay, Deadline);
+}
+
+void FHttpRetryScheduler::FHttpRetryTask::ScheduleNextCheck(double CurrentTime)
+{
+	NextRetryTime = FMath::Min(CurrentTime + NextDelay, Deadline);
 
-	if (NextRetryTime > RequestTime + FHttpRetryScheduler::TotalTimeout)
+	if (Policy.AttemptTimeout > 0.0)
 	{
-		NextRetryTime = RequestTime + FHttpRetryScheduler::TotalTimeout;
+		NextRetryTime = FMath::Min(NextRetryTime, DispatchTime + Policy.AttemptTimeout);
 	}
 }
 
-}
\ No newline at end of file
+bool FHttpRetryScheduler::FHttpRetryTask::CanRetry(double CurrentTime) const
+{
+	return CurrentTime < Deadline && (Policy.MaxAttempts <= 0 || AttemptCount < Policy.MaxAttempts);
+}
+
+SIZE_T FHttpRetryScheduler::FHttpRetryTask::GetAllocatedSize() const
+{
+	// MakeShared keeps the reference controller, a vtable and two counts, next to the task
+	return sizeof(FHttpRetryTask) + sizeof(void*) + 2 * sizeof(int32)
+		+ Policy.RetryableStatuses.GetAllocatedSize()
+		+ CoalescingKey.GetAllocatedSize()
+		+ JoinedDelegates.GetAllocatedSize()
+		+ ServiceUrl.GetAllocatedSize()
+		+ EndpointTemplate.GetAllocatedSize()
+		+ ParkedToken.GetAllocatedSize()
+		+ CacheKey.GetAllocatedSize()
+		+ JournalPath.GetAllocatedSize();
+}
+
+}
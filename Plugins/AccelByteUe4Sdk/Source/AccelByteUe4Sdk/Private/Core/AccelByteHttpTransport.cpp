@@ -0,0 +1,44 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteHttpTransport.h"
+#include "HttpModule.h"
+#include "Misc/ScopeLock.h"
+
+namespace AccelByte
+{
+namespace HttpTransport
+{
+	static FCriticalSection Mutex;
+	static TSharedPtr<IHttpTransport, ESPMode::ThreadSafe> Current;
+	/** Read without the lock, the platform's module is used until a transport is set. */
+	static volatile bool bIsSet = false;
+
+	FHttpRequestPtr CreateRequest()
+	{
+		if (!bIsSet)
+		{
+			return FHttpModule::Get().CreateRequest();
+		}
+
+		TSharedPtr<IHttpTransport, ESPMode::ThreadSafe> Transport = Get();
+
+		return Transport.IsValid() ? Transport->CreateRequest() : FHttpRequestPtr(FHttpModule::Get().CreateRequest());
+	}
+
+	void Set(const TSharedPtr<IHttpTransport, ESPMode::ThreadSafe>& Transport)
+	{
+		FScopeLock Lock(&Mutex);
+		Current = Transport;
+		bIsSet = Transport.IsValid();
+	}
+
+	TSharedPtr<IHttpTransport, ESPMode::ThreadSafe> Get()
+	{
+		FScopeLock Lock(&Mutex);
+
+		return Current;
+	}
+}
+}
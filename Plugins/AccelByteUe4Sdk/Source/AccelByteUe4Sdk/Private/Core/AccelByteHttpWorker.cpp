@@ -0,0 +1,253 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteHttpWorker.h"
+#include "AccelByteHttpRetryScheduler.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTLS.h"
+
+namespace AccelByte
+{
+
+/** Milliseconds between two scheduler polls on the worker thread; new requests and responses wake it up earlier. */
+static const uint32 PollIntervalMs = 50;
+
+/** Holds the worker a thread belongs to, so handlers find the right queue without knowing the worker. */
+static uint32 GetWorkerTlsSlot()
+{
+	static uint32 TlsSlot = FPlatformTLS::AllocTlsSlot();
+
+	return TlsSlot;
+}
+
+/** Compares only what the scheduler reads, case-sensitively as tokens are, so unchanged tokens are not copied to the worker every frame. */
+static bool HasSchedulerStateChanged(const Credentials& Sent, const Credentials& Current)
+{
+	return Sent.GetTokenState() != Current.GetTokenState()
+		|| !Sent.GetUserAccessToken().Equals(Current.GetUserAccessToken(), ESearchCase::CaseSensitive)
+		|| !Sent.GetClientAccessToken().Equals(Current.GetClientAccessToken(), ESearchCase::CaseSensitive)
+		|| !Sent.GetUserId().Equals(Current.GetUserId(), ESearchCase::CaseSensitive)
+		|| !Sent.GetUserNamespace().Equals(Current.GetUserNamespace(), ESearchCase::CaseSensitive)
+		|| !Sent.GetClientNamespace().Equals(Current.GetClientNamespace(), ESearchCase::CaseSensitive);
+}
+
+void RunOnGameThread(TFunction<void()> Function)
+{
+	FHttpWorker* Worker = static_cast<FHttpWorker*>(FPlatformTLS::GetTlsValue(GetWorkerTlsSlot()));
+
+	if (Worker != nullptr)
+	{
+		Worker->RunOnGameThread(MoveTemp(Function));
+
+		return;
+	}
+
+	Function();
+}
+
+FHttpWorker::FHttpWorker(FHttpRetryScheduler& Scheduler, Credentials& UserCredentials)
+	: Scheduler(Scheduler)
+	, UserCredentials(UserCredentials)
+	, Thread(nullptr)
+	, WakeUpEvent(nullptr)
+	, bIsRunning(false)
+	, bIsStopping(false)
+	, HandlerDeadline(0.0)
+{
+}
+
+FHttpWorker::~FHttpWorker()
+{
+	Shutdown();
+}
+
+bool FHttpWorker::Startup()
+{
+	if (Thread != nullptr)
+	{
+		return true;
+	}
+
+	WorkerCredentials = UserCredentials;
+	SentCredentials = UserCredentials;
+	WakeUpEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	bIsStopping = false;
+	// Set before the thread exists so nothing touches the scheduler from this thread once it polls
+	bIsRunning = true;
+	Scheduler.SetWorker(this);
+	Thread = FRunnableThread::Create(this, TEXT("AccelByteHttpWorker"), 0, TPri_Normal);
+
+	if (Thread == nullptr)
+	{
+		bIsRunning = false;
+		Scheduler.SetWorker(nullptr);
+		FPlatformProcess::ReturnSynchEventToPool(WakeUpEvent);
+		WakeUpEvent = nullptr;
+
+		return false;
+	}
+
+	return true;
+}
+
+void FHttpWorker::Shutdown()
+{
+	if (Thread == nullptr)
+	{
+		return;
+	}
+
+	Thread->Kill(true);
+	delete Thread;
+	Thread = nullptr;
+	bIsRunning = false;
+	FPlatformProcess::ReturnSynchEventToPool(WakeUpEvent);
+	WakeUpEvent = nullptr;
+	Scheduler.SetWorker(nullptr);
+
+	// Whatever was still queued for the worker now runs on this thread
+	TFunction<void()> Function;
+
+	while (WorkerQueue.Dequeue(Function))
+	{
+		Function();
+	}
+
+	PollGameThread();
+}
+
+bool FHttpWorker::IsRunning() const
+{
+	return bIsRunning;
+}
+
+bool FHttpWorker::IsInWorkerThread() const
+{
+	return FPlatformTLS::GetTlsValue(GetWorkerTlsSlot()) == this;
+}
+
+void FHttpWorker::RunOnWorker(TFunction<void()> Function)
+{
+	if (!bIsRunning || IsInWorkerThread())
+	{
+		Function();
+
+		return;
+	}
+
+	PendingCount.Increment();
+	WorkerQueue.Enqueue([this, Function = MoveTemp(Function)]()
+	{
+		Function();
+		PendingCount.Decrement();
+	});
+	WakeUpEvent->Trigger();
+}
+
+void FHttpWorker::RunOnGameThread(TFunction<void()> Function)
+{
+	if (!IsInWorkerThread())
+	{
+		Function();
+
+		return;
+	}
+
+	GameThreadQueue.Enqueue(FGameThreadHandler{ MoveTemp(Function), Scheduler.GetInheritedDeadline() });
+}
+
+void FHttpWorker::ScheduleRefreshToken(double NextRefreshTime)
+{
+	RunOnGameThread([this, NextRefreshTime]()
+	{
+		UserCredentials.ScheduleRefreshToken(NextRefreshTime);
+	});
+}
+
+double FHttpWorker::GetHandlerDeadline() const
+{
+	return HandlerDeadline;
+}
+
+bool FHttpWorker::PollGameThread()
+{
+	bool bHasHandlers = false;
+	FGameThreadHandler Handler;
+
+	while (GameThreadQueue.Dequeue(Handler))
+	{
+		bHasHandlers = true;
+		HandlerDeadline = Handler.Deadline;
+		Handler.Function();
+	}
+
+	HandlerDeadline = 0.0;
+
+	if (!bIsRunning)
+	{
+		return Scheduler.PollRetry(FPlatformTime::Seconds(), UserCredentials) || bHasHandlers;
+	}
+
+	// Not counted as pending, the worker does not need to run it before the tasks it holds
+	if (HasSchedulerStateChanged(SentCredentials, UserCredentials))
+	{
+		SentCredentials = UserCredentials;
+		Credentials Snapshot = UserCredentials;
+		WorkerQueue.Enqueue([this, Snapshot]()
+		{
+			WorkerCredentials = Snapshot;
+		});
+		WakeUpEvent->Trigger();
+	}
+
+	// Handlers are queued before the task count drops, so the queue is checked last
+	return bHasHandlers || PendingCount.GetValue() > 0 || TaskCount.GetValue() > 0 || !GameThreadQueue.IsEmpty();
+}
+
+bool FHttpWorker::Init()
+{
+	FPlatformTLS::SetTlsValue(GetWorkerTlsSlot(), this);
+
+	return true;
+}
+
+uint32 FHttpWorker::Run()
+{
+	double NextPollTime = 0.0;
+
+	while (!bIsStopping)
+	{
+		TFunction<void()> Function;
+
+		while (WorkerQueue.Dequeue(Function))
+		{
+			Function();
+		}
+
+		double CurrentTime = FPlatformTime::Seconds();
+
+		if (CurrentTime >= NextPollTime)
+		{
+			Scheduler.PollRetry(CurrentTime, WorkerCredentials);
+			NextPollTime = CurrentTime + PollIntervalMs / 1000.0;
+		}
+
+		TaskCount.Set(Scheduler.GetTaskCount());
+		WakeUpEvent->Wait(PollIntervalMs);
+	}
+
+	return 0;
+}
+
+void FHttpWorker::Stop()
+{
+	bIsStopping = true;
+
+	if (WakeUpEvent != nullptr)
+	{
+		WakeUpEvent->Trigger();
+	}
+}
+
+}
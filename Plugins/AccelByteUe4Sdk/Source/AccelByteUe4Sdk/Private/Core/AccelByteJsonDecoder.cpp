@@ -0,0 +1,1183 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteJsonDecoder.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/UnrealType.h"
+#include "UObject/EnumProperty.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && !PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#include <emmintrin.h>
+#define ACCELBYTE_JSON_DECODER_SSE2 1
+#else
+#define ACCELBYTE_JSON_DECODER_SSE2 0
+#endif
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteJsonDecoder, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteJsonDecoder);
+
+namespace AccelByte
+{
+namespace JsonDecoder
+{
+	/** Deeper documents are left to the converter rather than recursed into. */
+	static const int32 MaxDepth = 64;
+	/** Longer number tokens are left to the converter. */
+	static const int32 MaxNumberLength = 63;
+
+	static FThreadSafeBool bIsEnabled(true);
+	static FThreadSafeCounter64 Streamed;
+	static FThreadSafeCounter64 FellBack;
+
+	enum class EValueKind : uint8
+	{
+		String,
+		Bool,
+		Integer,
+		Float,
+		Enum,
+		DateTime,
+		Struct,
+		Array,
+		Map,
+		/** Read by the converter in a way not mirrored here, e.g. FText, TSet, FName or a UObject; a document setting it falls back. */
+		Unsupported
+	};
+
+	struct FStructLayout;
+
+	struct FValueLayout
+	{
+		EValueKind Kind = EValueKind::Unsupported;
+		UProperty* Property = nullptr;
+		/** Integer, Float and Enum values are set through it. */
+		UNumericProperty* Numeric = nullptr;
+		UEnum* Enum = nullptr;
+		const FStructLayout* Struct = nullptr;
+		/** Element of an Array, value of a Map. */
+		TUniquePtr<FValueLayout> Inner;
+	};
+
+	struct FFieldLayout
+	{
+		FString Name;
+		/** Lower case name, empty when the name isn't ASCII. */
+		TArray<uint8> AsciiName;
+		FValueLayout Value;
+	};
+
+	struct FStructLayout
+	{
+		TArray<FFieldLayout> Fields;
+		/** False for the structs the converter reads its own way, e.g. FJsonObjectWrapper, or with names it would confuse. */
+		bool bIsSupported = true;
+	};
+
+	/**
+	 * @brief Layouts of every struct decoded so far; built once under the lock, never changed afterwards.
+	 */
+	class FLayoutCache
+	{
+	public:
+		const FStructLayout& Find(const UScriptStruct* Struct)
+		{
+			FScopeLock Lock(&Mutex);
+
+			return FindLocked(Struct);
+		}
+
+	private:
+		const FStructLayout& FindLocked(const UScriptStruct* Struct)
+		{
+			if (const TUniquePtr<FStructLayout>* Found = Layouts.Find(Struct))
+			{
+				return **Found;
+			}
+
+			static const FName NameJsonObjectWrapper(TEXT("JsonObjectWrapper"));
+
+			// Added before its fields so that a struct holding an array of itself finds it
+			FStructLayout& Layout = *Layouts.Add(Struct, MakeUnique<FStructLayout>());
+			Layout.bIsSupported = Struct->GetFName() != NameJsonObjectWrapper;
+
+			for (TFieldIterator<UProperty> PropertyIt(Struct); PropertyIt; ++PropertyIt)
+			{
+				FFieldLayout& Field = Layout.Fields[Layout.Fields.AddDefaulted()];
+				Field.Name = PropertyIt->GetName();
+
+				for (const FFieldLayout& Other : Layout.Fields)
+				{
+					if (&Other != &Field && Other.Name == Field.Name)
+					{
+						Layout.bIsSupported = false;
+					}
+				}
+
+				for (int32 i = 0; i < Field.Name.Len(); i++)
+				{
+					TCHAR Char = Field.Name[i];
+
+					if (Char >= 0x80)
+					{
+						Field.AsciiName.Empty();
+						break;
+					}
+
+					Field.AsciiName.Add(static_cast<uint8>(FChar::ToLower(Char)));
+				}
+
+				BuildValue(*PropertyIt, Field.Value);
+			}
+
+			return Layout;
+		}
+
+		void BuildValue(UProperty* Property, FValueLayout& Value)
+		{
+			static const FName NameDateTime(TEXT("DateTime"));
+
+			Value.Property = Property;
+
+			if (UEnumProperty* EnumProperty = Cast<UEnumProperty>(Property))
+			{
+				Value.Kind = EValueKind::Enum;
+				Value.Numeric = EnumProperty->GetUnderlyingProperty();
+				Value.Enum = EnumProperty->GetEnum();
+			}
+			else if (UNumericProperty* NumericProperty = Cast<UNumericProperty>(Property))
+			{
+				Value.Numeric = NumericProperty;
+
+				if (NumericProperty->IsEnum())
+				{
+					Value.Kind = EValueKind::Enum;
+					Value.Enum = NumericProperty->GetIntPropertyEnum();
+				}
+				else if (NumericProperty->IsFloatingPoint())
+				{
+					Value.Kind = EValueKind::Float;
+				}
+				else if (NumericProperty->IsInteger())
+				{
+					Value.Kind = EValueKind::Integer;
+				}
+			}
+			else if (Property->IsA<UBoolProperty>())
+			{
+				Value.Kind = EValueKind::Bool;
+			}
+			else if (Property->IsA<UStrProperty>())
+			{
+				Value.Kind = EValueKind::String;
+			}
+			else if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
+			{
+				Value.Inner = MakeUnique<FValueLayout>();
+				BuildValue(ArrayProperty->Inner, *Value.Inner);
+				Value.Kind = Value.Inner->Kind != EValueKind::Unsupported ? EValueKind::Array : EValueKind::Unsupported;
+			}
+			else if (UMapProperty* MapProperty = Cast<UMapProperty>(Property))
+			{
+				Value.Inner = MakeUnique<FValueLayout>();
+				BuildValue(MapProperty->ValueProp, *Value.Inner);
+				Value.Kind = MapProperty->KeyProp->IsA<UStrProperty>() && Value.Inner->Kind != EValueKind::Unsupported ? EValueKind::Map : EValueKind::Unsupported;
+			}
+			else if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+			{
+				if (StructProperty->Struct->GetFName() == NameDateTime)
+				{
+					Value.Kind = EValueKind::DateTime;
+				}
+				else
+				{
+					Value.Kind = EValueKind::Struct;
+					Value.Struct = &FindLocked(StructProperty->Struct);
+				}
+			}
+
+			// Static arrays are read element by element from a JSON array
+			if (Property->ArrayDim != 1)
+			{
+				Value.Kind = EValueKind::Unsupported;
+			}
+		}
+
+		FCriticalSection Mutex;
+		TMap<const UScriptStruct*, TUniquePtr<FStructLayout>> Layouts;
+	};
+
+	static FLayoutCache& GetLayoutCache()
+	{
+		static FLayoutCache LayoutCache;
+
+		return LayoutCache;
+	}
+
+	/**
+	 * @brief Reads one document, accepting only what the converter's reader accepts and converting only the way the converter converts.
+	 * Every function returns false as soon as it meets anything else; the document then falls back as a whole.
+	 */
+	class FDecoder
+	{
+	public:
+		FDecoder(const uint8* Content, int32 ContentSize)
+			: Begin(Content)
+			, Cursor(Content)
+			, End(Content + ContentSize)
+			, Depth(0)
+		{
+		}
+
+		bool ReadObjectDocument(const FStructLayout& Layout, void* OutStruct)
+		{
+			SkipWhitespace();
+
+			return Peek() == '{' && ReadObject(Layout, OutStruct) && IsAtEnd();
+		}
+
+		bool ReadArrayDocument(const FStructLayout& Layout, TFunctionRef<void*()> AddElement)
+		{
+			SkipWhitespace();
+
+			if (!Consume('['))
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+
+			if (!Consume(']'))
+			{
+				do
+				{
+					SkipWhitespace();
+
+					if (Peek() != '{' || !ReadObject(Layout, AddElement()))
+					{
+						return false;
+					}
+
+					SkipWhitespace();
+				}
+				while (Consume(','));
+
+				if (!Consume(']'))
+				{
+					return false;
+				}
+			}
+
+			return IsAtEnd();
+		}
+
+		int32 GetOffset() const
+		{
+			return static_cast<int32>(Cursor - Begin);
+		}
+
+	private:
+		uint8 Peek() const
+		{
+			return Cursor < End ? *Cursor : 0;
+		}
+
+		bool Consume(uint8 Char)
+		{
+			if (Cursor < End && *Cursor == Char)
+			{
+				++Cursor;
+
+				return true;
+			}
+
+			return false;
+		}
+
+		void SkipWhitespace()
+		{
+			while (Cursor < End && (*Cursor == ' ' || *Cursor == '\n' || *Cursor == '\r' || *Cursor == '\t'))
+			{
+				++Cursor;
+			}
+		}
+
+		bool IsAtEnd()
+		{
+			SkipWhitespace();
+
+			return Cursor == End;
+		}
+
+		bool Enter()
+		{
+			return ++Depth <= MaxDepth;
+		}
+
+		bool Leave()
+		{
+			--Depth;
+
+			return true;
+		}
+
+		bool ConsumeLiteral(const char* Literal)
+		{
+			const uint8* At = Cursor;
+
+			for (; *Literal != 0; ++Literal, ++At)
+			{
+				if (At >= End || *At != static_cast<uint8>(*Literal))
+				{
+					return false;
+				}
+			}
+
+			Cursor = At;
+
+			return true;
+		}
+
+		/** First byte from From on that ends a run of plain string bytes: a quote, a backslash, a NUL, or the lead of a multi-byte sequence. */
+		const uint8* FindStringSpecial(const uint8* From) const
+		{
+#if ACCELBYTE_JSON_DECODER_SSE2
+			const __m128i Quote = _mm_set1_epi8('"');
+			const __m128i Backslash = _mm_set1_epi8('\\');
+			const __m128i Zero = _mm_setzero_si128();
+
+			while (End - From >= 16)
+			{
+				__m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(From));
+				__m128i Special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(Chunk, Quote), _mm_cmpeq_epi8(Chunk, Backslash)), _mm_cmpeq_epi8(Chunk, Zero));
+				// The top bit of the chunk itself marks the bytes of multi-byte sequences
+				uint32 Mask = static_cast<uint32>(_mm_movemask_epi8(_mm_or_si128(Special, Chunk)));
+
+				if (Mask != 0)
+				{
+					return From + FMath::CountTrailingZeros(Mask);
+				}
+
+				From += 16;
+			}
+#endif
+			while (From < End && *From != '"' && *From != '\\' && *From != 0 && *From < 0x80)
+			{
+				++From;
+			}
+
+			return From;
+		}
+
+		/** Length of the well-formed UTF-8 sequence at At, 0 for anything the platform's conversion might read differently. */
+		int32 GetSequenceLength(const uint8* At) const
+		{
+			int32 Length = 0;
+
+			if (*At >= 0xC2 && *At <= 0xDF)
+			{
+				Length = 2;
+			}
+			else if (*At >= 0xE0 && *At <= 0xEF)
+			{
+				Length = 3;
+			}
+			else if (*At >= 0xF0 && *At <= 0xF4)
+			{
+				Length = 4;
+			}
+
+			if (Length == 0 || End - At < Length)
+			{
+				return 0;
+			}
+
+			uint32 Codepoint = *At & (0x7F >> Length);
+
+			for (int32 i = 1; i < Length; i++)
+			{
+				if ((At[i] & 0xC0) != 0x80)
+				{
+					return 0;
+				}
+
+				Codepoint = (Codepoint << 6) | (At[i] & 0x3F);
+			}
+
+			if ((Length == 3 && (Codepoint < 0x800 || (Codepoint >= 0xD800 && Codepoint <= 0xDFFF))) || (Length == 4 && (Codepoint < 0x10000 || Codepoint > 0x10FFFF)))
+			{
+				return 0;
+			}
+
+			return Length;
+		}
+
+		/** Character of the escape sequence after a backslash; NUL and surrogate escapes are left to the converter. */
+		bool ReadEscape(TCHAR& OutChar)
+		{
+			if (Cursor >= End)
+			{
+				return false;
+			}
+
+			switch (*Cursor++)
+			{
+			case '"': OutChar = TEXT('"'); return true;
+			case '\\': OutChar = TEXT('\\'); return true;
+			case '/': OutChar = TEXT('/'); return true;
+			case 'b': OutChar = TEXT('\b'); return true;
+			case 'f': OutChar = TEXT('\f'); return true;
+			case 'n': OutChar = TEXT('\n'); return true;
+			case 'r': OutChar = TEXT('\r'); return true;
+			case 't': OutChar = TEXT('\t'); return true;
+			case 'u': break;
+			default: return false;
+			}
+
+			if (End - Cursor < 4)
+			{
+				return false;
+			}
+
+			uint32 Codepoint = 0;
+
+			for (int32 i = 0; i < 4; i++)
+			{
+				uint8 Digit = *Cursor++;
+
+				if (!FChar::IsHexDigit(Digit))
+				{
+					return false;
+				}
+
+				Codepoint = (Codepoint << 4) | FParse::HexDigit(Digit);
+			}
+
+			if (Codepoint == 0 || (Codepoint >= 0xD800 && Codepoint <= 0xDFFF))
+			{
+				return false;
+			}
+
+			OutChar = static_cast<TCHAR>(Codepoint);
+
+			return true;
+		}
+
+		static void AppendAscii(FString& Out, const uint8* From, const uint8* To)
+		{
+			int32 Count = static_cast<int32>(To - From);
+
+			if (Count == 0)
+			{
+				return;
+			}
+
+			TArray<TCHAR>& Chars = Out.GetCharArray();
+			int32 Length = Chars.Num() > 0 ? Chars.Num() - 1 : 0;
+			Chars.SetNumUninitialized(Length + Count + 1, false);
+			TCHAR* Destination = Chars.GetData() + Length;
+
+			for (int32 i = 0; i < Count; i++)
+			{
+				Destination[i] = From[i];
+			}
+
+			Destination[Count] = 0;
+		}
+
+		/** Run of plain bytes, converted as the platform converts the whole body when it holds multi-byte sequences. */
+		static void AppendRun(FString& Out, const uint8* From, const uint8* To, bool bIsAscii)
+		{
+			if (bIsAscii)
+			{
+				AppendAscii(Out, From, To);
+			}
+			else
+			{
+				FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(From), static_cast<int32>(To - From));
+				Out.AppendChars(Converted.Get(), Converted.Length());
+			}
+		}
+
+		/** String token at the cursor; with OutString null it is only checked and skipped. */
+		bool ReadString(FString* OutString)
+		{
+			if (!Consume('"'))
+			{
+				return false;
+			}
+
+			const uint8* Run = Cursor;
+			bool bIsAscii = true;
+
+			while (true)
+			{
+				const uint8* Special = FindStringSpecial(Cursor);
+
+				if (Special >= End || *Special == 0)
+				{
+					return false;
+				}
+
+				if (*Special >= 0x80)
+				{
+					int32 Length = GetSequenceLength(Special);
+
+					if (Length == 0)
+					{
+						return false;
+					}
+
+					bIsAscii = false;
+					Cursor = Special + Length;
+					continue;
+				}
+
+				if (OutString != nullptr)
+				{
+					AppendRun(*OutString, Run, Special, bIsAscii);
+				}
+
+				Cursor = Special + 1;
+
+				if (*Special == '"')
+				{
+					return true;
+				}
+
+				TCHAR Escaped;
+
+				if (!ReadEscape(Escaped))
+				{
+					return false;
+				}
+
+				if (OutString != nullptr)
+				{
+					OutString->AppendChar(Escaped);
+				}
+
+				Run = Cursor;
+				bIsAscii = true;
+			}
+		}
+
+		bool SkipNumber()
+		{
+			Consume('-');
+
+			// A leading zero stands alone
+			if (!Consume('0') && !SkipDigits())
+			{
+				return false;
+			}
+
+			if (Consume('.') && !SkipDigits())
+			{
+				return false;
+			}
+
+			if (Consume('e') || Consume('E'))
+			{
+				if (!Consume('+'))
+				{
+					Consume('-');
+				}
+
+				if (!SkipDigits())
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool SkipDigits()
+		{
+			const uint8* Start = Cursor;
+
+			while (Cursor < End && *Cursor >= '0' && *Cursor <= '9')
+			{
+				++Cursor;
+			}
+
+			return Cursor > Start;
+		}
+
+		/** Number token parsed the way the converter's reader parses it. */
+		bool ReadNumber(double& OutNumber)
+		{
+			const uint8* Start = Cursor;
+
+			if (!SkipNumber() || Cursor - Start > MaxNumberLength)
+			{
+				return false;
+			}
+
+			TCHAR Token[MaxNumberLength + 1];
+			int32 Length = static_cast<int32>(Cursor - Start);
+
+			for (int32 i = 0; i < Length; i++)
+			{
+				Token[i] = Start[i];
+			}
+
+			Token[Length] = 0;
+			OutNumber = FCString::Atod(Token);
+
+			return true;
+		}
+
+		bool SkipValue()
+		{
+			switch (Peek())
+			{
+			case '"':
+				return ReadString(nullptr);
+			case '{':
+				return SkipObject();
+			case '[':
+				return SkipArray();
+			case 't':
+				return ConsumeLiteral("true");
+			case 'f':
+				return ConsumeLiteral("false");
+			case 'n':
+				return ConsumeLiteral("null");
+			default:
+				return SkipNumber();
+			}
+		}
+
+		bool SkipObject()
+		{
+			if (!Enter() || !Consume('{'))
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+
+			if (Consume('}'))
+			{
+				return Leave();
+			}
+
+			do
+			{
+				SkipWhitespace();
+
+				if (!ReadString(nullptr))
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+
+				if (!Consume(':'))
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+
+				if (!SkipValue())
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+			}
+			while (Consume(','));
+
+			return Consume('}') && Leave();
+		}
+
+		bool SkipArray()
+		{
+			if (!Enter() || !Consume('['))
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+
+			if (Consume(']'))
+			{
+				return Leave();
+			}
+
+			do
+			{
+				SkipWhitespace();
+
+				if (!SkipValue())
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+			}
+			while (Consume(','));
+
+			return Consume(']') && Leave();
+		}
+
+		/**
+		 * @brief Field named by the key at the cursor, INDEX_NONE when the struct has none.
+		 * Matches as the converter's lookup in the FJsonObject does: case-insensitively, by name and hash.
+		 */
+		bool ReadKey(const FStructLayout& Layout, int32& OutFieldIndex)
+		{
+			OutFieldIndex = INDEX_NONE;
+
+			if (!Consume('"'))
+			{
+				return false;
+			}
+
+			const uint8* Key = Cursor;
+			const uint8* Special = FindStringSpecial(Cursor);
+
+			if (Special < End && *Special == '"')
+			{
+				int32 KeyLength = static_cast<int32>(Special - Key);
+				Cursor = Special + 1;
+
+				for (int32 i = 0; i < Layout.Fields.Num(); i++)
+				{
+					const TArray<uint8>& Name = Layout.Fields[i].AsciiName;
+
+					if (Name.Num() == KeyLength && KeyLength > 0 && FCStringAnsi::Strnicmp(reinterpret_cast<const ANSICHAR*>(Name.GetData()), reinterpret_cast<const ANSICHAR*>(Key), KeyLength) == 0)
+					{
+						OutFieldIndex = i;
+						break;
+					}
+				}
+
+				return true;
+			}
+
+			// Escaped or non-ASCII keys are compared the slow way
+			FString KeyString;
+			Cursor = Key - 1;
+
+			if (!ReadString(&KeyString))
+			{
+				return false;
+			}
+
+			for (int32 i = 0; i < Layout.Fields.Num(); i++)
+			{
+				if (KeyString == Layout.Fields[i].Name && GetTypeHash(KeyString) == GetTypeHash(Layout.Fields[i].Name))
+				{
+					OutFieldIndex = i;
+					break;
+				}
+			}
+
+			return true;
+		}
+
+		bool ReadObject(const FStructLayout& Layout, void* OutStruct)
+		{
+			if (!Layout.bIsSupported || !Enter() || !Consume('{'))
+			{
+				return false;
+			}
+
+			TArray<bool, TInlineAllocator<64>> IsFieldSet;
+			IsFieldSet.SetNumZeroed(Layout.Fields.Num());
+			SkipWhitespace();
+
+			if (Consume('}'))
+			{
+				return Leave();
+			}
+
+			do
+			{
+				SkipWhitespace();
+				int32 FieldIndex;
+
+				if (!ReadKey(Layout, FieldIndex))
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+
+				if (!Consume(':'))
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+
+				if (FieldIndex == INDEX_NONE)
+				{
+					if (!SkipValue())
+					{
+						return false;
+					}
+				}
+				else
+				{
+					// The FJsonObject keeps only the last of repeated keys, which was never set before it
+					if (IsFieldSet[FieldIndex])
+					{
+						return false;
+					}
+
+					IsFieldSet[FieldIndex] = true;
+					const FValueLayout& Value = Layout.Fields[FieldIndex].Value;
+
+					if (!ReadValue(Value, Value.Property->ContainerPtrToValuePtr<void>(OutStruct)))
+					{
+						return false;
+					}
+				}
+
+				SkipWhitespace();
+			}
+			while (Consume(','));
+
+			return Consume('}') && Leave();
+		}
+
+		bool ReadArray(const FValueLayout& Layout, void* OutValue)
+		{
+			if (!Enter() || !Consume('['))
+			{
+				return false;
+			}
+
+			// As the converter's Resize, existing elements are read into and the extra ones removed
+			FScriptArrayHelper Array(static_cast<UArrayProperty*>(Layout.Property), OutValue);
+			int32 Count = 0;
+			SkipWhitespace();
+
+			if (!Consume(']'))
+			{
+				do
+				{
+					SkipWhitespace();
+
+					if (Count == Array.Num())
+					{
+						Array.AddValue();
+					}
+
+					// Null elements are left as they are
+					if (!ConsumeLiteral("null") && !ReadValue(*Layout.Inner, Array.GetRawPtr(Count)))
+					{
+						return false;
+					}
+
+					Count++;
+					SkipWhitespace();
+				}
+				while (Consume(','));
+
+				if (!Consume(']'))
+				{
+					return false;
+				}
+			}
+
+			if (Count < Array.Num())
+			{
+				Array.Resize(Count);
+			}
+
+			return Leave();
+		}
+
+		bool ReadMap(const FValueLayout& Layout, void* OutValue)
+		{
+			FScriptMapHelper Map(static_cast<UMapProperty*>(Layout.Property), OutValue);
+
+			// The converter adds to the pairs already there
+			if (Map.Num() != 0 || !Enter() || !Consume('{'))
+			{
+				return false;
+			}
+
+			// Rehashed even when a pair fails, the map is still destroyed afterwards
+			bool bIsRead = ReadMapPairs(Layout, Map);
+			Map.Rehash();
+
+			return bIsRead && Leave();
+		}
+
+		bool ReadMapPairs(const FValueLayout& Layout, FScriptMapHelper& Map)
+		{
+			TSet<FString> Keys;
+			SkipWhitespace();
+
+			if (Consume('}'))
+			{
+				return true;
+			}
+
+			do
+			{
+				SkipWhitespace();
+				FString Key;
+
+				if (!ReadString(&Key))
+				{
+					return false;
+				}
+
+				// The FJsonObject keeps only the last of keys differing by case
+				bool bIsRepeated = false;
+				Keys.Add(Key, &bIsRepeated);
+
+				if (bIsRepeated)
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+
+				if (!Consume(':'))
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+
+				// Null values are not added
+				if (!ConsumeLiteral("null"))
+				{
+					int32 Index = Map.AddDefaultValue_Invalid_NeedsRehash();
+					*reinterpret_cast<FString*>(Map.GetKeyPtr(Index)) = MoveTemp(Key);
+
+					if (!ReadValue(*Layout.Inner, Map.GetValuePtr(Index)))
+					{
+						return false;
+					}
+				}
+
+				SkipWhitespace();
+			}
+			while (Consume(','));
+
+			return Consume('}');
+		}
+
+		/**
+		 * @brief Value of one property, converted as FJsonObjectConverter converts it.
+		 * A null sets strings, numbers and booleans to empty, 0 and false, as the converter does after logging it.
+		 */
+		bool ReadValue(const FValueLayout& Layout, void* OutValue)
+		{
+			uint8 Next = Peek();
+			bool bIsNumber = Next == '-' || (Next >= '0' && Next <= '9');
+			bool bIsNull = Next == 'n' && ConsumeLiteral("null");
+
+			switch (Layout.Kind)
+			{
+			case EValueKind::String:
+				{
+					FString& String = *static_cast<FString*>(OutValue);
+
+					if (bIsNull)
+					{
+						String = FString();
+
+						return true;
+					}
+
+					FString Value;
+
+					if (Next != '"' || !ReadString(&Value))
+					{
+						return false;
+					}
+
+					String = MoveTemp(Value);
+
+					return true;
+				}
+			case EValueKind::Bool:
+				{
+					UBoolProperty* BoolProperty = static_cast<UBoolProperty*>(Layout.Property);
+
+					if (bIsNull || ConsumeLiteral("false"))
+					{
+						BoolProperty->SetPropertyValue(OutValue, false);
+
+						return true;
+					}
+
+					if (ConsumeLiteral("true"))
+					{
+						BoolProperty->SetPropertyValue(OutValue, true);
+
+						return true;
+					}
+
+					return false;
+				}
+			case EValueKind::Integer:
+			case EValueKind::Enum:
+				{
+					int64 Value = 0;
+
+					if (Next == '"')
+					{
+						FString String;
+
+						if (!ReadString(&String))
+						{
+							return false;
+						}
+
+						if (Layout.Kind == EValueKind::Enum)
+						{
+							Value = Layout.Enum->GetValueByName(FName(*String));
+
+							if (Value == INDEX_NONE)
+							{
+								return false;
+							}
+						}
+						else
+						{
+							// Parsed as an integer so that large values don't go through a double
+							Value = FCString::Atoi64(*String);
+						}
+					}
+					else if (bIsNumber)
+					{
+						double Number;
+
+						if (!ReadNumber(Number))
+						{
+							return false;
+						}
+
+						Value = static_cast<int64>(Number);
+					}
+					else if (!bIsNull)
+					{
+						return false;
+					}
+
+					Layout.Numeric->SetIntPropertyValue(OutValue, Value);
+
+					return true;
+				}
+			case EValueKind::Float:
+				{
+					double Number = 0.0;
+
+					if (!bIsNull && (!bIsNumber || !ReadNumber(Number)))
+					{
+						return false;
+					}
+
+					Layout.Numeric->SetFloatingPointPropertyValue(OutValue, Number);
+
+					return true;
+				}
+			case EValueKind::DateTime:
+				{
+					FString String;
+
+					if (Next != '"' || !ReadString(&String))
+					{
+						return false;
+					}
+
+					FDateTime& DateTime = *static_cast<FDateTime*>(OutValue);
+
+					if (String == TEXT("min"))
+					{
+						DateTime = FDateTime::MinValue();
+					}
+					else if (String == TEXT("max"))
+					{
+						DateTime = FDateTime::MaxValue();
+					}
+					else if (String == TEXT("now"))
+					{
+						DateTime = FDateTime::UtcNow();
+					}
+					else if (!FDateTime::ParseIso8601(*String, DateTime) && !FDateTime::Parse(String, DateTime))
+					{
+						return false;
+					}
+
+					return true;
+				}
+			case EValueKind::Struct:
+				return Next == '{' && ReadObject(*Layout.Struct, OutValue);
+			case EValueKind::Array:
+				return Next == '[' && ReadArray(Layout, OutValue);
+			case EValueKind::Map:
+				return Next == '{' && ReadMap(Layout, OutValue);
+			default:
+				return false;
+			}
+		}
+
+		const uint8* Begin;
+		const uint8* Cursor;
+		const uint8* End;
+		int32 Depth;
+	};
+
+	static bool CountResult(bool bIsDecoded, const UScriptStruct* Struct, const FDecoder& Decoder)
+	{
+		if (bIsDecoded)
+		{
+			Streamed.Increment();
+		}
+		else
+		{
+			FellBack.Increment();
+			UE_LOG(LogAccelByteJsonDecoder, Verbose, TEXT("%s falls back to FJsonObjectConverter at byte %d"), *Struct->GetName(), Decoder.GetOffset());
+		}
+
+		return bIsDecoded;
+	}
+
+	bool TryDecodeObject(const UScriptStruct* Struct, void* OutStruct, const uint8* Content, int32 ContentSize)
+	{
+		const FStructLayout& Layout = GetLayoutCache().Find(Struct);
+		FDecoder Decoder(Content, ContentSize);
+
+		return CountResult(Decoder.ReadObjectDocument(Layout, OutStruct), Struct, Decoder);
+	}
+
+	bool TryDecodeArray(const UScriptStruct* Struct, const uint8* Content, int32 ContentSize, TFunctionRef<void*()> AddElement)
+	{
+		const FStructLayout& Layout = GetLayoutCache().Find(Struct);
+		FDecoder Decoder(Content, ContentSize);
+
+		return CountResult(Decoder.ReadArrayDocument(Layout, AddElement), Struct, Decoder);
+	}
+
+	void SetEnabled(bool bEnabled)
+	{
+		bIsEnabled = bEnabled;
+	}
+
+	bool IsEnabled()
+	{
+		return bIsEnabled;
+	}
+
+	FDecoderStats GetStats()
+	{
+		return FDecoderStats{ Streamed.GetValue(), FellBack.GetValue() };
+	}
+}
+}
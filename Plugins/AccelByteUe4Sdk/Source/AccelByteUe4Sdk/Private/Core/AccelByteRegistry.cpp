@@ -4,6 +4,8 @@
 
 #include "AccelByteRegistry.h"
 #include "AccelByteHttpRetryScheduler.h"
+#include "AccelByteHttpWorker.h"
+#include "AccelByteHttpRequestFactory.h"
 #include "AccelByteLobbyApi.h"
 #include "AccelByteGameProfileApi.h"
 
@@ -13,5 +15,7 @@ using namespace AccelByte::Api;
 Settings FRegistry::Settings;
 Credentials FRegistry::Credentials;
 FHttpRetryScheduler FRegistry::HttpRetryScheduler;
+FHttpWorker FRegistry::HttpWorker(FRegistry::HttpRetryScheduler, FRegistry::Credentials);
+FHttpRequestFactory FRegistry::HttpRequestFactory(FRegistry::Settings, FRegistry::Credentials);
 Api::Lobby FRegistry::Lobby(FRegistry::Credentials, FRegistry::Settings);
 Api::GameProfile FRegistry::GameProfile(FRegistry::Credentials, FRegistry::Settings);
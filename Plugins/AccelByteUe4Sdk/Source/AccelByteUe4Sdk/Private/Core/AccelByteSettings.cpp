@@ -8,6 +8,10 @@
 using namespace AccelByte;
 
 UAccelByteSettings::UAccelByteSettings()
+	: bPersistResponseCache(false)
+	, bJournalWrites(false)
+	, bRetryKeyedWrites(false)
+	, bTraceEnabled(false)
 {
 }
 
@@ -0,0 +1,406 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteSimulatedHttpTransport.h"
+#include "Interfaces/IHttpResponse.h"
+
+namespace AccelByte
+{
+
+/** Standard normal quantile of 0.99. */
+static const double NormalP99 = 2.3263478740;
+
+FLatencyDistribution FLatencyDistribution::Constant(double Latency)
+{
+	return FLatencyDistribution{ EType::Constant, Latency, Latency };
+}
+
+FLatencyDistribution FLatencyDistribution::Uniform(double Min, double Max)
+{
+	return FLatencyDistribution{ EType::Uniform, Min, Max };
+}
+
+FLatencyDistribution FLatencyDistribution::LogNormal(double Median, double P99)
+{
+	return FLatencyDistribution{ EType::LogNormal, Median, FMath::Max(P99, Median) };
+}
+
+double FLatencyDistribution::Sample(FRandomStream& Random) const
+{
+	// Both draws are always taken, the stream stays aligned whatever the distribution
+	double U1 = FMath::Max(static_cast<double>(Random.GetFraction()), 1e-9);
+	double U2 = Random.GetFraction();
+
+	switch (Type)
+	{
+	case EType::Uniform:
+		return A + (B - A) * U2;
+	case EType::LogNormal:
+	{
+		// Box-Muller, the spread is chosen so that 1% of the samples lie above P99
+		double Normal = FMath::Sqrt(-2.0 * FMath::Loge(U1)) * FMath::Cos(2.0 * PI * U2);
+		double Sigma = FMath::Loge(B / A) / NormalP99;
+
+		return A * FMath::Exp(Sigma * Normal);
+	}
+	default:
+		return A;
+	}
+}
+
+class FSimulatedHttpResponse : public IHttpResponse
+{
+public:
+	FSimulatedHttpResponse(const FString& Url, int32 ResponseCode, TArray<uint8>&& Content)
+		: Url(Url)
+		, ResponseCode(ResponseCode)
+		, Content(MoveTemp(Content))
+	{
+	}
+
+	FString GetURL() override { return Url; }
+	FString GetURLParameter(const FString& ParameterName) override { return FString(); }
+	FString GetHeader(const FString& HeaderName) override { return HeaderName == TEXT("Content-Type") ? GetContentType() : FString(); }
+	TArray<FString> GetAllHeaders() override { return TArray<FString>{ TEXT("Content-Type: ") + GetContentType() }; }
+	FString GetContentType() override { return TEXT("application/json"); }
+	int32 GetContentLength() override { return Content.Num(); }
+	const TArray<uint8>& GetContent() override { return Content; }
+	int32 GetResponseCode() override { return ResponseCode; }
+
+	FString GetContentAsString() override
+	{
+		FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+
+		return FString(Converted.Length(), Converted.Get());
+	}
+
+private:
+	const FString Url;
+	const int32 ResponseCode;
+	const TArray<uint8> Content;
+};
+
+/**
+ * @brief Request answered by its FSimulatedHttpTransport; IHttpRequest keeps a shared reference to itself, the transport holds the request through it.
+ */
+class FSimulatedHttpRequest : public IHttpRequest
+{
+public:
+	explicit FSimulatedHttpRequest(const TSharedRef<FSimulatedHttpTransport, ESPMode::ThreadSafe>& Transport)
+		: Transport(Transport)
+		, Status(EHttpRequestStatus::NotStarted)
+		, StartTime(0.0)
+	{
+	}
+
+	FString GetURL() override { return Url; }
+	FString GetURLParameter(const FString& ParameterName) override { return FString(); }
+	FString GetHeader(const FString& HeaderName) override { return Headers.FindRef(HeaderName); }
+
+	TArray<FString> GetAllHeaders() override
+	{
+		TArray<FString> Result;
+
+		for (const auto& Header : Headers)
+		{
+			Result.Add(Header.Key + TEXT(": ") + Header.Value);
+		}
+
+		return Result;
+	}
+
+	FString GetContentType() override { return GetHeader(TEXT("Content-Type")); }
+	int32 GetContentLength() override { return Content.Num(); }
+	const TArray<uint8>& GetContent() override { return Content; }
+	FString GetVerb() override { return Verb; }
+	void SetVerb(const FString& InVerb) override { Verb = InVerb; }
+	void SetURL(const FString& InUrl) override { Url = InUrl; }
+	void SetContent(const TArray<uint8>& ContentPayload) override { Content = ContentPayload; }
+
+	void SetContentAsString(const FString& ContentString) override
+	{
+		FTCHARToUTF8 Converted(*ContentString);
+		Content.SetNumUninitialized(Converted.Length());
+		FMemory::Memcpy(Content.GetData(), Converted.Get(), Converted.Length());
+	}
+
+	void SetHeader(const FString& HeaderName, const FString& HeaderValue) override { Headers.Add(HeaderName, HeaderValue); }
+	void AppendToHeader(const FString& HeaderName, const FString& AdditionalHeaderValue) override { Headers.FindOrAdd(HeaderName).Append(AdditionalHeaderValue); }
+
+	bool ProcessRequest() override
+	{
+		TSharedPtr<FSimulatedHttpTransport, ESPMode::ThreadSafe> Owner = Transport.Pin();
+
+		if (Status == EHttpRequestStatus::Processing || !Owner.IsValid())
+		{
+			return false;
+		}
+
+		Status = EHttpRequestStatus::Processing;
+		Response.Reset();
+		StartTime = Owner->GetTime();
+
+		return Owner->Submit(StaticCastSharedRef<FSimulatedHttpRequest>(AsShared()));
+	}
+
+	FHttpRequestCompleteDelegate& OnProcessRequestComplete() override { return CompleteDelegate; }
+	FHttpRequestProgressDelegate& OnRequestProgress() override { return ProgressDelegate; }
+
+	void CancelRequest() override
+	{
+		TSharedPtr<FSimulatedHttpTransport, ESPMode::ThreadSafe> Owner = Transport.Pin();
+
+		if (Status == EHttpRequestStatus::Processing && Owner.IsValid())
+		{
+			Owner->Cancel(*this);
+		}
+	}
+
+	EHttpRequestStatus::Type GetStatus() override { return Status; }
+	const FHttpResponsePtr GetResponse() const override { return Response; }
+	void Tick(float DeltaSeconds) override {}
+
+	float GetElapsedTime() override
+	{
+		TSharedPtr<FSimulatedHttpTransport, ESPMode::ThreadSafe> Owner = Transport.Pin();
+
+		return Owner.IsValid() ? static_cast<float>(Owner->GetTime() - StartTime) : 0.0f;
+	}
+
+	void Finish(EHttpRequestStatus::Type FinalStatus, int32 ResponseCode, TArray<uint8>&& ResponseContent)
+	{
+		// The request may be sent again from its own delegate
+		TSharedRef<IHttpRequest> Self = AsShared();
+		Status = FinalStatus;
+
+		if (FinalStatus == EHttpRequestStatus::Succeeded)
+		{
+			int32 ResponseSize = ResponseContent.Num();
+			Response = MakeShared<FSimulatedHttpResponse, ESPMode::ThreadSafe>(Url, ResponseCode, MoveTemp(ResponseContent));
+			ProgressDelegate.ExecuteIfBound(Self, Content.Num(), ResponseSize);
+		}
+
+		CompleteDelegate.ExecuteIfBound(Self, Response, FinalStatus == EHttpRequestStatus::Succeeded);
+	}
+
+private:
+	TWeakPtr<FSimulatedHttpTransport, ESPMode::ThreadSafe> Transport;
+	FString Verb;
+	FString Url;
+	TMap<FString, FString> Headers;
+	TArray<uint8> Content;
+	EHttpRequestStatus::Type Status;
+	FHttpResponsePtr Response;
+	FHttpRequestCompleteDelegate CompleteDelegate;
+	FHttpRequestProgressDelegate ProgressDelegate;
+	double StartTime;
+};
+
+FSimulatedHttpTransport::FSimulatedHttpTransport(const FConfig& Config)
+	: Config(Config)
+	, Random(Config.Seed)
+	, Time(0.0)
+	, LinkFreeTime(0.0)
+{
+}
+
+FHttpRequestPtr FSimulatedHttpTransport::CreateRequest()
+{
+	return MakeShared<FSimulatedHttpRequest>(AsShared());
+}
+
+void FSimulatedHttpTransport::SetResponder(const FResponder& InResponder)
+{
+	Responder = InResponder;
+}
+
+void FSimulatedHttpTransport::Advance(double Seconds)
+{
+	AdvanceTo(Time + Seconds);
+}
+
+void FSimulatedHttpTransport::AdvanceTo(double Target)
+{
+	while (true)
+	{
+		int32 Next = INDEX_NONE;
+
+		// Ties end in the order they were sent
+		for (int32 i = 0; i < Pending.Num(); i++)
+		{
+			if (Pending[i].CompletionTime <= Target && (Next == INDEX_NONE || Pending[i].CompletionTime < Pending[Next].CompletionTime))
+			{
+				Next = i;
+			}
+		}
+
+		if (Next == INDEX_NONE)
+		{
+			break;
+		}
+
+		FPendingRequest Completed = MoveTemp(Pending[Next]);
+		Pending.RemoveAt(Next);
+		Time = FMath::Max(Time, Completed.CompletionTime);
+		Complete(Completed);
+	}
+
+	Time = FMath::Max(Time, Target);
+}
+
+double FSimulatedHttpTransport::GetTime() const
+{
+	return Time;
+}
+
+int32 FSimulatedHttpTransport::GetInFlightCount() const
+{
+	return Pending.Num();
+}
+
+double FSimulatedHttpTransport::GetNextCompletionTime() const
+{
+	double Next = 0.0;
+
+	for (const FPendingRequest& Request : Pending)
+	{
+		if (Request.CompletionTime < MAX_dbl && (Next == 0.0 || Request.CompletionTime < Next))
+		{
+			Next = Request.CompletionTime;
+		}
+	}
+
+	return Next;
+}
+
+const FSimulatedHttpTransport::FStats& FSimulatedHttpTransport::GetStats() const
+{
+	return Stats;
+}
+
+const FSimulatedHttpTransport::FConfig& FSimulatedHttpTransport::GetConfig() const
+{
+	return Config;
+}
+
+bool FSimulatedHttpTransport::Submit(const TSharedRef<FSimulatedHttpRequest>& Request)
+{
+	Stats.Sent++;
+	Stats.BytesSent += Request->GetContentLength();
+
+	// The same draws for every request, a fault rate changed in a run leaves the other draws as they were
+	double Latency = FMath::Max(0.0, Config.Latency.Sample(Random));
+	float FaultRoll = Random.GetFraction();
+	float StatusRoll = Random.GetFraction();
+
+	FPendingRequest Entry{ Request, 0.0, true, false, 200, TArray<uint8>() };
+	bool bIsAnswerLost = false;
+
+	if (Config.OverloadThreshold > 0 && Pending.Num() >= Config.OverloadThreshold)
+	{
+		Entry.ResponseCode = 503;
+		Stats.Overloaded++;
+	}
+	else if (FaultRoll < Config.ConnectionErrorRate)
+	{
+		Entry.bIsAnswered = false;
+	}
+	else if (FaultRoll < Config.ConnectionErrorRate + Config.NoResponseRate)
+	{
+		bIsAnswerLost = true;
+	}
+	else
+	{
+		float Cumulated = 0.0f;
+		bool bIsInjected = false;
+
+		for (const auto& Rate : Config.StatusRates)
+		{
+			Cumulated += Rate.Value;
+
+			if (StatusRoll < Cumulated)
+			{
+				Entry.ResponseCode = Rate.Key;
+				bIsInjected = true;
+
+				break;
+			}
+		}
+
+		if (!bIsInjected)
+		{
+			FString ResponseContent = TEXT("{}");
+			FHttpRequestPtr Answered = Request;
+			Entry.ResponseCode = Responder ? Responder(Answered, ResponseContent) : 200;
+			FTCHARToUTF8 Converted(*ResponseContent);
+			Entry.Content.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+		}
+	}
+
+	double TransferTime = 0.0;
+	double StartTime = Time;
+
+	if (Config.BandwidthBytesPerSecond > 0.0)
+	{
+		TransferTime = (Request->GetContentLength() + Entry.Content.Num()) / Config.BandwidthBytesPerSecond;
+		StartTime = FMath::Max(Time, LinkFreeTime);
+		LinkFreeTime = StartTime + TransferTime;
+	}
+
+	Entry.CompletionTime = bIsAnswerLost ? MAX_dbl : StartTime + TransferTime + Latency;
+
+	if (Config.Timeout > 0.0 && Entry.CompletionTime > Time + Config.Timeout)
+	{
+		Entry.CompletionTime = Time + Config.Timeout;
+		Entry.bIsAnswered = false;
+		Entry.bIsTimedOut = true;
+	}
+
+	Pending.Add(MoveTemp(Entry));
+
+	return true;
+}
+
+void FSimulatedHttpTransport::Cancel(FSimulatedHttpRequest& Request)
+{
+	int32 Index = Pending.IndexOfByPredicate([&Request](const FPendingRequest& Entry)
+	{
+		return &Entry.Request.Get() == &Request;
+	});
+
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	TSharedRef<FSimulatedHttpRequest> Cancelled = Pending[Index].Request;
+	Pending.RemoveAt(Index);
+	Stats.Cancelled++;
+	Cancelled->Finish(EHttpRequestStatus::Failed, 0, TArray<uint8>());
+}
+
+void FSimulatedHttpTransport::Complete(FPendingRequest& Completed)
+{
+	if (Completed.bIsAnswered)
+	{
+		Stats.Answered++;
+		Stats.BytesReceived += Completed.Content.Num();
+		Completed.Request->Finish(EHttpRequestStatus::Succeeded, Completed.ResponseCode, MoveTemp(Completed.Content));
+	}
+	else
+	{
+		if (Completed.bIsTimedOut)
+		{
+			Stats.TimedOut++;
+		}
+		else
+		{
+			Stats.ConnectionErrors++;
+		}
+
+		Completed.Request->Finish(EHttpRequestStatus::Failed_ConnectionError, 0, TArray<uint8>());
+	}
+}
+
+}
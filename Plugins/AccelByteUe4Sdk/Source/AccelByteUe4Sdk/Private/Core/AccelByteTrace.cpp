@@ -0,0 +1,244 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AccelByteTrace.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Hash/CityHash.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+namespace AccelByte
+{
+namespace Trace
+{
+	volatile bool bIsTraceEnabled = false;
+
+	static FCriticalSection Mutex;
+	static TArray<FEvent> Events;
+	/** Slot the next event is written to, the oldest event once the buffer has wrapped. */
+	static int32 NextEvent = 0;
+	static bool bIsWrapped = false;
+	static FThreadSafeCounter64 LastId;
+
+	static FString HitchDirectory;
+	static double HitchThreshold = 0.0;
+	static double HitchMinInterval = 0.0;
+	static double LastHitchDumpTime = -1.0;
+	/** Dump being serialized and written off the game thread. */
+	static TFuture<void> HitchDump;
+
+	void Enable(int32 Capacity)
+	{
+		FScopeLock Lock(&Mutex);
+		Events.Reset();
+		Events.SetNum(FMath::Max(1, Capacity));
+		NextEvent = 0;
+		bIsWrapped = false;
+		bIsTraceEnabled = true;
+	}
+
+	void Disable()
+	{
+		FScopeLock Lock(&Mutex);
+		bIsTraceEnabled = false;
+	}
+
+	uint64 AllocateId()
+	{
+		return static_cast<uint64>(LastId.Increment());
+	}
+
+	uint64 HashId(const FString& Key)
+	{
+		uint64 Hash = CityHash64(reinterpret_cast<const char*>(*Key), Key.Len() * sizeof(TCHAR));
+
+		// Allocated ids count up from 1, hashed ones keep the top bit so they never meet
+		return Hash | (1ULL << 63);
+	}
+
+	void Record(EPhase Phase, const TCHAR* Category, const TCHAR* Name, uint64 Id, const FString& Detail, uint64 Cycles, uint64 DurationCycles)
+	{
+		FEvent Event{ Category, Name, Id, Phase, FPlatformTLS::GetCurrentThreadId(), Cycles != 0 ? Cycles : FPlatformTime::Cycles64(), DurationCycles, Detail };
+		FScopeLock Lock(&Mutex);
+
+		// Disabled while this thread was on its way here
+		if (!bIsTraceEnabled || Events.Num() == 0)
+		{
+			return;
+		}
+
+		Events[NextEvent] = MoveTemp(Event);
+		NextEvent++;
+
+		if (NextEvent == Events.Num())
+		{
+			NextEvent = 0;
+			bIsWrapped = true;
+		}
+	}
+
+	TArray<FEvent> GetEvents()
+	{
+		FScopeLock Lock(&Mutex);
+		TArray<FEvent> Result;
+
+		if (bIsWrapped)
+		{
+			Result.Append(Events.GetData() + NextEvent, Events.Num() - NextEvent);
+		}
+
+		Result.Append(Events.GetData(), NextEvent);
+
+		return Result;
+	}
+
+	static const TCHAR* GetPhaseName(const FEvent& Event)
+	{
+		switch (Event.Phase)
+		{
+		case EPhase::Begin:
+			return TEXT("b");
+		case EPhase::End:
+			return TEXT("e");
+		case EPhase::Instant:
+			return Event.Id != 0 ? TEXT("n") : TEXT("i");
+		default:
+			return TEXT("X");
+		}
+	}
+
+	static FString ToJson(const TArray<FEvent>& Recorded)
+	{
+		double MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1000000.0;
+		int32 ProcessId = static_cast<int32>(FPlatformProcess::GetCurrentProcessId());
+
+		FString Json;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("displayTimeUnit"), FString(TEXT("ms")));
+		Writer->WriteArrayStart(TEXT("traceEvents"));
+
+		for (const FEvent& Event : Recorded)
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("name"), FString(Event.Name));
+			Writer->WriteValue(TEXT("cat"), FString(Event.Category));
+			Writer->WriteValue(TEXT("ph"), FString(GetPhaseName(Event)));
+			Writer->WriteValue(TEXT("ts"), Event.Cycles * MicrosecondsPerCycle);
+			Writer->WriteValue(TEXT("pid"), ProcessId);
+			Writer->WriteValue(TEXT("tid"), static_cast<int32>(Event.ThreadId));
+
+			if (Event.Phase == EPhase::Complete)
+			{
+				Writer->WriteValue(TEXT("dur"), Event.DurationCycles * MicrosecondsPerCycle);
+			}
+			else if (Event.Id != 0)
+			{
+				Writer->WriteValue(TEXT("id"), FString::Printf(TEXT("0x%llx"), Event.Id));
+			}
+			else
+			{
+				Writer->WriteValue(TEXT("s"), FString(TEXT("t")));
+			}
+
+			if (!Event.Detail.IsEmpty())
+			{
+				Writer->WriteObjectStart(TEXT("args"));
+				Writer->WriteValue(TEXT("detail"), Event.Detail);
+				Writer->WriteObjectEnd();
+			}
+
+			Writer->WriteObjectEnd();
+		}
+
+		Writer->WriteArrayEnd();
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		return Json;
+	}
+
+	FString ToJson()
+	{
+		return ToJson(GetEvents());
+	}
+
+	bool DumpToFile(const FString& Path)
+	{
+		return FFileHelper::SaveStringToFile(ToJson(), *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	void SetHitchDump(const FString& Directory, double Threshold, double MinInterval)
+	{
+		if (HitchDump.IsValid())
+		{
+			// The directory may be going away with the module
+			HitchDump.Wait();
+		}
+
+		HitchDirectory = Directory;
+		HitchThreshold = Threshold;
+		HitchMinInterval = MinInterval;
+	}
+
+	void OnFrame(float DeltaTime)
+	{
+		if (!IsEnabled() || HitchDirectory.IsEmpty() || DeltaTime <= HitchThreshold)
+		{
+			return;
+		}
+
+		double CurrentTime = FPlatformTime::Seconds();
+
+		if ((LastHitchDumpTime >= 0.0 && CurrentTime - LastHitchDumpTime < HitchMinInterval) || (HitchDump.IsValid() && !HitchDump.IsReady()))
+		{
+			return;
+		}
+
+		LastHitchDumpTime = CurrentTime;
+		FString Path = HitchDirectory / FString::Printf(TEXT("Hitch-%s.json"), *FDateTime::Now().ToString());
+		TArray<FEvent> Recorded = GetEvents();
+
+		// Only the copy is taken here, formatting and writing it would make the next frame a hitch of its own
+		HitchDump = Async<void>(EAsyncExecution::ThreadPool, [Path, Recorded = MoveTemp(Recorded)]()
+		{
+			FFileHelper::SaveStringToFile(ToJson(Recorded), *Path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+		});
+	}
+
+	static FString GetDefaultDumpPath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("AccelByte") / TEXT("Traces") / FString::Printf(TEXT("Trace-%s.json"), *FDateTime::Now().ToString());
+	}
+
+	static FAutoConsoleCommand StartCommand(
+		TEXT("AccelByte.Trace.Start"),
+		TEXT("Starts recording SDK events, optionally into a buffer of the given number of events."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			Enable(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : DefaultCapacity);
+		}));
+
+	static FAutoConsoleCommand StopCommand(
+		TEXT("AccelByte.Trace.Stop"),
+		TEXT("Stops recording SDK events."),
+		FConsoleCommandDelegate::CreateStatic(&Disable));
+
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("AccelByte.Trace.Dump"),
+		TEXT("Writes the recorded SDK events as Chrome trace JSON, to the given path or under Saved/AccelByte/Traces."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			DumpToFile(Args.Num() > 0 ? Args[0] : GetDefaultDumpPath());
+		}));
+}
+}
@@ -0,0 +1,230 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Benchmark.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Interfaces/IPluginManager.h"
+#include "Serialization/JsonWriter.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteBenchmark, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteBenchmark);
+
+FBenchmarkReport::FBenchmarkReport(const FString& InSuite)
+	: Suite(InSuite)
+	, StartTime(FDateTime::UtcNow())
+{
+}
+
+void FBenchmarkReport::Add(const FString& Name, const TMap<FString, int64>& Parameters, double Value, const FString& Unit)
+{
+	FString Description;
+
+	for (const TPair<FString, int64>& Parameter : Parameters)
+	{
+		Description += FString::Printf(TEXT(" %s=%lld"), *Parameter.Key, Parameter.Value);
+	}
+
+	UE_LOG(LogAccelByteBenchmark, Display, TEXT("%s.%s%s: %.3f %s"), *Suite, *Name, *Description, Value, *Unit);
+	Results.Add(FResult{ Name, Parameters, Value, Unit });
+}
+
+FString FBenchmarkReport::ToJson() const
+{
+	FString SdkVersion;
+	TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("AccelByteUe4Sdk"));
+
+	if (Plugin.IsValid())
+	{
+		SdkVersion = Plugin->GetDescriptor().VersionName;
+	}
+
+	FString Label;
+	FParse::Value(FCommandLine::Get(), TEXT("AccelByteBenchmarkLabel="), Label);
+
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("suite"), Suite);
+	Writer->WriteValue(TEXT("sdkVersion"), SdkVersion);
+	Writer->WriteValue(TEXT("engineVersion"), FEngineVersion::Current().ToString());
+	Writer->WriteValue(TEXT("platform"), FString(FPlatformProperties::IniPlatformName()));
+	Writer->WriteValue(TEXT("configuration"), FString(EBuildConfigurations::ToString(FApp::GetBuildConfiguration())));
+	Writer->WriteValue(TEXT("label"), Label);
+	Writer->WriteValue(TEXT("startedAt"), StartTime.ToIso8601());
+	Writer->WriteArrayStart(TEXT("results"));
+
+	for (const FResult& Result : Results)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("name"), Result.Name);
+		Writer->WriteObjectStart(TEXT("parameters"));
+
+		for (const TPair<FString, int64>& Parameter : Result.Parameters)
+		{
+			Writer->WriteValue(Parameter.Key, Parameter.Value);
+		}
+
+		Writer->WriteObjectEnd();
+		Writer->WriteValue(TEXT("value"), Result.Value);
+		Writer->WriteValue(TEXT("unit"), Result.Unit);
+		Writer->WriteObjectEnd();
+	}
+
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	return Json;
+}
+
+FString FBenchmarkReport::Write() const
+{
+	FString Directory = FPaths::ProjectSavedDir() / TEXT("AccelByteBenchmarks");
+	FParse::Value(FCommandLine::Get(), TEXT("AccelByteBenchmarkDir="), Directory);
+	FString Path = Directory / FString::Printf(TEXT("%s-%s.json"), *Suite, *StartTime.ToString(TEXT("%Y%m%d-%H%M%S")));
+
+	if (!FFileHelper::SaveStringToFile(ToJson(), *Path))
+	{
+		UE_LOG(LogAccelByteBenchmark, Warning, TEXT("Cannot write the %s report to %s"), *Suite, *Path);
+
+		return FString();
+	}
+
+	UE_LOG(LogAccelByteBenchmark, Display, TEXT("%s report written to %s"), *Suite, *Path);
+
+	return Path;
+}
+
+double FBenchmarkReport::Median(TArray<double> Samples)
+{
+	if (Samples.Num() == 0)
+	{
+		return 0.0;
+	}
+
+	Samples.Sort();
+
+	return Samples[Samples.Num() / 2];
+}
+
+namespace
+{
+	/** Forwards to the allocator it stands in front of; it is never destroyed since a thread may still be inside it after GMalloc is restored. */
+	class FCountingMalloc : public FMalloc
+	{
+	public:
+		void Begin(FMalloc* InInner)
+		{
+			Inner = InInner;
+			AllocationCount = 0;
+			LiveBytes = 0;
+			PeakBytes = 0;
+			bCanSize = true;
+		}
+
+		void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			void* Result = Inner->Malloc(Count, Alignment);
+			FPlatformAtomics::InterlockedIncrement(&AllocationCount);
+			AddLiveBytes(GetSize(Result));
+
+			return Result;
+		}
+
+		void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			int64 OriginalSize = GetSize(Original);
+			void* Result = Inner->Realloc(Original, Count, Alignment);
+
+			if (Count > 0)
+			{
+				FPlatformAtomics::InterlockedIncrement(&AllocationCount);
+			}
+
+			AddLiveBytes(GetSize(Result) - OriginalSize);
+
+			return Result;
+		}
+
+		void Free(void* Original) override
+		{
+			AddLiveBytes(-GetSize(Original));
+			Inner->Free(Original);
+		}
+
+		SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		void Trim() override { Inner->Trim(); }
+		void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+		void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+
+		FMalloc* Inner = nullptr;
+		volatile int64 AllocationCount = 0;
+		volatile int64 LiveBytes = 0;
+		volatile int64 PeakBytes = 0;
+		bool bCanSize = true;
+
+	private:
+		int64 GetSize(void* Original)
+		{
+			SIZE_T Size = 0;
+
+			if (Original != nullptr && !Inner->GetAllocationSize(Original, Size))
+			{
+				bCanSize = false;
+			}
+
+			return static_cast<int64>(Size);
+		}
+
+		void AddLiveBytes(int64 Delta)
+		{
+			int64 Live = FPlatformAtomics::InterlockedAdd(&LiveBytes, Delta) + Delta;
+			int64 Peak = PeakBytes;
+
+			while (Live > Peak && FPlatformAtomics::InterlockedCompareExchange(&PeakBytes, Live, Peak) != Peak)
+			{
+				Peak = PeakBytes;
+			}
+		}
+	};
+
+	FCountingMalloc& GetCountingMalloc()
+	{
+		static FCountingMalloc* CountingMalloc = new FCountingMalloc();
+
+		return *CountingMalloc;
+	}
+}
+
+FBenchmarkAllocationScope::FBenchmarkAllocationScope()
+{
+	check(IsInGameThread() && GMalloc != &GetCountingMalloc());
+	GetCountingMalloc().Begin(GMalloc);
+	GMalloc = &GetCountingMalloc();
+}
+
+FBenchmarkAllocationScope::~FBenchmarkAllocationScope()
+{
+	GMalloc = GetCountingMalloc().Inner;
+}
+
+int64 FBenchmarkAllocationScope::GetAllocationCount() const
+{
+	return GetCountingMalloc().AllocationCount;
+}
+
+int64 FBenchmarkAllocationScope::GetPeakBytes() const
+{
+	return GetCountingMalloc().bCanSize ? GetCountingMalloc().PeakBytes : 0;
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AutomationTest.h"
+
+/** Benchmarks are left out of the product test runs. */
+static const int32 AutomationFlagMaskBenchmark = (EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ClientContext);
+
+/**
+ * @brief Results of one benchmark suite, written as JSON so that runs of different SDK versions can be compared by a script.
+ * Benchmarks are the automation tests under AccelByte.Benchmarks, headless they run with
+ * -ExecCmds="Automation RunTests AccelByte.Benchmarks; Quit" -unattended -nullrhi.
+ * Reports go to Saved/AccelByteBenchmarks, or to -AccelByteBenchmarkDir=, and carry -AccelByteBenchmarkLabel=, e.g. the commit measured.
+ */
+class FBenchmarkReport
+{
+public:
+	explicit FBenchmarkReport(const FString& Suite);
+
+	/**
+	 * @brief Adds one measurement and logs it, e.g. Add(TEXT("PollRetry.Idle"), { { TEXT("tasks"), 1000 } }, 35.2, TEXT("ns/op")).
+	 */
+	void Add(const FString& Name, const TMap<FString, int64>& Parameters, double Value, const FString& Unit);
+
+	FString ToJson() const;
+	/** Writes <Suite>-<UTC time>.json, returns its path or an empty string on failure. */
+	FString Write() const;
+
+	static double Median(TArray<double> Samples);
+
+private:
+	struct FResult
+	{
+		FString Name;
+		TMap<FString, int64> Parameters;
+		double Value;
+		FString Unit;
+	};
+
+	FString Suite;
+	FDateTime StartTime;
+	TArray<FResult> Results;
+};
+
+/**
+ * @brief Counts the allocations made while it is in scope by putting a forwarding allocator in front of GMalloc, e.g. around one decode.
+ * Allocations of other threads are counted too, and the forwarding is slower, so time the code outside of the scope. Scopes don't nest.
+ */
+class FBenchmarkAllocationScope
+{
+public:
+	FBenchmarkAllocationScope();
+	~FBenchmarkAllocationScope();
+
+	int64 GetAllocationCount() const;
+	/** Most bytes allocated and not yet freed at once since the scope began; 0 when the allocator can't size its blocks. */
+	int64 GetPeakBytes() const;
+};
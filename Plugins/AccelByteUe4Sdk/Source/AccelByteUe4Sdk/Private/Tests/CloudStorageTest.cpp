@@ -41,6 +41,8 @@ const auto CloudStorageErrorHandler = FErrorHandler::CreateLambda([](int32 Error
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(CloudStorageSetup, "AccelByte.Tests.CloudStorage.A.Setup", AutomationFlagMaskCloudStorage);
 bool CloudStorageSetup::RunTest(const FString& Parameters)
 {
+	UseLocalBackendIfRequested();
+
 	bool bClientLoginResult = false;
 	User::LoginWithClientCredentials(FVoidHandler::CreateLambda([&bClientLoginResult]()
 	{
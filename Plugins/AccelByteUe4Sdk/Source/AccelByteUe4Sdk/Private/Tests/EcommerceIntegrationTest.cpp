@@ -14,6 +14,7 @@
 #include "AccelByteRegistry.h"
 #include "FileManager.h"
 #include "AccelByteUserApi.h"
+#include "LocalBackend.h"
 
 using AccelByte::FErrorHandler;
 using AccelByte::Credentials;
@@ -33,6 +34,7 @@ DECLARE_DELEGATE(FEcommerceUserInitializationFail);
 DECLARE_DELEGATE(FDeleteUserByIdSuccess);
 static void DeleteUserByIdLobby(const FString& UserID, const FDeleteUserByIdSuccess& OnSuccess, const FErrorHandler& OnError);
 void FlushHttpRequests();//defined in TestUtilities.cpp
+bool UseLocalBackendIfRequested();//defined in TestUtilities.cpp
 
 const int32 AutomationFlagMaskEcommerce = (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ClientContext);
 FString EcommerceUserEmail;
@@ -607,21 +609,34 @@ bool EcommerceQueryUserEntitlement::RunTest(const FString& Parameters)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(EcommerceSetup, "AccelByte.Tests.Ecommerce.A.Setup", AutomationFlagMaskEcommerce);
 bool EcommerceSetup::RunTest(const FString& Parameters)
 {
-	FString TestVariableFileContent = TEXT("");
-	FString CurrentDirectory = IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*FPaths::ProjectDir());
-	CurrentDirectory.Append(TEXT("TestUtilities/EcommerceVariables.txt"));
-	CurrentDirectory.Replace(TEXT("/"), TEXT("\\"));
-	FFileHelper::LoadFileToString(TestVariableFileContent, *CurrentDirectory);
-	TArray<FString> TestVariables;
-	TestVariableFileContent.ParseIntoArray(TestVariables, TEXT("___"), false);
-	ExpectedRootCategoryPath = TestVariables[0];
-	ExpectedChildCategoryPath = TestVariables[1];
-	ExpectedGrandChildCategoryPath = TestVariables[2];
-	EcommerceUserEmail = TestVariables[3];
-	EcommerceUserPassword = TestVariables[4];
-	ExpectedCurrencyCode = TestVariables[5];
-	ExpectedRootItemTitle = TestVariables[6];
-	ExpectedChildItemTitle = TestVariables[7];
+	if (UseLocalBackendIfRequested())
+	{
+		// The catalog the local backend is seeded with
+		ExpectedRootCategoryPath = TEXT("/game");
+		ExpectedChildCategoryPath = TEXT("/game/items");
+		ExpectedGrandChildCategoryPath = TEXT("/game/items/bundles");
+		ExpectedCurrencyCode = FLocalBackend::FConfig().CurrencyCode;
+		ExpectedRootItemTitle = TEXT("Item 3");
+		ExpectedChildItemTitle = TEXT("Item 4");
+	}
+	else
+	{
+		FString TestVariableFileContent = TEXT("");
+		FString CurrentDirectory = IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*FPaths::ProjectDir());
+		CurrentDirectory.Append(TEXT("TestUtilities/EcommerceVariables.txt"));
+		CurrentDirectory.Replace(TEXT("/"), TEXT("\\"));
+		FFileHelper::LoadFileToString(TestVariableFileContent, *CurrentDirectory);
+		TArray<FString> TestVariables;
+		TestVariableFileContent.ParseIntoArray(TestVariables, TEXT("___"), false);
+		ExpectedRootCategoryPath = TestVariables[0];
+		ExpectedChildCategoryPath = TestVariables[1];
+		ExpectedGrandChildCategoryPath = TestVariables[2];
+		EcommerceUserEmail = TestVariables[3];
+		EcommerceUserPassword = TestVariables[4];
+		ExpectedCurrencyCode = TestVariables[5];
+		ExpectedRootItemTitle = TestVariables[6];
+		ExpectedChildItemTitle = TestVariables[7];
+	}
 
 	double LastTime = 0;
 	bool bClientTokenObtained = false;
@@ -51,6 +51,8 @@ FAccelByteModelsGameProfileRequest GenerateGameProfileRequest(int32 AttributesLe
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(GameProfileSetup, "AccelByte.Tests.GameProfile.A.Setup", AutomationFlagMaskGameProfile);
 bool GameProfileSetup::RunTest(const FString& Parameters)
 {
+	UseLocalBackendIfRequested();
+
 	bool bClientLoginSuccess = false;
 	bool UsersCreationSuccess[GameProfileTestUserCount];
 	bool UsersLoginSuccess[GameProfileTestUserCount];
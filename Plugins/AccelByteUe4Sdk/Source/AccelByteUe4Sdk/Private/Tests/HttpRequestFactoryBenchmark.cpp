@@ -0,0 +1,89 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AutomationTest.h"
+#include "AccelByteHttpRequestFactory.h"
+#include "Core/AccelByteEndpoints.h"
+#include "Benchmark.h"
+
+using AccelByte::Credentials;
+using AccelByte::Settings;
+using AccelByte::FHttpRequestFactory;
+using AccelByte::FHttpQuery;
+
+namespace
+{
+	const int32 CreateCount = 10000;
+	const int32 BatchCount = 5;
+
+	/** Median time of one Create, then the allocations of one Create once the Authorization header is cached. */
+	void BenchmarkCreate(FBenchmarkReport& Report, const FString& Name, const TFunction<FHttpRequestPtr()>& Create)
+	{
+		Create();
+		TArray<double> Costs;
+
+		for (int32 Batch = 0; Batch < BatchCount; Batch++)
+		{
+			double StartTime = FPlatformTime::Seconds();
+
+			for (int32 i = 0; i < CreateCount; i++)
+			{
+				Create();
+			}
+
+			Costs.Add((FPlatformTime::Seconds() - StartTime) / CreateCount);
+		}
+
+		int64 AllocationCount = 0;
+		{
+			FBenchmarkAllocationScope Allocations;
+			{
+				FHttpRequestPtr Request = Create();
+			}
+			AllocationCount = Allocations.GetAllocationCount();
+		}
+
+		TMap<FString, int64> Parameters;
+		Report.Add(Name, Parameters, FBenchmarkReport::Median(Costs) * 1e9, TEXT("ns/op"));
+		Report.Add(Name + TEXT(".Allocations"), Parameters, static_cast<double>(AllocationCount), TEXT("allocations"));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HttpRequestFactoryBenchmarkCreate, "AccelByte.Benchmarks.HttpRequestFactory.Create", AutomationFlagMaskBenchmark);
+bool HttpRequestFactoryBenchmarkCreate::RunTest(const FString& Parameters)
+{
+	FBenchmarkReport Report(TEXT("HttpRequestFactory"));
+	Settings BenchmarkSettings;
+	BenchmarkSettings.ClientId = TEXT("client");
+	BenchmarkSettings.ClientSecret = TEXT("secret");
+	BenchmarkSettings.Namespace = TEXT("game");
+	BenchmarkSettings.PlatformServerUrl = TEXT("https://example.accelbyte.io/platform");
+	BenchmarkSettings.BasicServerUrl = TEXT("https://example.accelbyte.io/basic");
+	Credentials BenchmarkCredentials;
+	BenchmarkCredentials.SetClientToken(TEXT("client-token"), 0.0, TEXT("publisher"));
+	BenchmarkCredentials.SetUserToken(TEXT("user-token"), TEXT("refresh-token"), 0.0, TEXT("user01"), TEXT("User"), TEXT("studio"));
+	FHttpRequestFactory Factory(BenchmarkSettings, BenchmarkCredentials);
+	FString OrderNo = TEXT("order01");
+	FString Content = TEXT("{\"firstName\":\"First\",\"lastName\":\"Last\",\"language\":\"en\"}");
+
+	BenchmarkCreate(Report, TEXT("Create.Get"), [&]()
+	{
+		return Factory.Create(AccelByte::Endpoints::Order::GetUserOrder, { *OrderNo });
+	});
+	BenchmarkCreate(Report, TEXT("Create.GetWithQuery"), [&]()
+	{
+		return Factory.Create(AccelByte::Endpoints::Order::GetUserOrders, {}, FHttpQuery().Add(TEXT("page"), 0).Add(TEXT("size"), 20));
+	});
+	BenchmarkCreate(Report, TEXT("Create.PostWithContent"), [&]()
+	{
+		FHttpRequestPtr Request = Factory.Create(AccelByte::Endpoints::UserProfile::CreateUserProfile);
+		Factory.SetContent(Request, AccelByte::Endpoints::UserProfile::CreateUserProfile, Content);
+
+		return Request;
+	});
+
+	check(!Report.Write().IsEmpty());
+
+	return true;
+}
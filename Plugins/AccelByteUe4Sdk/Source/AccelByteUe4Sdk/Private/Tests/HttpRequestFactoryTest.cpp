@@ -0,0 +1,195 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AutomationTest.h"
+#include "HttpModule.h"
+#include "Base64.h"
+
+#include "AccelByteHttpRequestFactory.h"
+#include "AccelByteHttpCompression.h"
+#include "AccelByteError.h"
+#include "Core/AccelByteEndpoints.h"
+
+using AccelByte::Credentials;
+using AccelByte::Settings;
+using AccelByte::FHttpRequestFactory;
+using AccelByte::FHttpQuery;
+using AccelByte::FHttpEndpoint;
+using AccelByte::EHttpService;
+using AccelByte::EHttpAuthorization;
+namespace HttpCompression = AccelByte::HttpCompression;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteHttpRequestFactoryTest, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteHttpRequestFactoryTest);
+
+static const int32 AutomationFlagMaskHttpRequestFactory = (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ClientContext);
+
+static void SetupFactoryTest(Settings& TestSettings, Credentials& TestCredentials)
+{
+	TestSettings.ClientId = TEXT("client");
+	TestSettings.ClientSecret = TEXT("secret");
+	TestSettings.Namespace = TEXT("game");
+	TestSettings.IamServerUrl = TEXT("https://example.accelbyte.io/iam");
+	TestSettings.PlatformServerUrl = TEXT("https://example.accelbyte.io/platform");
+	TestSettings.BasicServerUrl = TEXT("https://example.accelbyte.io/basic");
+	TestSettings.CloudStorageServerUrl = TEXT("https://example.accelbyte.io/binary-store");
+	TestSettings.GameProfileServerUrl = TEXT("https://example.accelbyte.io/soc-profile");
+	TestCredentials.SetClientToken(TEXT("client-token"), 0.0, TEXT("publisher"));
+	TestCredentials.SetUserToken(TEXT("user-token"), TEXT("refresh-token"), 0.0, TEXT("user01"), TEXT("User"), TEXT("studio"));
+}
+
+/**
+ * @brief Response as a platform that does not decode Content-Encoding hands it over.
+ */
+class FEncodedHttpResponse : public IHttpResponse
+{
+public:
+	FEncodedHttpResponse(const FString& Encoding, const TArray<uint8>& Content) : Encoding(Encoding), Content(Content) {}
+
+	FString GetURL() override { return FString(); }
+	FString GetURLParameter(const FString& ParameterName) override { return FString(); }
+	FString GetHeader(const FString& HeaderName) override { return HeaderName == TEXT("Content-Encoding") ? Encoding : FString(); }
+	TArray<FString> GetAllHeaders() override { return { TEXT("Content-Encoding: ") + Encoding }; }
+	FString GetContentType() override { return TEXT("application/json"); }
+	int32 GetContentLength() override { return Content.Num(); }
+	const TArray<uint8>& GetContent() override { return Content; }
+	int32 GetResponseCode() override { return EHttpResponseCodes::Ok; }
+	FString GetContentAsString() override { return FString(); }
+
+private:
+	FString Encoding;
+	TArray<uint8> Content;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(CreateUrl_Placeholders_FilledFromCredentialsAndSettings, "AccelByte.Tests.Core.HttpRequestFactory.CreateUrl_Placeholders_FilledFromCredentialsAndSettings", AutomationFlagMaskHttpRequestFactory);
+bool CreateUrl_Placeholders_FilledFromCredentialsAndSettings::RunTest(const FString& Parameters)
+{
+	Settings TestSettings;
+	Credentials TestCredentials;
+	SetupFactoryTest(TestSettings, TestCredentials);
+	FHttpRequestFactory Factory(TestSettings, TestCredentials);
+
+	FString OrderUrl = Factory.CreateUrl(AccelByte::Endpoints::Order::GetUserOrderHistory, { TEXT("order01") });
+	FString ItemsUrl = Factory.CreateUrl(AccelByte::Endpoints::Item::GetItemsByCriteria, {}, FHttpQuery().AddRequired(TEXT("categoryPath"), FString()).AddRequired(TEXT("region"), TEXT("US")).Add(TEXT("language"), FString()).Add(TEXT("page"), 2));
+	FString LinkUrl = Factory.CreateUrl(AccelByte::Endpoints::User::LinkOtherPlatform, { TEXT("steam") });
+	FString AttributeUrl = Factory.CreateUrl(AccelByte::Endpoints::GameProfile::GetGameProfileAttribute, { TEXT("profile01"), TEXT("level") });
+
+	check(OrderUrl == TEXT("https://example.accelbyte.io/platform/public/namespaces/studio/users/user01/orders/order01/history"));
+	check(ItemsUrl == TEXT("https://example.accelbyte.io/platform/public/namespaces/game/items/byCriteria?categoryPath=&region=US&page=2"));
+	check(LinkUrl == TEXT("https://example.accelbyte.io/iam/namespaces/publisher/users/user01/platforms/steam/link"));
+	check(AttributeUrl == TEXT("https://example.accelbyte.io/soc-profile/public/namespaces/studio/users/user01/profiles/profile01/attributes/level"));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(Create_GetEndpoint_NoContentTypeAndCachedAuthorization, "AccelByte.Tests.Core.HttpRequestFactory.Create_GetEndpoint_NoContentTypeAndCachedAuthorization", AutomationFlagMaskHttpRequestFactory);
+bool Create_GetEndpoint_NoContentTypeAndCachedAuthorization::RunTest(const FString& Parameters)
+{
+	Settings TestSettings;
+	Credentials TestCredentials;
+	SetupFactoryTest(TestSettings, TestCredentials);
+	FHttpRequestFactory Factory(TestSettings, TestCredentials);
+
+	FHttpRequestPtr GetRequest = Factory.Create(AccelByte::Endpoints::Wallet::GetWalletInfoByCurrencyCode, { TEXT("GOLD") });
+	FHttpRequestPtr PostRequest = Factory.Create(AccelByte::Endpoints::User::Register);
+	FHttpRequestPtr BasicRequest = Factory.Create(AccelByte::Endpoints::User::ResetPassword);
+	FHttpRequestPtr TokenRequest = Factory.Create(AccelByte::Endpoints::Oauth2::Token);
+
+	check(GetRequest->GetVerb() == TEXT("GET"));
+	check(GetRequest->GetHeader(TEXT("Authorization")) == TEXT("Bearer user-token"));
+	check(GetRequest->GetHeader(TEXT("Content-Type")).IsEmpty());
+	check(GetRequest->GetHeader(TEXT("Accept")) == TEXT("application/json"));
+	check(GetRequest->GetHeader(TEXT("Accept-Encoding")) == TEXT("gzip, deflate"));
+	check(GetRequest->GetContentLength() == 0);
+	check(PostRequest->GetHeader(TEXT("Authorization")) == TEXT("Bearer client-token"));
+	check(PostRequest->GetHeader(TEXT("Content-Type")) == TEXT("application/json"));
+	check(BasicRequest->GetHeader(TEXT("Authorization")) == TEXT("Basic ") + FBase64::Encode(TEXT("client:secret")));
+	check(TokenRequest->GetHeader(TEXT("Authorization")).IsEmpty());
+	check(TokenRequest->GetHeader(TEXT("Content-Type")) == TEXT("application/x-www-form-urlencoded"));
+
+	const FString* FirstHeader = &Factory.GetBasicAuthorization(TEXT("client"), TEXT("secret"));
+	const FString* SecondHeader = &Factory.GetBasicAuthorization(TEXT("client"), TEXT("secret"));
+	check(FirstHeader == SecondHeader);
+	check(Factory.GetBasicAuthorization(TEXT("other"), TEXT("secret")) == TEXT("Basic ") + FBase64::Encode(TEXT("other:secret")));
+
+	TestCredentials.SetUserToken(TEXT("new-user-token"), TEXT("refresh-token"), 0.0, TEXT("user01"), TEXT("User"), TEXT("studio"));
+	FHttpRequestPtr RefreshedRequest = Factory.Create(AccelByte::Endpoints::Wallet::GetWalletInfoByCurrencyCode, { TEXT("GOLD") });
+
+	check(RefreshedRequest->GetHeader(TEXT("Authorization")) == TEXT("Bearer new-user-token"));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(SetContent_LargeBody_GzipEncodedAndDecodedBack, "AccelByte.Tests.Core.HttpRequestFactory.SetContent_LargeBody_GzipEncodedAndDecodedBack", AutomationFlagMaskHttpRequestFactory);
+bool SetContent_LargeBody_GzipEncodedAndDecodedBack::RunTest(const FString& Parameters)
+{
+	Settings TestSettings;
+	Credentials TestCredentials;
+	SetupFactoryTest(TestSettings, TestCredentials);
+	FHttpRequestFactory Factory(TestSettings, TestCredentials);
+	HttpCompression::FCompressionStats StatsBefore = HttpCompression::GetStats();
+
+	FString LargeContent = TEXT("{\"attributes\":{");
+
+	for (int32 i = 0; i < 100; i++)
+	{
+		LargeContent += FString::Printf(TEXT("%s\"attribute%d\":\"value\""), i == 0 ? TEXT("") : TEXT(","), i);
+	}
+
+	LargeContent += TEXT("}}");
+	FString SmallContent = TEXT("{\"label\":\"small\"}");
+	const FHttpEndpoint OptedOut{ TEXT("PUT"), EHttpService::Basic, TEXT("/public/namespaces/{namespace}/users/me/profiles"), EHttpAuthorization::User, AccelByte::Endpoints::Json, TEXT("application/json"), false };
+
+	FHttpRequestPtr LargeRequest = Factory.Create(AccelByte::Endpoints::GameProfile::UpdateGameProfile, { TEXT("profile01") });
+	Factory.SetContent(LargeRequest, AccelByte::Endpoints::GameProfile::UpdateGameProfile, LargeContent);
+	FHttpRequestPtr SmallRequest = Factory.Create(AccelByte::Endpoints::UserProfile::UpdateUserProfile);
+	Factory.SetContent(SmallRequest, AccelByte::Endpoints::UserProfile::UpdateUserProfile, SmallContent);
+	FHttpRequestPtr OptedOutRequest = Factory.Create(OptedOut);
+	Factory.SetContent(OptedOutRequest, OptedOut, LargeContent);
+
+	check(LargeRequest->GetHeader(TEXT("Content-Encoding")) == TEXT("gzip"));
+	check(LargeRequest->GetContentLength() < LargeContent.Len());
+	check(SmallRequest->GetHeader(TEXT("Content-Encoding")).IsEmpty());
+	check(SmallRequest->GetContentLength() == SmallContent.Len());
+	check(OptedOutRequest->GetHeader(TEXT("Content-Encoding")).IsEmpty());
+	check(OptedOutRequest->GetContentLength() == LargeContent.Len());
+
+	// The same gzip stream read back as a response
+	FHttpResponsePtr Encoded = MakeShared<FEncodedHttpResponse, ESPMode::ThreadSafe>(TEXT("gzip"), LargeRequest->GetContent());
+	FHttpResponsePtr Decoded = HttpCompression::Decompress(Encoded);
+	check(Decoded != Encoded);
+	check(Decoded->GetContentAsString() == LargeContent);
+	check(Decoded->GetHeader(TEXT("Content-Encoding")).IsEmpty());
+
+	// Already decoded by the platform, handed over untouched
+	FTCHARToUTF8 Plain(*SmallContent);
+	FHttpResponsePtr PlatformDecoded = MakeShared<FEncodedHttpResponse, ESPMode::ThreadSafe>(TEXT("gzip"), TArray<uint8>(reinterpret_cast<const uint8*>(Plain.Get()), Plain.Length()));
+	check(HttpCompression::Decompress(PlatformDecoded) == PlatformDecoded);
+
+	HttpCompression::FCompressionStats Stats = HttpCompression::GetStats();
+	check(Stats.CompressedRequests == StatsBefore.CompressedRequests + 1);
+	check(Stats.RequestBytesSaved == StatsBefore.RequestBytesSaved + LargeContent.Len() - LargeRequest->GetContentLength());
+	check(Stats.DecompressedResponses == StatsBefore.DecompressedResponses + 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(Decompress_BodyOverCap_ReportedAsError, "AccelByte.Tests.Core.HttpRequestFactory.Decompress_BodyOverCap_ReportedAsError", AutomationFlagMaskHttpRequestFactory);
+bool Decompress_BodyOverCap_ReportedAsError::RunTest(const FString& Parameters)
+{
+	// Some 64 kilobytes on the wire that would inflate past 64 megabytes
+	TArray<uint8> Zeros;
+	Zeros.SetNumZeroed(65 * 1024 * 1024);
+	TArray<uint8> Compressed;
+	check(HttpCompression::Compress(Zeros.GetData(), Zeros.Num(), Compressed));
+	Zeros.Empty();
+
+	FHttpResponsePtr Encoded = MakeShared<FEncodedHttpResponse, ESPMode::ThreadSafe>(TEXT("gzip"), Compressed);
+	FHttpResponsePtr Decoded = HttpCompression::Decompress(Encoded);
+	check(Decoded != Encoded);
+	check(Decoded->GetResponseCode() == EHttpResponseCodes::BadGateway);
+	check(Decoded->GetContentAsString().Contains(FString::FromInt(static_cast<int32>(AccelByte::ErrorCodes::ResponseTooLarge))));
+
+	return true;
+}
@@ -11,16 +11,25 @@
 
 #include "AutomationTest.h"
 #include "FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "HttpModule.h"
 #include "HttpManager.h"
 #include "Runtime/Core/Public/Containers/Ticker.h"
 
+#include "AccelByteHttpCompression.h"
 #include "AccelByteHttpRetryScheduler.h"
+#include "AccelByteHttpWorker.h"
 #include "AccelByteOrderApi.h"
 #include "AccelByteRegistry.h"
+#include "AccelByteSimulatedHttpTransport.h"
+#include "AccelByteTrace.h"
 #include "AccelByteUserApi.h"
 #include "AccelByteUserProfileApi.h"
 #include "AccelByteUserProfileModels.h"
+#include "MockHttp.h"
 
 using AccelByte::FErrorHandler;
 using AccelByte::Credentials;
@@ -29,108 +38,12 @@ using AccelByte::HandleHttpError;
 using AccelByte::Api::User;
 using AccelByte::Api::UserProfile;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteHttpRetryTest, Log, All);
 DEFINE_LOG_CATEGORY(LogAccelByteHttpRetryTest);
 
 static const int32 AutomationFlagMaskHttpRetry = (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ClientContext);
 
 using namespace std;
 
-class MockHttpResponse : public IHttpResponse
-{
-public:
-	FString GetURL() override { return TEXT(""); };
-	FString GetURLParameter(const FString& ParameterName) override { return TEXT(""); };
-	FString GetHeader(const FString& HeaderName) override { return TEXT(""); };
-	TArray<FString> GetAllHeaders() override { return Headers; };
-	FString GetContentType() override { return TEXT(""); };
-	int32 GetContentLength() override { return 0; };
-	const TArray<uint8>& GetContent() override { return Content; };
-
-	int32 GetResponseCode() override { return ResponseCode; }
-	FString GetContentAsString() override { return FString(); }
-	
-	void SetResponseCode(int32 ResponseCode) { this->ResponseCode = ResponseCode; }
-
-private:
-	int32 ResponseCode;
-	TArray<FString> Headers;
-	TArray<uint8> Content;
-};
-
-class MockHttpRequest : public IHttpRequest
-{
-public:
-	FString GetURL() override { return TEXT(""); };
-	FString GetURLParameter(const FString& ParameterName) override { return TEXT(""); };
-	FString GetHeader(const FString& HeaderName) override { return TEXT(""); };
-	TArray<FString> GetAllHeaders() override { return Headers; };
-	FString GetContentType() override { return TEXT(""); };
-	int32 GetContentLength() override { return 0; };
-	const TArray<uint8>& GetContent() override { return Content; };
-
-	FString GetVerb() override { return TEXT(""); };
-	void SetVerb(const FString& Verb) override {};
-	void SetURL(const FString& URL) override {};
-	void SetContent(const TArray<uint8>& ContentPayload) override {};
-	void SetContentAsString(const FString& ContentString) override {};
-	void SetHeader(const FString& HeaderName, const FString& HeaderValue) override {};
-	void AppendToHeader(const FString& HeaderName, const FString& AdditionalHeaderValue) override {};
-	
-	bool ProcessRequest() override 
-	{
-		UE_LOG(LogAccelByteHttpRetryTest, Log, TEXT("Process Request"));
-		Status = EHttpRequestStatus::Processing;
-		++RetryCount;
-		
-		return true; 
-	};
-	
-	FHttpRequestCompleteDelegate& OnProcessRequestComplete() override { return RequestCompleteDelegate; };
-	FHttpRequestProgressDelegate& OnRequestProgress() override { return RequestProgressDelegate; };
-	
-	void CancelRequest() override 
-	{
-		UE_LOG(LogAccelByteHttpRetryTest, Log, TEXT("Cancel Request"));
-		SetStatus(EHttpRequestStatus::Failed_ConnectionError);
-	};
-	
-	EHttpRequestStatus::Type GetStatus() override { return Status; };
-	const FHttpResponsePtr GetResponse() const override { return Response; };
-	
-	void Tick(float DeltaSeconds) override 
-	{
-		if (Status != EHttpRequestStatus::Processing && Status != EHttpRequestStatus::NotStarted)
-		{
-			OnProcessRequestComplete().ExecuteIfBound(MakeShareable(this), Response, true);
-		}
-	}
-	
-	float GetElapsedTime() override { return 0.0; }
-
-	void SetStatus(EHttpRequestStatus::Type Status) { this->Status = Status; }
-
-	MockHttpRequest() 
-		: Response(MakeShared<MockHttpResponse, ESPMode::ThreadSafe>())
-		, RetryCount(0) 
-	{
-	}
-
-public:
-	int32 RetryCount;
-
-private:
-	TArray<FString> Headers;
-	TArray<uint8> Content;
-
-	EHttpRequestStatus::Type Status;
-	TSharedPtr<MockHttpResponse, ESPMode::ThreadSafe> Response;
-	FHttpRequestCompleteDelegate RequestCompleteDelegate;
-	FHttpRequestProgressDelegate RequestProgressDelegate;
-};
-
-
-
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_GotError500_Retries, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_GotError500_Retries", AutomationFlagMaskHttpRetry);
 bool ProcessRequest_GotError500_Retries::RunTest(const FString& Parameter)
 {	
@@ -185,15 +98,15 @@ bool ProcessRequest_GotError500_Retries::RunTest(const FString& Parameter)
 	Ticker.Tick(0.2);
 	check(!RequestCompleted);
 
-	Request->SetStatus(EHttpRequestStatus::Succeeded);
 	Response->SetResponseCode(500);
+	Request->SetStatus(EHttpRequestStatus::Succeeded);
 	
 	CurrentTime += 0.2;
 	Ticker.Tick(0.2);
 	check(!RequestCompleted);
 
-	Request->SetStatus(EHttpRequestStatus::Succeeded);
 	Response->SetResponseCode(200);
+	Request->SetStatus(EHttpRequestStatus::Succeeded);
 
 	CurrentTime += 0.3;
 	Ticker.Tick(0.3);
@@ -257,22 +170,22 @@ bool ProcessRequest_GotError500Twice_RetryTwice::RunTest(const FString& Paramete
 	Ticker.Tick(0.21);
 	check(!RequestCompleted);
 
-	Request->SetStatus(EHttpRequestStatus::Succeeded);
 	Response->SetResponseCode(500);
+	Request->SetStatus(EHttpRequestStatus::Succeeded);
 
 	CurrentTime += 0.21;
 	Ticker.Tick(0.21);
 	check(!RequestCompleted);
 
-	Request->SetStatus(EHttpRequestStatus::Succeeded);
 	Response->SetResponseCode(502);
+	Request->SetStatus(EHttpRequestStatus::Succeeded);
 
 	CurrentTime += 0.21;
 	Ticker.Tick(0.21);
 	check(!RequestCompleted);
 
-	Request->SetStatus(EHttpRequestStatus::Succeeded);
 	Response->SetResponseCode(200);
+	Request->SetStatus(EHttpRequestStatus::Succeeded);
 
 	CurrentTime += 0.21;
 	Ticker.Tick(0.21);
@@ -902,4 +815,1696 @@ bool ProcessRequestsChain_WithValidURLs_AllCompleted::RunTest(const FString& Par
 	FRegistry::Credentials.ForgetAll();
 
 	return true;
-}
\ No newline at end of file
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(PollRetry_ManyIdleTasks_OnlyFinishedTasksCompleted, "AccelByte.Tests.Core.HttpRetry.PollRetry_ManyIdleTasks_OnlyFinishedTasksCompleted", AutomationFlagMaskHttpRetry);
+bool PollRetry_ManyIdleTasks_OnlyFinishedTasksCompleted::RunTest(const FString& Parameter)
+{
+	// The cost of an idle poll by task count is reported by AccelByte.Benchmarks.HttpScheduler.InFlight
+	const int32 TaskCount = 10000;
+	const int32 IdlePollCount = 100;
+	const int32 FinishedTaskCount = 100;
+	FHttpRetryScheduler Scheduler;
+	Scheduler.SetMaxInFlightPerService(TaskCount);
+	Scheduler.SetMaxInFlight(EHttpRequestClass::Interactive, TaskCount);
+	TArray<TSharedRef<MockHttpRequest>> Requests;
+	Requests.Reserve(TaskCount);
+	int32 RequestCompleted = 0;
+	double CurrentTime = 10.0;
+
+	for (int32 i = 0; i < TaskCount; i++)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Requests.Add(Request);
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&RequestCompleted](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			RequestCompleted++;
+		}), CurrentTime);
+	}
+
+	// Nothing is due and nothing is finished
+	CurrentTime += 0.5;
+
+	for (int32 i = 0; i < IdlePollCount; i++)
+	{
+		Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	}
+
+	check(RequestCompleted == 0);
+	check(Scheduler.GetTaskCount() == TaskCount);
+
+	for (int32 i = 0; i < FinishedTaskCount; i++)
+	{
+		auto& Request = Requests[i * (TaskCount / FinishedTaskCount)];
+		((MockHttpResponse*)Request->GetResponse().Get())->SetResponseCode(200);
+		Request->SetStatus(EHttpRequestStatus::Succeeded);
+	}
+
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(RequestCompleted == FinishedTaskCount);
+	check(Scheduler.GetTaskCount() == TaskCount - FinishedTaskCount);
+
+	for (const auto& Request : Requests)
+	{
+		check(Request->RetryCount == 1);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_Completed_DeliveredBeforeNextPoll, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_Completed_DeliveredBeforeNextPoll", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_Completed_DeliveredBeforeNextPoll::RunTest(const FString& Parameter)
+{
+	// The latency this saves against polling is reported by AccelByte.Benchmarks.HttpScheduler.CompletionLatency
+	FHttpRetryScheduler Scheduler;
+	double CurrentTime = 10.0;
+	TArray<int32> DeliveredCodes;
+
+	auto SendRequest = [&](const FString& ItemId)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("GET"));
+		Request->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/") + ItemId);
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&DeliveredCodes](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			DeliveredCodes.Add(bConnectedSuccessfully ? Response->GetResponseCode() : 0);
+		}), CurrentTime);
+
+		return Request;
+	};
+
+	auto Answered = SendRequest(TEXT("item01"));
+	auto Lost = SendRequest(TEXT("item02"));
+	CurrentTime += 0.05;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(DeliveredCodes.Num() == 0);
+
+	// Handled from the transport's own callback, no poll in between
+	((MockHttpResponse*)Answered->GetResponse().Get())->SetResponseCode(200);
+	Answered->SetStatus(EHttpRequestStatus::Succeeded);
+	check(DeliveredCodes.Num() == 1 && DeliveredCodes[0] == 200);
+
+	Lost->SetStatus(EHttpRequestStatus::Failed_ConnectionError);
+	check(DeliveredCodes.Num() == 2);
+	check(Scheduler.GetTaskCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_IdenticalGets_SentOnce, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_IdenticalGets_SentOnce", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_IdenticalGets_SentOnce::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	TArray<TSharedRef<MockHttpRequest>> Requests;
+	int32 RequestCompleted = 0;
+	double CurrentTime = 10.0;
+
+	for (int32 i = 0; i < 4; i++)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("GET"));
+		Request->SetURL(i < 3 ? TEXT("http://accelbyte.example/platform/public/namespaces/game01/categories") : TEXT("http://accelbyte.example/platform/public/namespaces/game01/items"));
+		Request->SetHeader(TEXT("Authorization"), TEXT("Bearer user_access_token"));
+		Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+		Requests.Add(Request);
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&RequestCompleted](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			check(Response->GetResponseCode() == 200);
+			RequestCompleted++;
+		}), CurrentTime);
+	}
+
+	check(Requests[0]->RetryCount == 1);
+	check(Requests[1]->RetryCount == 0);
+	check(Requests[2]->RetryCount == 0);
+	check(Requests[3]->RetryCount == 1);
+	check(Scheduler.GetCoalescingStats().Hits == 2);
+	check(Scheduler.GetCoalescingStats().Misses == 2);
+
+	((MockHttpResponse*)Requests[0]->GetResponse().Get())->SetResponseCode(200);
+	Requests[0]->SetStatus(EHttpRequestStatus::Succeeded);
+	check(RequestCompleted == 3);
+
+	((MockHttpResponse*)Requests[3]->GetResponse().Get())->SetResponseCode(200);
+	Requests[3]->SetStatus(EHttpRequestStatus::Succeeded);
+	check(RequestCompleted == 4);
+
+	// Nothing is in flight anymore, the next identical GET is sent again
+	auto Request = MakeShared<MockHttpRequest>();
+	Request->SetVerb(TEXT("GET"));
+	Request->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/categories"));
+	Request->SetHeader(TEXT("Authorization"), TEXT("Bearer user_access_token"));
+	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+	Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate(), CurrentTime);
+	check(Request->RetryCount == 1);
+	check(Scheduler.GetCoalescingStats().Misses == 3);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_ServiceSaturated_DispatchedByPriority, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_ServiceSaturated_DispatchedByPriority", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_ServiceSaturated_DispatchedByPriority::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	Scheduler.SetMaxInFlightPerService(2);
+	Scheduler.SetMaxInFlight(EHttpRequestClass::Background, 1);
+	double CurrentTime = 10.0;
+	int32 RequestCompleted = 0;
+
+	auto SendRequest = [&](EHttpRequestClass RequestClass)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("PUT"));
+		Request->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/users/Id/orders"));
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&RequestCompleted](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			RequestCompleted++;
+		}), CurrentTime, RequestClass);
+
+		return Request;
+	};
+
+	auto Finish = [&](const TSharedRef<MockHttpRequest>& Request)
+	{
+		((MockHttpResponse*)Request->GetResponse().Get())->SetResponseCode(200);
+		Request->SetStatus(EHttpRequestStatus::Succeeded);
+	};
+
+	auto BackgroundA = SendRequest(EHttpRequestClass::Background);
+	auto BackgroundB = SendRequest(EHttpRequestClass::Background);
+	auto InteractiveC = SendRequest(EHttpRequestClass::Interactive);
+	auto InteractiveD = SendRequest(EHttpRequestClass::Interactive);
+	auto CommerceE = SendRequest(EHttpRequestClass::Commerce);
+
+	check(BackgroundA->RetryCount == 1);
+	check(BackgroundB->RetryCount == 0); //lane limit
+	check(InteractiveC->RetryCount == 1);
+	check(InteractiveD->RetryCount == 0); //service limit
+	check(CommerceE->RetryCount == 0); //service limit
+	check(Scheduler.GetLaneStats(EHttpRequestClass::Background).QueueDepth == 1);
+	check(Scheduler.GetLaneStats(EHttpRequestClass::Interactive).QueueDepth == 1);
+	check(Scheduler.GetLaneStats(EHttpRequestClass::Commerce).QueueDepth == 1);
+
+	// Commerce goes before the interactive request that was queued earlier
+	CurrentTime += 0.5;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	Finish(InteractiveC);
+	check(CommerceE->RetryCount == 1);
+	check(InteractiveD->RetryCount == 0);
+	check(Scheduler.GetLaneStats(EHttpRequestClass::Commerce).MaxWaitTime >= 0.5);
+
+	Finish(BackgroundA);
+	check(InteractiveD->RetryCount == 1);
+	check(BackgroundB->RetryCount == 0);
+
+	Finish(CommerceE);
+	check(BackgroundB->RetryCount == 1);
+
+	Finish(InteractiveD);
+	Finish(BackgroundB);
+	check(RequestCompleted == 5);
+	check(Scheduler.GetTaskCount() == 0);
+	check(Scheduler.GetLaneStats(EHttpRequestClass::Background).InFlight == 0);
+	check(Scheduler.GetLaneStats(EHttpRequestClass::Background).DispatchedCount == 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_LargeUpload_DeadlineCoversBody, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_LargeUpload_DeadlineCoversBody", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_LargeUpload_DeadlineCoversBody::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	double CurrentTime = 10.0;
+	bool bIsSmallCompleted = false;
+	bool bIsLargeCompleted = false;
+
+	auto SendUpload = [&](int32 Size, bool& bIsCompleted)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("PUT"));
+		Request->SetURL(FString::Printf(TEXT("http://accelbyte.example/binary-store/namespaces/game01/users/Id/slots/%d"), Size));
+		TArray<uint8> Body;
+		Body.SetNumZeroed(Size);
+		Request->SetContent(Body);
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&bIsCompleted](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			bIsCompleted = true;
+		}), CurrentTime, EHttpRequestClass::Background, FHttpRetryPolicy::Upload(Size));
+
+		return Request;
+	};
+
+	auto Small = SendUpload(1024, bIsSmallCompleted);
+	auto Large = SendUpload(32 * 1024 * 1024, bIsLargeCompleted);
+	check(Small->RetryCount == 1 && Large->RetryCount == 1);
+
+	// A small body keeps the background deadline, a large one is still being sent
+	CurrentTime += FHttpRetryPolicy::Background().Timeout + 1.0;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(bIsSmallCompleted);
+	check(!bIsLargeCompleted);
+	check(Large->GetStatus() == EHttpRequestStatus::Processing);
+
+	CurrentTime = 10.0 + FHttpRetryPolicy::Upload(32 * 1024 * 1024).Timeout + 1.0;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(bIsLargeCompleted);
+	check(Scheduler.GetTaskCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_GotError429_HeldUntilRetryAfter, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_GotError429_HeldUntilRetryAfter", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_GotError429_HeldUntilRetryAfter::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	double CurrentTime = 10.0;
+	int32 RequestCompleted = 0;
+
+	check(HttpRequest::GetEndpointTemplate(TEXT("GET"), TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/0123456789abcdef0123456789abcdef?region=US")) == TEXT("GET http://accelbyte.example/platform/public/namespaces/game01/items/{id}"));
+
+	auto SendRequest = [&](const FString& ItemId)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("GET"));
+		Request->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/") + ItemId);
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&RequestCompleted](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			RequestCompleted++;
+		}), CurrentTime);
+
+		return Request;
+	};
+
+	auto First = SendRequest(TEXT("0123456789abcdef0123456789abcdef"));
+	MockHttpResponse* FirstResponse = (MockHttpResponse*)First->GetResponse().Get();
+	FirstResponse->SetResponseCode(429);
+	FirstResponse->SetHeader(TEXT("Retry-After"), TEXT("5"));
+	First->SetStatus(EHttpRequestStatus::Succeeded);
+	check(RequestCompleted == 0);
+
+	// Same endpoint, other item: held locally instead of being rejected too
+	CurrentTime += 1.0;
+	auto Second = SendRequest(TEXT("fedcba9876543210fedcba9876543210"));
+	check(Second->RetryCount == 0);
+
+	CurrentTime += 2.0;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(First->RetryCount == 1);
+	check(Second->RetryCount == 0);
+	check(Scheduler.GetThrottlingStats().ThrottledEndpoints == 1);
+
+	CurrentTime += 2.5;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(First->RetryCount == 2);
+	check(Second->RetryCount == 1);
+
+	FirstResponse->SetHeader(TEXT("Retry-After"), TEXT(""));
+	FirstResponse->SetResponseCode(200);
+	First->SetStatus(EHttpRequestStatus::Succeeded);
+	((MockHttpResponse*)Second->GetResponse().Get())->SetResponseCode(200);
+	Second->SetStatus(EHttpRequestStatus::Succeeded);
+	check(RequestCompleted == 2);
+
+	FHttpRetryScheduler::FThrottlingStats Stats = Scheduler.GetThrottlingStats();
+	check(Stats.RateLimitedResponses == 1);
+	check(Stats.DelayedRequests == 2);
+	check(Stats.ThrottledEndpoints == 0);
+	check(Scheduler.GetTaskCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_RateLimitExhausted_WaitsForToken, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_RateLimitExhausted_WaitsForToken", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_RateLimitExhausted_WaitsForToken::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	double CurrentTime = 10.0;
+
+	auto First = MakeShared<MockHttpRequest>();
+	First->SetVerb(TEXT("POST"));
+	First->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/users/0123456789abcdef0123456789abcdef/orders"));
+	Scheduler.ProcessRequest(First, FHttpRequestCompleteDelegate(), CurrentTime);
+
+	// 2 requests per 10 seconds, none left
+	MockHttpResponse* FirstResponse = (MockHttpResponse*)First->GetResponse().Get();
+	FirstResponse->SetResponseCode(200);
+	FirstResponse->SetHeader(TEXT("X-RateLimit-Limit"), TEXT("2"));
+	FirstResponse->SetHeader(TEXT("X-RateLimit-Remaining"), TEXT("0"));
+	FirstResponse->SetHeader(TEXT("X-RateLimit-Reset"), TEXT("10"));
+	First->SetStatus(EHttpRequestStatus::Succeeded);
+
+	auto Second = MakeShared<MockHttpRequest>();
+	Second->SetVerb(TEXT("POST"));
+	Second->SetURL(First->GetURL());
+	Scheduler.ProcessRequest(Second, FHttpRequestCompleteDelegate(), CurrentTime);
+	check(Second->RetryCount == 0);
+
+	CurrentTime += 2.0;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Second->RetryCount == 0);
+
+	CurrentTime += 3.5;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Second->RetryCount == 1);
+	check(Scheduler.GetThrottlingStats().TotalDelayTime >= 5.0);
+
+	((MockHttpResponse*)Second->GetResponse().Get())->SetResponseCode(200);
+	Second->SetStatus(EHttpRequestStatus::Succeeded);
+	check(Scheduler.GetTaskCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_ServiceDown_CircuitOpensAndFailsFast, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_ServiceDown_CircuitOpensAndFailsFast", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_ServiceDown_CircuitOpensAndFailsFast::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	FHttpRetryScheduler::FCircuitBreakerConfig Config;
+	Config.MinimumCalls = 4;
+	Config.OpenDuration = 5.0;
+	Scheduler.SetCircuitBreakerConfig(Config);
+	double CurrentTime = 10.0;
+	TArray<ECircuitState> States;
+	int32 LastErrorCode = 0;
+
+	Scheduler.OnCircuitStateChanged().AddLambda([&States](const FString& ServiceUrl, ECircuitState State)
+	{
+		States.Add(State);
+	});
+
+	auto SendRequest = [&](const FString& Url)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("POST"));
+		Request->SetURL(Url);
+		Scheduler.ProcessRequest(Request, CreateHttpResultHandler(FVoidHandler(), FErrorHandler::CreateLambda([&LastErrorCode](int32 Code, const FString& Message)
+		{
+			LastErrorCode = Code;
+		})), CurrentTime);
+
+		return Request;
+	};
+
+	const FString PlatformUrl = TEXT("http://accelbyte.example/platform/public/namespaces/game01/users/Id/orders");
+
+	for (int32 i = 0; i < 4; i++)
+	{
+		SendRequest(PlatformUrl)->SetStatus(EHttpRequestStatus::Failed_ConnectionError);
+	}
+
+	check(States.Num() == 1 && States[0] == ECircuitState::Open);
+	check(Scheduler.GetCircuitState(TEXT("http://accelbyte.example/platform")) == ECircuitState::Open);
+
+	// Not sent, fails on the next poll with its own error code
+	auto Rejected = SendRequest(PlatformUrl);
+	check(Rejected->RetryCount == 0);
+	CurrentTime += 0.2;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(LastErrorCode == static_cast<int32>(ErrorCodes::ServiceCircuitOpen));
+
+	// Other services are not affected
+	auto IamRequest = SendRequest(TEXT("http://accelbyte.example/iam/oauth/token"));
+	check(IamRequest->RetryCount == 1);
+	((MockHttpResponse*)IamRequest->GetResponse().Get())->SetResponseCode(200);
+	IamRequest->SetStatus(EHttpRequestStatus::Succeeded);
+
+	// After the open duration one probe goes through, the rest still fails fast
+	CurrentTime += 5.0;
+	auto Probe = SendRequest(PlatformUrl);
+	auto NotProbe = SendRequest(PlatformUrl);
+	check(Probe->RetryCount == 1);
+	check(NotProbe->RetryCount == 0);
+	check(States.Num() == 2 && States[1] == ECircuitState::HalfOpen);
+
+	((MockHttpResponse*)Probe->GetResponse().Get())->SetResponseCode(200);
+	Probe->SetStatus(EHttpRequestStatus::Succeeded);
+	check(States.Num() == 3 && States[2] == ECircuitState::Closed);
+
+	CurrentTime += 0.2;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(SendRequest(PlatformUrl)->RetryCount == 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_RetryAfterCircuitOpened_FailsFast, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_RetryAfterCircuitOpened_FailsFast", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_RetryAfterCircuitOpened_FailsFast::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	FHttpRetryScheduler::FCircuitBreakerConfig Config;
+	Config.MinimumCalls = 4;
+	Scheduler.SetCircuitBreakerConfig(Config);
+	double CurrentTime = 10.0;
+	int32 LastErrorCode = 0;
+
+	auto Retried = MakeShared<MockHttpRequest>();
+	Retried->SetVerb(TEXT("GET"));
+	Retried->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/users/Id/wallets/COIN"));
+	Scheduler.ProcessRequest(Retried, CreateHttpResultHandler(FVoidHandler(), FErrorHandler::CreateLambda([&LastErrorCode](int32 Code, const FString& Message)
+	{
+		LastErrorCode = Code;
+	})), CurrentTime);
+	((MockHttpResponse*)Retried->GetResponse().Get())->SetResponseCode(503);
+	Retried->SetStatus(EHttpRequestStatus::Succeeded);
+
+	// The service goes down while the retry waits for its backoff delay
+	for (int32 i = 0; i < 3; i++)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("POST"));
+		Request->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/users/Id/orders"));
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate(), CurrentTime);
+		Request->SetStatus(EHttpRequestStatus::Failed_ConnectionError);
+	}
+
+	check(Scheduler.GetCircuitState(Retried->GetURL()) == ECircuitState::Open);
+	CurrentTime += 0.2;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(LastErrorCode == 0);
+	CurrentTime += FHttpRetryScheduler::InitialDelay * 2.5;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Retried->RetryCount == 1);
+	check(LastErrorCode == static_cast<int32>(ErrorCodes::ServiceCircuitOpen));
+	check(Scheduler.GetTaskCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_GotError401_ReplayedWithRefreshedToken, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_GotError401_ReplayedWithRefreshedToken", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_GotError401_ReplayedWithRefreshedToken::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	Credentials UserCredentials;
+	UserCredentials.SetUserToken(TEXT("user_access_token"), TEXT("user_refresh_token"), 3600.0, TEXT("Id"), TEXT("user_display_name"), TEXT("game01"));
+	double CurrentTime = 10.0;
+	int32 LastResponseCode = 0;
+
+	auto SendRequest = [&]()
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("GET"));
+		Request->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/users/Id/wallets/COIN"));
+		Request->SetHeader(TEXT("Authorization"), TEXT("Bearer ") + UserCredentials.GetUserAccessToken());
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&LastResponseCode](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			LastResponseCode = Response->GetResponseCode();
+		}), CurrentTime);
+		((MockHttpResponse*)Request->GetResponse().Get())->SetResponseCode(401);
+		Request->SetStatus(EHttpRequestStatus::Succeeded);
+
+		return Request;
+	};
+
+	auto Request = SendRequest();
+	CurrentTime += 0.2;
+	Scheduler.PollRetry(CurrentTime, UserCredentials);
+	check(LastResponseCode == 0);
+	check(Request->RetryCount == 1);
+
+	// Refresh finished, the parked request is re-signed and sent again
+	UserCredentials.SetUserToken(TEXT("new_access_token"), TEXT("new_refresh_token"), 3600.0, TEXT("Id"), TEXT("user_display_name"), TEXT("game01"));
+	CurrentTime += 0.2;
+	Scheduler.PollRetry(CurrentTime, UserCredentials);
+	check(Request->RetryCount == 2);
+	check(Request->GetHeader(TEXT("Authorization")) == TEXT("Bearer new_access_token"));
+
+	// Replayed only once
+	Request->SetStatus(EHttpRequestStatus::Succeeded);
+	check(LastResponseCode == 401);
+
+	// No refresh comes, the request gives up after the park timeout
+	LastResponseCode = 0;
+	auto Unrefreshed = SendRequest();
+	CurrentTime += FHttpRetryScheduler::ParkTimeout - 1;
+	Scheduler.PollRetry(CurrentTime, UserCredentials);
+	check(LastResponseCode == 0);
+	CurrentTime += 1.5;
+	Scheduler.PollRetry(CurrentTime, UserCredentials);
+	check(LastResponseCode == 401);
+	check(Unrefreshed->RetryCount == 1);
+	check(Scheduler.GetTaskCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_InteractivePolicy_AttemptTimeoutAndDeadlineInherited, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_InteractivePolicy_AttemptTimeoutAndDeadlineInherited", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_InteractivePolicy_AttemptTimeoutAndDeadlineInherited::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	FHttpRetryPolicy Policy = FHttpRetryPolicy::Interactive();
+	double CurrentTime = 10.0;
+	int32 ParentResponseCode = 0;
+	bool bIsChildCompleted = false;
+	auto Child = MakeShared<MockHttpRequest>();
+	Child->SetVerb(TEXT("GET"));
+	Child->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/users/Id/entitlements"));
+
+	auto Parent = MakeShared<MockHttpRequest>();
+	Parent->SetVerb(TEXT("GET"));
+	Parent->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/users/Id/wallets/COIN"));
+	Scheduler.ProcessRequest(Parent, FHttpRequestCompleteDelegate::CreateLambda([&](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+	{
+		ParentResponseCode = Response->GetResponseCode();
+
+		// Default policy, but bound by what is left of the parent's deadline
+		Scheduler.ProcessRequest(Child, FHttpRequestCompleteDelegate::CreateLambda([&bIsChildCompleted](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			bIsChildCompleted = true;
+		}), CurrentTime);
+	}), CurrentTime, EHttpRequestClass::Interactive, Policy);
+
+	// No answer within the attempt timeout: cancelled and sent again once the backoff delay passed
+	CurrentTime = 12.0;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Parent->RetryCount == 1);
+	CurrentTime = 10.0 + Policy.AttemptTimeout + 0.2;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Parent->RetryCount == 1);
+	CurrentTime += Policy.MaximumDelay;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Parent->RetryCount == 2);
+
+	// Out of attempts after the third one
+	MockHttpResponse* ParentResponse = (MockHttpResponse*)Parent->GetResponse().Get();
+	ParentResponse->SetResponseCode(503);
+	Parent->SetStatus(EHttpRequestStatus::Succeeded);
+	CurrentTime += 0.2;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Parent->RetryCount == 2);
+	CurrentTime += Policy.MaximumDelay;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Parent->RetryCount == 3);
+	check(ParentResponseCode == 0);
+	Parent->SetStatus(EHttpRequestStatus::Succeeded);
+	check(ParentResponseCode == 503);
+	check(Child->RetryCount == 1);
+
+	CurrentTime = 10.0 + Policy.Timeout - 1.0;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(!bIsChildCompleted);
+	CurrentTime = 10.0 + Policy.Timeout + 0.2;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(bIsChildCompleted);
+	check(Scheduler.GetTaskCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_SlowerThanUsual_HedgedWithinCap, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_SlowerThanUsual_HedgedWithinCap", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_SlowerThanUsual_HedgedWithinCap::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	TArray<TSharedRef<MockHttpRequest>> Hedges;
+	Scheduler.SetMaxHedgesInFlight(1);
+	Scheduler.SetRequestFactory([&Hedges]()
+	{
+		auto Hedge = MakeShared<MockHttpRequest>();
+		Hedges.Add(Hedge);
+
+		return FHttpRequestPtr(Hedge);
+	});
+	double CurrentTime = 10.0;
+	TArray<int32> ResponseCodes;
+	TArray<FString> Contents;
+
+	auto SendRequest = [&](const FString& ItemId)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("GET"));
+		Request->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/") + ItemId + TEXT("/locale"));
+		Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&ResponseCodes, &Contents](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			ResponseCodes.Add(Response->GetResponseCode());
+			Contents.Add(Response->GetContentAsString());
+		}), CurrentTime, EHttpRequestClass::Interactive, FHttpRetryPolicy::Hedged());
+
+		return Request;
+	};
+
+	// Learn the endpoint's usual latency
+	for (int32 i = 0; i < 20; i++)
+	{
+		auto Request = SendRequest(FString::Printf(TEXT("%032d"), i));
+		CurrentTime += 0.1;
+		Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+		((MockHttpResponse*)Request->GetResponse().Get())->SetResponseCode(200);
+		Request->SetStatus(EHttpRequestStatus::Succeeded);
+	}
+
+	check(Hedges.Num() == 0);
+	ResponseCodes.Empty();
+	Contents.Empty();
+
+	auto Slow = SendRequest(TEXT("0123456789abcdef0123456789abcdef"));
+	CurrentTime += 0.01;
+	auto AlsoSlow = SendRequest(TEXT("fedcba9876543210fedcba9876543210"));
+	CurrentTime += 0.2;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+
+	// Only one copy fits in the cap
+	check(Hedges.Num() == 1);
+	check(Hedges[0]->GetURL() == Slow->GetURL());
+	check(Hedges[0]->GetHeader(TEXT("Accept")) == TEXT("application/json"));
+	check(Scheduler.GetHedgingStats().Capped == 1);
+
+	// The copy answers first with a gzip body, the original is cancelled and reported once
+	FString Content = TEXT("{\"itemId\":\"0123456789abcdef0123456789abcdef\",\"title\":\"Slow item\"}");
+	FTCHARToUTF8 Plain(*Content);
+	TArray<uint8> Compressed;
+	check(AccelByte::HttpCompression::Compress(reinterpret_cast<const uint8*>(Plain.Get()), Plain.Length(), Compressed));
+	((MockHttpResponse*)Hedges[0]->GetResponse().Get())->SetResponseCode(200);
+	((MockHttpResponse*)Hedges[0]->GetResponse().Get())->SetHeader(TEXT("Content-Encoding"), TEXT("gzip"));
+	((MockHttpResponse*)Hedges[0]->GetResponse().Get())->SetContent(Compressed);
+	Hedges[0]->SetStatus(EHttpRequestStatus::Succeeded);
+	check(ResponseCodes.Num() == 1 && ResponseCodes[0] == 200);
+	check(Contents[0] == Content);
+	check(Slow->GetStatus() == EHttpRequestStatus::Failed_ConnectionError);
+
+	((MockHttpResponse*)AlsoSlow->GetResponse().Get())->SetResponseCode(200);
+	AlsoSlow->SetStatus(EHttpRequestStatus::Succeeded);
+	check(ResponseCodes.Num() == 2);
+
+	FHttpRetryScheduler::FHedgingStats Stats = Scheduler.GetHedgingStats();
+	check(Stats.Sent == 1);
+	check(Stats.Won == 1);
+	check(Scheduler.GetTaskCount() == 0);
+
+	// The hedge's body is counted as received, not as decoded
+	TSharedPtr<FHttpEndpointMetrics, ESPMode::ThreadSafe> Endpoint = Scheduler.GetMetrics().Find(HttpRequest::GetEndpointTemplate(TEXT("GET"), Slow->GetURL()));
+	check(Endpoint.IsValid());
+	check(Endpoint->ResponseBytes.GetMax() == Compressed.Num());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_HedgeWon_OriginalLatencyRaisesHedgeDelay, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_HedgeWon_OriginalLatencyRaisesHedgeDelay", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_HedgeWon_OriginalLatencyRaisesHedgeDelay::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	TArray<TSharedRef<MockHttpRequest>> Hedges;
+	Scheduler.SetMaxHedgesInFlight(2);
+	Scheduler.SetRequestFactory([&Hedges]()
+	{
+		auto Hedge = MakeShared<MockHttpRequest>();
+		Hedges.Add(Hedge);
+
+		return FHttpRequestPtr(Hedge);
+	});
+	double CurrentTime = 10.0;
+	int32 RequestCount = 0;
+
+	auto SendRequest = [&]()
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("GET"));
+		Request->SetURL(FString::Printf(TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/%032d/locale"), RequestCount++));
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate(), CurrentTime, EHttpRequestClass::Interactive, FHttpRetryPolicy::Hedged());
+
+		return Request;
+	};
+	auto SendFastRequests = [&](int32 Count)
+	{
+		for (int32 i = 0; i < Count; i++)
+		{
+			auto Request = SendRequest();
+			CurrentTime += 0.1;
+			Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+			((MockHttpResponse*)Request->GetResponse().Get())->SetResponseCode(200);
+			Request->SetStatus(EHttpRequestStatus::Succeeded);
+		}
+	};
+
+	SendFastRequests(20);
+
+	// Two slow requests lose to their copies, the originals were out for 0.3 seconds
+	SendRequest();
+	SendRequest();
+	CurrentTime += 0.3;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Hedges.Num() == 2);
+
+	for (auto& Hedge : Hedges)
+	{
+		((MockHttpResponse*)Hedge->GetResponse().Get())->SetResponseCode(200);
+		Hedge->SetStatus(EHttpRequestStatus::Succeeded);
+	}
+
+	check(Scheduler.GetHedgingStats().Won == 2);
+
+	// Refill the hedging budget
+	SendFastRequests(11);
+
+	// The slow samples are in the endpoint's 95th percentile, the next copy waits for them
+	auto Next = SendRequest();
+	CurrentTime += 0.2;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Hedges.Num() == 2);
+	CurrentTime += 0.2;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Hedges.Num() == 3);
+
+	((MockHttpResponse*)Next->GetResponse().Get())->SetResponseCode(200);
+	Next->SetStatus(EHttpRequestStatus::Succeeded);
+	check(Scheduler.GetTaskCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_OnWorkerThread_ResultDeliveredOnGameThread, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_OnWorkerThread_ResultDeliveredOnGameThread", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_OnWorkerThread_ResultDeliveredOnGameThread::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	Credentials UserCredentials;
+	FHttpWorker Worker(Scheduler, UserCredentials);
+	check(Worker.Startup());
+
+	uint32 GameThreadId = FPlatformTLS::GetCurrentThreadId();
+	uint32 DecodeThreadId = 0;
+	uint32 HandlerThreadId = 0;
+	FHttpRequestCompleteDelegate ResultHandler = CreateHttpResultHandler(THandler<FString>::CreateLambda([&HandlerThreadId](const FString& Result)
+	{
+		HandlerThreadId = FPlatformTLS::GetCurrentThreadId();
+	}), FErrorHandler());
+
+	auto Request = MakeShared<MockHttpRequest>();
+	Request->SetVerb(TEXT("GET"));
+	Request->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/byCriteria"));
+	Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&DecodeThreadId, ResultHandler](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+	{
+		DecodeThreadId = FPlatformTLS::GetCurrentThreadId();
+		ResultHandler.ExecuteIfBound(Request, Response, bConnectedSuccessfully);
+	}), FPlatformTime::Seconds());
+
+	// The request is sent by the worker, not from inside ProcessRequest
+	double Timeout = FPlatformTime::Seconds() + 5.0;
+
+	while (Request->GetStatus() != EHttpRequestStatus::Processing && FPlatformTime::Seconds() < Timeout)
+	{
+		FPlatformProcess::Sleep(0.01f);
+	}
+
+	check(Request->RetryCount == 1);
+
+	((MockHttpResponse*)Request->GetResponse().Get())->SetResponseCode(200);
+	Request->SetStatus(EHttpRequestStatus::Succeeded);
+
+	while (HandlerThreadId == 0 && FPlatformTime::Seconds() < Timeout)
+	{
+		Worker.PollGameThread();
+		FPlatformProcess::Sleep(0.01f);
+	}
+
+	check(DecodeThreadId != 0 && DecodeThreadId != GameThreadId);
+	check(HandlerThreadId == GameThreadId);
+
+	Worker.Shutdown();
+	check(Scheduler.GetTaskCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(Scheduler_SettingsFromGameThread_AppliedOnWorkerAndStatsPublished, "AccelByte.Tests.Core.HttpRetry.Scheduler_SettingsFromGameThread_AppliedOnWorkerAndStatsPublished", AutomationFlagMaskHttpRetry);
+bool Scheduler_SettingsFromGameThread_AppliedOnWorkerAndStatsPublished::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	Credentials UserCredentials;
+	FHttpWorker Worker(Scheduler, UserCredentials);
+	check(Worker.Startup());
+
+	// Forwarded to the worker, ahead of the requests sent after it
+	Scheduler.SetMaxInFlightPerService(1);
+	TArray<TSharedRef<MockHttpRequest>> Requests;
+
+	for (int32 i = 0; i < 3; i++)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("GET"));
+		Request->SetURL(FString::Printf(TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/%d"), i));
+		Requests.Add(Request);
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate(), FPlatformTime::Seconds());
+	}
+
+	double Timeout = FPlatformTime::Seconds() + 5.0;
+
+	while (Scheduler.GetLaneStats(EHttpRequestClass::Interactive).QueueDepth != 2 && FPlatformTime::Seconds() < Timeout)
+	{
+		FPlatformProcess::Sleep(0.01f);
+	}
+
+	check(Scheduler.GetLaneStats(EHttpRequestClass::Interactive).InFlight == 1);
+	check(Scheduler.GetLaneStats(EHttpRequestClass::Interactive).QueueDepth == 2);
+	check(Scheduler.GetTaskCount() == 3);
+	check(Requests[0]->RetryCount == 1 && Requests[1]->RetryCount == 0);
+
+	Worker.Shutdown();
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_CacheableGet_ServedFromCacheAndRevalidated, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_CacheableGet_ServedFromCacheAndRevalidated", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_CacheableGet_ServedFromCacheAndRevalidated::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	TArray<TSharedRef<MockHttpRequest>> Revalidations;
+	Scheduler.SetRequestFactory([&Revalidations]()
+	{
+		auto Revalidation = MakeShared<MockHttpRequest>();
+		Revalidations.Add(Revalidation);
+
+		return FHttpRequestPtr(Revalidation);
+	});
+	double CurrentTime = 10.0;
+	TArray<const FAccelByteModelsUserProfileInfo*> Results;
+	FHttpRequestCompleteDelegate ResultHandler = CreateHttpResultHandler(THandler<FAccelByteModelsUserProfileInfo>::CreateLambda([&Results](const FAccelByteModelsUserProfileInfo& Result)
+	{
+		Results.Add(&Result);
+	}), FErrorHandler());
+
+	auto SendRequest = [&]()
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("GET"));
+		Request->SetURL(TEXT("http://accelbyte.example/basic/public/namespaces/game01/users/me/profiles"));
+		Request->SetHeader(TEXT("Authorization"), TEXT("Bearer user_access_token"));
+		Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+		Scheduler.ProcessRequest(Request, ResultHandler, CurrentTime);
+
+		return Request;
+	};
+
+	auto First = SendRequest();
+	MockHttpResponse* FirstResponse = (MockHttpResponse*)First->GetResponse().Get();
+	FirstResponse->SetResponseCode(200);
+	FirstResponse->SetHeader(TEXT("ETag"), TEXT("\"v1\""));
+	FirstResponse->SetHeader(TEXT("Cache-Control"), TEXT("max-age=60, stale-while-revalidate=30"));
+	FirstResponse->SetContentAsString(TEXT("{\"userId\":\"user01\",\"firstName\":\"First\"}"));
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	First->SetStatus(EHttpRequestStatus::Succeeded);
+	check(Results.Num() == 1 && Results[0]->UserId == TEXT("user01"));
+
+	// Fresh, answered without a request and with the struct decoded the first time
+	CurrentTime = 30.0;
+	auto Fresh = SendRequest();
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Fresh->RetryCount == 0);
+	check(Results.Num() == 2 && Results[1] == Results[0]);
+
+	// Stale, answered at once while the validators are sent in the background
+	CurrentTime = 80.0;
+	auto Stale = SendRequest();
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	check(Stale->RetryCount == 0);
+	check(Results.Num() == 3 && Results[2] == Results[0]);
+	check(Revalidations.Num() == 1);
+	check(Revalidations[0]->GetHeader(TEXT("If-None-Match")) == TEXT("\"v1\""));
+
+	MockHttpResponse* NotModified = (MockHttpResponse*)Revalidations[0]->GetResponse().Get();
+	NotModified->SetResponseCode(304);
+	NotModified->SetHeader(TEXT("Cache-Control"), TEXT("max-age=60"));
+	Revalidations[0]->SetStatus(EHttpRequestStatus::Succeeded);
+	check(Results.Num() == 3);
+
+	// Expired, the request carries the validators and a 304 is answered with the cached struct
+	CurrentTime = 200.0;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	auto Expired = SendRequest();
+	check(Expired->RetryCount == 1);
+	check(Expired->GetHeader(TEXT("If-None-Match")) == TEXT("\"v1\""));
+	((MockHttpResponse*)Expired->GetResponse().Get())->SetResponseCode(304);
+	Expired->SetStatus(EHttpRequestStatus::Succeeded);
+	check(Results.Num() == 4 && Results[3] == Results[0]);
+
+	FHttpRetryScheduler::FResponseCacheStats Stats = Scheduler.GetResponseCacheStats();
+	check(Stats.Hits == 1);
+	check(Stats.StaleHits == 1);
+	check(Stats.Revalidations == 2);
+	check(Stats.Misses == 1);
+	check(Stats.Entries == 1);
+	check(Stats.Size == FirstResponse->GetContentLength());
+
+	// Bodies over the budget are dropped
+	Scheduler.SetResponseCacheBudget(FirstResponse->GetContentLength() - 1);
+	check(Scheduler.GetResponseCacheStats().Entries == 0);
+	check(Scheduler.GetResponseCacheStats().Size == 0);
+	check(Scheduler.GetTaskCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_SuccessfulWrite_InvalidatesOnlyItsParentPath, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_SuccessfulWrite_InvalidatesOnlyItsParentPath", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_SuccessfulWrite_InvalidatesOnlyItsParentPath::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	double CurrentTime = 10.0;
+	const FString SlotsUrl = TEXT("http://accelbyte.example/binary-store/namespaces/game01/users/user01/slots");
+	const FString OtherUserSlotsUrl = TEXT("http://accelbyte.example/binary-store/namespaces/game01/users/user02/slots");
+
+	auto Send = [&](const FString& Verb, const FString& Url)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(Verb);
+		Request->SetURL(Url);
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate(), CurrentTime);
+
+		return Request;
+	};
+
+	auto Answer = [](const TSharedRef<MockHttpRequest>& Request)
+	{
+		MockHttpResponse* Response = (MockHttpResponse*)Request->GetResponse().Get();
+		Response->SetResponseCode(200);
+		Response->SetHeader(TEXT("Cache-Control"), TEXT("max-age=60"));
+		Response->SetContentAsString(TEXT("[]"));
+		Request->SetStatus(EHttpRequestStatus::Succeeded);
+	};
+
+	for (const FString& Url : { SlotsUrl, SlotsUrl + TEXT("/slot01"), OtherUserSlotsUrl, SlotsUrl + TEXT("-shared") })
+	{
+		Answer(Send(TEXT("GET"), Url));
+	}
+
+	check(Scheduler.GetResponseCacheStats().Entries == 4);
+
+	// The slot and the list it is in are read again, another user's slots and a sibling path are not
+	Answer(Send(TEXT("PUT"), SlotsUrl + TEXT("/slot01?label=save")));
+	check(Scheduler.GetResponseCacheStats().Entries == 2);
+	check(Send(TEXT("GET"), OtherUserSlotsUrl)->RetryCount == 0);
+	check(Send(TEXT("GET"), SlotsUrl)->RetryCount == 1);
+
+	check(HttpRequest::GetParentPath(TEXT("http://accelbyte.example/platform/public/namespaces/game01/users/user01/orders/")) == TEXT("http://accelbyte.example/platform/public/namespaces/game01/users/user01"));
+	check(HttpRequest::GetParentPath(TEXT("http://accelbyte.example/platform/orders")) == TEXT("http://accelbyte.example/platform"));
+	check(HttpRequest::GetParentPath(TEXT("http://accelbyte.example/platform")) == TEXT("http://accelbyte.example/platform"));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_StoredResponse_ServedInNextSession, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_StoredResponse_ServedInNextSession", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_StoredResponse_ServedInNextSession::RunTest(const FString& Parameter)
+{
+	FString Directory = FPaths::ProjectSavedDir() / TEXT("AccelByteTests") / TEXT("ResponseStore");
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+	Credentials UserCredentials;
+	UserCredentials.SetUserToken(TEXT("first_session_token"), TEXT("refresh_token"), 0.0, TEXT("user01"), TEXT("User"), TEXT("game01"));
+	FString UserId;
+	FHttpRequestCompleteDelegate ResultHandler = CreateHttpResultHandler(THandler<FAccelByteModelsUserProfileInfo>::CreateLambda([&UserId](const FAccelByteModelsUserProfileInfo& Result)
+	{
+		UserId = Result.UserId;
+	}), FErrorHandler());
+
+	auto SendRequest = [&](FHttpRetryScheduler& Scheduler, double CurrentTime)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("GET"));
+		Request->SetURL(TEXT("http://accelbyte.example/basic/public/namespaces/game01/users/me/profiles"));
+		Request->SetHeader(TEXT("Authorization"), TEXT("Bearer ") + UserCredentials.GetUserAccessToken());
+		Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+		Scheduler.ProcessRequest(Request, ResultHandler, CurrentTime);
+
+		return Request;
+	};
+
+	{
+		FHttpRetryScheduler Scheduler;
+		Scheduler.SetResponseStoreDirectory(Directory);
+		Scheduler.PollRetry(10.0, UserCredentials);
+		auto Request = SendRequest(Scheduler, 10.0);
+		MockHttpResponse* Response = (MockHttpResponse*)Request->GetResponse().Get();
+		Response->SetResponseCode(200);
+		Response->SetHeader(TEXT("ETag"), TEXT("\"v1\""));
+		Response->SetHeader(TEXT("Cache-Control"), TEXT("max-age=3600"));
+		Response->SetContentAsString(TEXT("{\"userId\":\"user01\"}"));
+		Request->SetStatus(EHttpRequestStatus::Succeeded);
+		check(UserId == TEXT("user01"));
+		Scheduler.SetResponseStoreDirectory(FString());
+	}
+
+	// A new session with a new token renders from disk before anything is sent
+	UserCredentials.SetUserToken(TEXT("second_session_token"), TEXT("refresh_token"), 0.0, TEXT("user01"), TEXT("User"), TEXT("game01"));
+	UserId.Empty();
+	TArray<FString> BodyFiles;
+
+	{
+		FHttpRetryScheduler Scheduler;
+		Scheduler.SetResponseStoreDirectory(Directory);
+		Scheduler.PollRetry(5.0, UserCredentials);
+		auto Request = SendRequest(Scheduler, 5.0);
+		Scheduler.PollRetry(5.0, UserCredentials);
+		check(Request->RetryCount == 0);
+		check(UserId == TEXT("user01"));
+		check(Scheduler.GetResponseCacheStats().Restored == 1);
+		check(Scheduler.GetResponseCacheStats().Hits == 1);
+		IFileManager::Get().FindFilesRecursive(BodyFiles, *Directory, TEXT("*.bin"), true, false);
+		Scheduler.SetResponseStoreDirectory(FString());
+	}
+
+	// A damaged body is not trusted, the response is downloaded again
+	for (const FString& BodyFile : BodyFiles)
+	{
+		if (!BodyFile.EndsWith(TEXT("index.bin")))
+		{
+			FFileHelper::SaveStringToFile(TEXT("{\"userId\":\"someone\"}"), *BodyFile);
+		}
+	}
+
+	{
+		FHttpRetryScheduler Scheduler;
+		Scheduler.SetResponseStoreDirectory(Directory);
+		Scheduler.PollRetry(5.0, UserCredentials);
+		auto Request = SendRequest(Scheduler, 5.0);
+		check(Request->RetryCount == 1);
+		check(Request->GetHeader(TEXT("If-None-Match")).IsEmpty());
+		check(Scheduler.GetResponseCacheStats().Restored == 0);
+		Scheduler.SetResponseStoreDirectory(FString());
+	}
+
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BatchScope_RequestsOfOneFrame_SentTogetherAndCompletedOnce, "AccelByte.Tests.Core.HttpRetry.BatchScope_RequestsOfOneFrame_SentTogetherAndCompletedOnce", AutomationFlagMaskHttpRetry);
+bool BatchScope_RequestsOfOneFrame_SentTogetherAndCompletedOnce::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	TArray<TSharedRef<MockHttpRequest>> Requests;
+	int32 RequestCompleted = 0;
+	int32 BatchCompleted = 0;
+	int32 RequestCompletedBeforeBatch = 0;
+	double CurrentTime = 10.0;
+	const TCHAR* Urls[] = {
+		TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/item01/locale"),
+		TEXT("http://accelbyte.example/basic/public/namespaces/game01/users/me/profiles"),
+		TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/item01/locale"),
+		TEXT("http://accelbyte.example/platform/public/namespaces/game01/users/user01/wallets/GOLD"),
+	};
+
+	{
+		FHttpBatchScope Batch(Scheduler, FVoidHandler::CreateLambda([&]()
+		{
+			BatchCompleted++;
+			RequestCompletedBeforeBatch = RequestCompleted;
+		}));
+
+		for (const TCHAR* Url : Urls)
+		{
+			auto Request = MakeShared<MockHttpRequest>();
+			Request->SetVerb(TEXT("GET"));
+			Request->SetURL(Url);
+			Request->SetHeader(TEXT("Authorization"), TEXT("Bearer user_access_token"));
+			Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+			Requests.Add(Request);
+			Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&RequestCompleted](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+			{
+				RequestCompleted++;
+			}), CurrentTime);
+		}
+
+		// Held until the scope closes
+		check(Batch.Num() == 4);
+		check(Scheduler.GetTaskCount() == 0);
+		check(Requests[0]->RetryCount == 0);
+	}
+
+	// The duplicate item request joins the first one
+	check(Requests[0]->RetryCount == 1);
+	check(Requests[1]->RetryCount == 1);
+	check(Requests[2]->RetryCount == 0);
+	check(Requests[3]->RetryCount == 1);
+	check(Scheduler.GetCoalescingStats().Hits == 1);
+
+	for (int32 i : { 0, 3, 1 })
+	{
+		check(BatchCompleted == 0);
+		((MockHttpResponse*)Requests[i]->GetResponse().Get())->SetResponseCode(200);
+		Requests[i]->SetStatus(EHttpRequestStatus::Succeeded);
+	}
+
+	check(RequestCompleted == 4);
+	check(BatchCompleted == 1);
+	check(RequestCompletedBeforeBatch == 4);
+	check(Scheduler.GetTaskCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(Journal_TornTailAndSupersededWrites_Compacted, "AccelByte.Tests.Core.HttpRetry.Journal_TornTailAndSupersededWrites_Compacted", AutomationFlagMaskHttpRetry);
+bool Journal_TornTailAndSupersededWrites_Compacted::RunTest(const FString& Parameter)
+{
+	FString Path = FPaths::ProjectSavedDir() / TEXT("AccelByteTests") / TEXT("Journal") / TEXT("journal.bin");
+	IFileManager::Get().Delete(*Path, false, false, true);
+
+	auto MakeWrite = [](const FString& Verb, const FString& Url, const FString& Content)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(Verb);
+		Request->SetURL(Url);
+		Request->SetHeader(TEXT("Authorization"), TEXT("Bearer user_access_token"));
+		Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+		Request->SetContentAsString(Content);
+
+		return Request;
+	};
+
+	const FString ProfileUrl = TEXT("http://accelbyte.example/basic/public/namespaces/game01/users/me/profiles");
+	const FString AttributeUrl = TEXT("http://accelbyte.example/soc-profile/public/namespaces/game01/users/user01/profiles/profile01/attributes/level");
+
+	{
+		FHttpJournal Journal;
+		Journal.Open(Path);
+		int64 First = Journal.Append(MakeWrite(TEXT("PUT"), ProfileUrl, TEXT("{\"language\":\"en\"}")));
+		int64 Second = Journal.Append(MakeWrite(TEXT("PUT"), AttributeUrl, TEXT("{\"value\":\"1\"}")));
+		check(First == 1 && Second == 2);
+		Journal.Release(First);
+		Journal.Release(Second);
+
+		// Only the last state of the profile is kept
+		Journal.Release(Journal.Append(MakeWrite(TEXT("PUT"), ProfileUrl, TEXT("{\"language\":\"fr\"}"))));
+		check(Journal.Num() == 2);
+		check(Journal.GetNextReplay()->Sequence == 2);
+		check(Journal.GetNextReplay()->Headers.Find(TEXT("Authorization: Bearer user_access_token")) == INDEX_NONE);
+		Journal.Close();
+	}
+
+	// A crash in the middle of an append leaves half a record behind
+	TArray<uint8> Data;
+	FFileHelper::LoadFileToArray(Data, *Path);
+	int32 IntactSize = Data.Num();
+	uint32 TornSize = 100;
+	Data.Append(reinterpret_cast<const uint8*>(&TornSize), sizeof(TornSize));
+	Data.Append(reinterpret_cast<const uint8*>("torn"), 4);
+	FFileHelper::SaveArrayToFile(Data, *Path);
+
+	{
+		FHttpJournal Journal;
+		Journal.Open(Path);
+		check(Journal.Num() == 2);
+		check(IFileManager::Get().FileSize(*Path) <= IntactSize);
+
+		FHttpJournal::FEntry* Entry = Journal.GetNextReplay();
+		check(Entry->Url == AttributeUrl);
+		Journal.Complete(Entry->Sequence);
+		Entry = Journal.GetNextReplay();
+		check(Entry->Url == ProfileUrl);
+		check(Entry->Content.Num() == FCStringAnsi::Strlen("{\"language\":\"fr\"}"));
+
+		// Sequences go on after the recovered ones
+		check(Journal.Append(MakeWrite(TEXT("POST"), ProfileUrl, TEXT("{}"))) == 4);
+		Journal.Close();
+	}
+
+	{
+		FHttpJournal Journal;
+		Journal.Open(Path);
+		check(Journal.Num() == 2);
+		Journal.Close();
+	}
+
+	IFileManager::Get().Delete(*Path, false, false, true);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(Journal_WriteNeverAccepted_DroppedAfterMaxAnswers, "AccelByte.Tests.Core.HttpRetry.Journal_WriteNeverAccepted_DroppedAfterMaxAnswers", AutomationFlagMaskHttpRetry);
+bool Journal_WriteNeverAccepted_DroppedAfterMaxAnswers::RunTest(const FString& Parameter)
+{
+	FString Path = FPaths::ProjectSavedDir() / TEXT("AccelByteTests") / TEXT("Journal") / TEXT("journal.bin");
+	IFileManager::Get().Delete(*Path, false, false, true);
+
+	auto Write = MakeShared<MockHttpRequest>();
+	Write->SetVerb(TEXT("PUT"));
+	Write->SetURL(TEXT("http://accelbyte.example/basic/public/namespaces/game01/users/me/profiles"));
+	Write->SetContentAsString(TEXT("{\"language\":\"en\"}"));
+
+	FHttpJournal Journal;
+	Journal.Open(Path);
+	int64 Blocked = Journal.Append(Write);
+	int64 Next = Journal.Append(MakeShared<MockHttpRequest>());
+
+	// Offline for as long as it takes, the write is kept
+	for (int32 i = 0; i < 2 * FHttpJournal::MaxUnsettledAnswers; i++)
+	{
+		Journal.Release(Blocked);
+	}
+
+	check(Journal.GetNextReplay()->Sequence == Blocked);
+
+	// The backend keeps answering 503, the write stops holding back the ones after it
+	for (int32 i = 0; i < FHttpJournal::MaxUnsettledAnswers - 1; i++)
+	{
+		Journal.Release(Blocked, true);
+	}
+
+	check(Journal.GetNextReplay()->Sequence == Blocked);
+	Journal.Release(Blocked, true);
+	check(Journal.Num() == 1);
+	check(Journal.GetNextReplay() == nullptr);
+	Journal.Release(Next);
+	check(Journal.GetNextReplay()->Sequence == Next);
+	Journal.Close();
+
+	IFileManager::Get().Delete(*Path, false, false, true);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_DurableWritesOffline_ReplayedInOrderAfterRestart, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_DurableWritesOffline_ReplayedInOrderAfterRestart", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_DurableWritesOffline_ReplayedInOrderAfterRestart::RunTest(const FString& Parameter)
+{
+	FString Directory = FPaths::ProjectSavedDir() / TEXT("AccelByteTests") / TEXT("Journal");
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+	Credentials UserCredentials;
+	UserCredentials.SetUserToken(TEXT("first_session_token"), TEXT("refresh_token"), 0.0, TEXT("user01"), TEXT("User"), TEXT("game01"));
+	const FString ProfileUrl = TEXT("http://accelbyte.example/basic/public/namespaces/game01/users/me/profiles");
+	const FString SlotUrl = TEXT("http://accelbyte.example/binary-store/namespaces/game01/users/user01/slots/slot01/metadata");
+	int32 WritesFailed = 0;
+
+	{
+		FHttpRetryScheduler Scheduler;
+		Scheduler.SetJournalDirectory(Directory);
+		Scheduler.PollRetry(10.0, UserCredentials);
+
+		for (const auto& Write : { TPair<FString, FString>(ProfileUrl, TEXT("{\"language\":\"en\"}")), TPair<FString, FString>(SlotUrl, TEXT("label=save")), TPair<FString, FString>(ProfileUrl, TEXT("{\"language\":\"fr\"}")) })
+		{
+			auto Request = MakeShared<MockHttpRequest>();
+			Request->SetVerb(TEXT("PUT"));
+			Request->SetURL(Write.Key);
+			Request->SetHeader(TEXT("Authorization"), TEXT("Bearer first_session_token"));
+			Request->SetContentAsString(Write.Value);
+			Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&WritesFailed](FHttpRequestPtr, FHttpResponsePtr, bool bConnectedSuccessfully)
+			{
+				WritesFailed += bConnectedSuccessfully ? 0 : 1;
+			}), 10.0, EHttpRequestClass::Interactive, FHttpRetryPolicy::Durable());
+
+			// Offline, the caller still hears about the failure
+			Request->SetStatus(EHttpRequestStatus::Failed_ConnectionError);
+		}
+
+		check(WritesFailed == 3);
+		check(Scheduler.GetPendingWriteCount() == 2);
+
+		// The game crashes before the backend is reachable again
+	}
+
+	UserCredentials.SetUserToken(TEXT("second_session_token"), TEXT("refresh_token"), 0.0, TEXT("user01"), TEXT("User"), TEXT("game01"));
+	FHttpRetryScheduler Scheduler;
+	TArray<TSharedRef<MockHttpRequest>> Replays;
+	Scheduler.SetRequestFactory([&Replays]()
+	{
+		auto Replay = MakeShared<MockHttpRequest>();
+		Replays.Add(Replay);
+
+		return FHttpRequestPtr(Replay);
+	});
+	Scheduler.SetJournalDirectory(Directory);
+	double CurrentTime = 100.0;
+	Scheduler.PollRetry(CurrentTime, UserCredentials);
+	check(Scheduler.GetPendingWriteCount() == 2);
+
+	// One at a time, oldest first, signed with the new session's token
+	check(Replays.Num() == 1);
+	check(Replays[0]->GetURL() == SlotUrl);
+	check(Replays[0]->GetHeader(TEXT("Authorization")) == TEXT("Bearer second_session_token"));
+
+	// Still offline, the replay backs off
+	Replays[0]->SetStatus(EHttpRequestStatus::Failed_ConnectionError);
+	Scheduler.PollRetry(CurrentTime, UserCredentials);
+	check(Replays.Num() == 1);
+	CurrentTime += FHttpRetryScheduler::InitialDelay + 0.1;
+	Scheduler.PollRetry(CurrentTime, UserCredentials);
+	check(Replays.Num() == 2);
+	check(Replays[1]->GetURL() == SlotUrl);
+
+	((MockHttpResponse*)Replays[1]->GetResponse().Get())->SetResponseCode(200);
+	Replays[1]->SetStatus(EHttpRequestStatus::Succeeded);
+	check(Scheduler.GetPendingWriteCount() == 1);
+	Scheduler.PollRetry(CurrentTime, UserCredentials);
+	check(Replays.Num() == 3);
+	check(Replays[2]->GetURL() == ProfileUrl);
+	check(Replays[2]->GetContent().Num() == FCStringAnsi::Strlen("{\"language\":\"fr\"}"));
+
+	((MockHttpResponse*)Replays[2]->GetResponse().Get())->SetResponseCode(200);
+	Replays[2]->SetStatus(EHttpRequestStatus::Succeeded);
+	Scheduler.PollRetry(CurrentTime, UserCredentials);
+	check(Replays.Num() == 3);
+	check(Scheduler.GetPendingWriteCount() == 0);
+
+	Scheduler.SetJournalDirectory(FString());
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_KeyedPostGotError502_RetriedWithoutDuplicate, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_KeyedPostGotError502_RetriedWithoutDuplicate", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_KeyedPostGotError502_RetriedWithoutDuplicate::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	Credentials UserCredentials;
+	double CurrentTime = 10.0;
+
+	// Stand-in for the order service: creates the order, then its gateway may lose the answer
+	TMap<FString, FString> OrdersByKey;
+	int32 OrdersCreated = 0;
+	auto Serve = [&OrdersByKey, &OrdersCreated](const TSharedRef<MockHttpRequest>& Request, int32 ResponseCode)
+	{
+		FString Key = Request->GetHeader(TEXT("Idempotency-Key"));
+		FString* OrderNo = Key.IsEmpty() ? nullptr : OrdersByKey.Find(Key);
+
+		if (OrderNo == nullptr)
+		{
+			OrdersCreated++;
+			OrderNo = &OrdersByKey.Add(Key.IsEmpty() ? FGuid::NewGuid().ToString() : Key, FString::Printf(TEXT("order%02d"), OrdersCreated));
+		}
+
+		MockHttpResponse* Response = (MockHttpResponse*)Request->GetResponse().Get();
+		Response->SetResponseCode(ResponseCode);
+		Response->SetContentAsString(FString::Printf(TEXT("{\"orderNo\":\"%s\"}"), **OrderNo));
+		Request->SetStatus(EHttpRequestStatus::Succeeded);
+	};
+
+	auto SendOrder = [&](const FHttpRetryPolicy& Policy, FString& OutOrderNo, bool& bOutIsFailed)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("POST"));
+		Request->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/users/user01/orders"));
+		Request->SetHeader(TEXT("Authorization"), TEXT("Bearer user_access_token"));
+		Request->SetContentAsString(TEXT("{\"itemId\":\"item01\",\"quantity\":1}"));
+		Scheduler.ProcessRequest(Request, CreateHttpResultHandler(THandler<FAccelByteModelsOrderInfo>::CreateLambda([&OutOrderNo](const FAccelByteModelsOrderInfo& Result)
+		{
+			OutOrderNo = Result.OrderNo;
+		}), FErrorHandler::CreateLambda([&bOutIsFailed](int32 ErrorCode, const FString& ErrorMessage)
+		{
+			bOutIsFailed = true;
+		})), CurrentTime, EHttpRequestClass::Commerce, Policy);
+
+		return Request;
+	};
+
+	FString OrderNo;
+	bool bIsFailed = false;
+	auto Request = SendOrder(FHttpRetryPolicy::Keyed(FHttpRetryPolicy::Interactive()), OrderNo, bIsFailed);
+	FString Key = Request->GetHeader(TEXT("Idempotency-Key"));
+	check(!Key.IsEmpty());
+
+	Serve(Request, EHttpResponseCodes::BadGateway);
+	CurrentTime += FHttpRetryPolicy::Interactive().MaximumDelay;
+	Scheduler.PollRetry(CurrentTime, UserCredentials);
+
+	// Sent again with the same key, the service answers with the order it already created
+	check(Request->RetryCount == 2);
+	check(Request->GetHeader(TEXT("Idempotency-Key")) == Key);
+	Serve(Request, EHttpResponseCodes::Ok);
+	check(OrderNo == TEXT("order01"));
+	check(!bIsFailed);
+	check(OrdersCreated == 1);
+
+	// Without a key a lost answer is reported instead of risking a second order
+	OrderNo.Empty();
+	Request = SendOrder(FHttpRetryPolicy::Interactive(), OrderNo, bIsFailed);
+	check(Request->GetHeader(TEXT("Idempotency-Key")).IsEmpty());
+	Serve(Request, EHttpResponseCodes::BadGateway);
+	CurrentTime += FHttpRetryPolicy::Interactive().MaximumDelay;
+	Scheduler.PollRetry(CurrentTime, UserCredentials);
+	check(Request->RetryCount == 1);
+	check(bIsFailed);
+	check(OrderNo.IsEmpty());
+	check(OrdersCreated == 2);
+	check(Scheduler.GetTaskCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HttpHistogram_RecordedFromManyThreads_PercentilesWithinBucket, "AccelByte.Tests.Core.HttpRetry.HttpHistogram_RecordedFromManyThreads_PercentilesWithinBucket", AutomationFlagMaskHttpRetry);
+bool HttpHistogram_RecordedFromManyThreads_PercentilesWithinBucket::RunTest(const FString& Parameter)
+{
+	const int32 ThreadCount = 4;
+	const int32 ValueCount = 100000;
+	FHttpHistogram Histogram;
+
+	ParallelFor(ThreadCount, [&Histogram, ValueCount](int32 Thread)
+	{
+		for (int32 Value = 1; Value <= ValueCount; Value++)
+		{
+			Histogram.Record(Value);
+		}
+	});
+
+	// Nothing is lost between threads
+	check(Histogram.GetCount() == ThreadCount * ValueCount);
+	check(Histogram.GetSum() == ThreadCount * (int64)ValueCount * (ValueCount + 1) / 2);
+	check(Histogram.GetMax() == ValueCount);
+
+	// Within the 1/8 width of a bucket
+	for (float Percentile : { 0.5f, 0.95f, 0.99f })
+	{
+		int64 Exact = FMath::CeilToInt(Percentile * ValueCount);
+		int64 Reported = Histogram.GetPercentile(Percentile);
+		check(Reported >= Exact);
+		check(Reported <= Exact + Exact / FHttpHistogram::SubBucketCount);
+	}
+
+	check(Histogram.GetPercentile(1.0f) == ValueCount);
+	check(FHttpHistogram::GetBucketIndex((1LL << FHttpHistogram::MaxValueBits) - 1) == FHttpHistogram::BucketCount - 1);
+
+	// The hot path is a handful of atomic increments
+	const int32 RecordCount = 1000000;
+	FHttpHistogram Latency;
+	double StartTime = FPlatformTime::Seconds();
+
+	for (int32 i = 0; i < RecordCount; i++)
+	{
+		Latency.Record(i & 0xFFFFF);
+	}
+
+	double RecordCost = (FPlatformTime::Seconds() - StartTime) / RecordCount;
+	UE_LOG(LogAccelByteHttpRetryTest, Log, TEXT("Histogram record %.1f ns"), RecordCost * 1e9);
+	check(RecordCost < 0.0000005);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_Completed_MetricsRecordedByEndpoint, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_Completed_MetricsRecordedByEndpoint", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_Completed_MetricsRecordedByEndpoint::RunTest(const FString& Parameter)
+{
+	FHttpRetryScheduler Scheduler;
+	Scheduler.SetMaxInFlightPerService(1);
+	FHttpMetrics& Metrics = Scheduler.GetMetrics();
+	double CurrentTime = 10.0;
+	TArray<TSharedRef<MockHttpRequest>> Requests;
+
+	for (const TCHAR* Url : { TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/item01"), TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/item02") })
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("GET"));
+		Request->SetURL(Url);
+		Requests.Add(Request);
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate(), CurrentTime);
+	}
+
+	check(Metrics.InFlightRequests.GetValue() == 1);
+	check(Metrics.QueuedRequests.GetValue() == 1);
+
+	// The first item takes two attempts, the second one waits for the slot and loses its connection
+	((MockHttpResponse*)Requests[0]->GetResponse().Get())->SetResponseCode(500);
+	Requests[0]->SetStatus(EHttpRequestStatus::Succeeded);
+	CurrentTime += FHttpRetryScheduler::InitialDelay * 2.5;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	((MockHttpResponse*)Requests[0]->GetResponse().Get())->SetResponseCode(200);
+	((MockHttpResponse*)Requests[0]->GetResponse().Get())->SetContentAsString(TEXT("{\"itemId\":\"item01\"}"));
+	Requests[0]->SetStatus(EHttpRequestStatus::Succeeded);
+	check(Metrics.QueuedRequests.GetValue() == 0);
+	Requests[1]->SetStatus(EHttpRequestStatus::Failed_ConnectionError);
+	check(Metrics.InFlightRequests.GetValue() == 0);
+
+	TSharedPtr<FHttpEndpointMetrics, ESPMode::ThreadSafe> Endpoint = Metrics.Find(HttpRequest::GetEndpointTemplate(TEXT("GET"), Requests[0]->GetURL()));
+	check(Endpoint.IsValid());
+	check(Metrics.GetEndpoints().Num() == 1);
+	check(Endpoint->Latency.GetCount() == 2);
+	check(Endpoint->Latency.GetMax() >= 500000);
+	check(Endpoint->Attempts.GetMax() == 2);
+	check(Endpoint->QueueWait.GetCount() == 2);
+	check(Endpoint->QueueWait.GetMax() >= 500000);
+	check(Endpoint->ResponseBytes.GetCount() == 1);
+	check(Endpoint->ResponseBytes.GetMax() == FCStringAnsi::Strlen("{\"itemId\":\"item01\"}"));
+	check(Endpoint->Failures[static_cast<int32>(EHttpFailureReason::None)].GetValue() == 1);
+	check(Endpoint->Failures[static_cast<int32>(EHttpFailureReason::ConnectionError)].GetValue() == 1);
+
+	Metrics.Reset();
+	check(Endpoint->Latency.GetCount() == 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_RetriedWhileTraced_EventsCorrelatedInChromeTrace, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_RetriedWhileTraced_EventsCorrelatedInChromeTrace", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_RetriedWhileTraced_EventsCorrelatedInChromeTrace::RunTest(const FString& Parameter)
+{
+	// Nothing is recorded while disabled
+	Trace::Enable(4);
+	Trace::Disable();
+	check(Trace::NewId() == 0);
+	Trace::Instant(TEXT("Test"), TEXT("Ignored"), 0);
+	{
+		Trace::FScope Scope(TEXT("Test"), TEXT("Ignored"));
+	}
+	check(Trace::GetEvents().Num() == 0);
+
+	// The oldest events are overwritten once the buffer is full
+	Trace::Enable(3);
+
+	for (int32 i = 0; i < 5; i++)
+	{
+		Trace::Instant(TEXT("Test"), TEXT("Step"), 0, FString::FromInt(i));
+	}
+
+	TArray<Trace::FEvent> Events = Trace::GetEvents();
+	check(Events.Num() == 3);
+	check(Events[0].Detail == TEXT("2"));
+	check(Events[2].Detail == TEXT("4"));
+
+	Trace::Enable(64);
+	FHttpRetryScheduler Scheduler;
+	double CurrentTime = 10.0;
+	auto Request = MakeShared<MockHttpRequest>();
+	Request->SetVerb(TEXT("GET"));
+	Request->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/item01"));
+	Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate(), CurrentTime);
+	((MockHttpResponse*)Request->GetResponse().Get())->SetResponseCode(500);
+	Request->SetStatus(EHttpRequestStatus::Succeeded);
+	CurrentTime += FHttpRetryScheduler::InitialDelay * 2.5;
+	Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	((MockHttpResponse*)Request->GetResponse().Get())->SetResponseCode(200);
+	Request->SetStatus(EHttpRequestStatus::Succeeded);
+	Trace::Disable();
+
+	Events = Trace::GetEvents();
+	Events.RemoveAll([](const Trace::FEvent& Event)
+	{
+		return FCString::Strcmp(Event.Category, TEXT("Http")) != 0;
+	});
+	check(Events.Num() == 4);
+	check(Events[0].Phase == Trace::EPhase::Begin);
+	check(Events[0].Id != 0);
+	check(FCString::Strcmp(Events[1].Name, TEXT("Dispatch")) == 0);
+	check(FCString::Strcmp(Events[2].Name, TEXT("Retry")) == 0);
+	check(Events[3].Phase == Trace::EPhase::End);
+	check(Events[3].Detail == TEXT("200"));
+
+	for (const Trace::FEvent& Event : Events)
+	{
+		check(Event.Id == Events[0].Id);
+		check(Event.Cycles >= Events[0].Cycles);
+	}
+
+	TSharedPtr<FJsonObject> Json;
+	check(FJsonSerializer::Deserialize(TJsonReaderFactory<TCHAR>::Create(Trace::ToJson()), Json));
+	const TArray<TSharedPtr<FJsonValue>>& TraceEvents = Json->GetArrayField(TEXT("traceEvents"));
+	check(TraceEvents.Num() == Trace::GetEvents().Num());
+	check(TraceEvents[0]->AsObject()->GetStringField(TEXT("ph")) == TEXT("b"));
+	check(TraceEvents[0]->AsObject()->GetStringField(TEXT("id")) == FString::Printf(TEXT("0x%llx"), Events[0].Id));
+
+	return true;
+}
+
+/**
+ * @brief Sends Count GETs through a scheduler to a simulated backend, polling every 50 ms until they all complete.
+ */
+static void RunSimulatedRequests(FHttpRetryScheduler& Scheduler, FSimulatedHttpTransport& Transport, int32 Count, TArray<int32>& OutResponseCodes, double& OutEndTime)
+{
+	OutResponseCodes.Init(-1, Count);
+	double CurrentTime = 0.0;
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		FHttpRequestPtr Request = HttpTransport::CreateRequest();
+		Request->SetVerb(TEXT("GET"));
+		Request->SetURL(FString::Printf(TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/item%02d"), i));
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&OutResponseCodes, i](FHttpRequestPtr, FHttpResponsePtr Response, bool bSucceeded)
+		{
+			OutResponseCodes[i] = bSucceeded ? Response->GetResponseCode() : 0;
+		}), CurrentTime);
+	}
+
+	while (OutResponseCodes.Contains(-1) && CurrentTime < 120.0)
+	{
+		CurrentTime += 0.05;
+		Transport.AdvanceTo(CurrentTime);
+		Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+	}
+
+	OutEndTime = CurrentTime;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProcessRequest_SimulatedLossyBackend_RetriedDeterministically, "AccelByte.Tests.Core.HttpRetry.ProcessRequest_SimulatedLossyBackend_RetriedDeterministically", AutomationFlagMaskHttpRetry);
+bool ProcessRequest_SimulatedLossyBackend_RetriedDeterministically::RunTest(const FString& Parameter)
+{
+	FSimulatedHttpTransport::FConfig Config;
+	Config.Latency = FLatencyDistribution::LogNormal(0.08, 0.4);
+	Config.StatusRates.Add(503, 0.2f);
+	Config.ConnectionErrorRate = 0.15f;
+	Config.BandwidthBytesPerSecond = 64 * 1024;
+	Config.Seed = 42;
+	const int32 RequestCount = 40;
+	TArray<int32> ResponseCodes[2];
+	double EndTimes[2];
+	int32 SentCounts[2];
+
+	for (int32 Run = 0; Run < 2; Run++)
+	{
+		auto Transport = MakeShared<FSimulatedHttpTransport, ESPMode::ThreadSafe>(Config);
+		Transport->SetResponder([](const FHttpRequestPtr& Request, FString& OutContent)
+		{
+			OutContent = FString::Printf(TEXT("{\"itemId\":\"%s\"}"), *FPaths::GetCleanFilename(Request->GetURL()));
+
+			return 200;
+		});
+		HttpTransport::Set(Transport);
+		FHttpRetryScheduler Scheduler;
+		RunSimulatedRequests(Scheduler, *Transport, RequestCount, ResponseCodes[Run], EndTimes[Run]);
+		HttpTransport::Set(nullptr);
+		SentCounts[Run] = Transport->GetStats().Sent;
+
+		check(Transport->GetInFlightCount() == 0);
+		check(Transport->GetStats().ConnectionErrors > 0);
+	}
+
+	// 503s were retried until the backend answered, lost connections failed, the same way in both runs
+	check(!ResponseCodes[0].Contains(-1));
+	check(ResponseCodes[0].FilterByPredicate([](int32 Code) { return Code == 200 || Code == 0; }).Num() == RequestCount);
+	check(ResponseCodes[0].Contains(0));
+	check(SentCounts[0] > RequestCount);
+	check(ResponseCodes[0] == ResponseCodes[1]);
+	check(SentCounts[0] == SentCounts[1]);
+	check(EndTimes[0] == EndTimes[1]);
+
+	// A backend that never answers times out like the platform, an overloaded one answers 503
+	Config = FSimulatedHttpTransport::FConfig();
+	Config.Latency = FLatencyDistribution::Constant(0.5);
+	Config.NoResponseRate = 1.0f;
+	Config.Timeout = 1.0;
+	Config.OverloadThreshold = 1;
+	auto Transport = MakeShared<FSimulatedHttpTransport, ESPMode::ThreadSafe>(Config);
+	TArray<int32> Codes;
+
+	for (int32 i = 0; i < 2; i++)
+	{
+		FHttpRequestPtr Request = Transport->CreateRequest();
+		Request->SetURL(TEXT("http://accelbyte.example/basic/v1/public/misc/time"));
+		Request->OnProcessRequestComplete().BindLambda([&Codes](FHttpRequestPtr Completed, FHttpResponsePtr Response, bool bSucceeded)
+		{
+			Codes.Add(bSucceeded ? Response->GetResponseCode() : 0);
+		});
+		check(Request->ProcessRequest());
+	}
+
+	Transport->Advance(0.75);
+	check(Codes.Num() == 1);
+	check(Codes[0] == 503);
+	check(Transport->GetNextCompletionTime() == 1.0);
+	Transport->Advance(0.5);
+	check(Codes.Num() == 2);
+	check(Codes[1] == 0);
+	check(Transport->GetStats().TimedOut == 1);
+	check(Transport->GetStats().Overloaded == 1);
+
+	return true;
+}
@@ -0,0 +1,291 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AutomationTest.h"
+#include "HAL/PlatformMemory.h"
+#include "Async/Async.h"
+#include "AccelByteHttpRetryScheduler.h"
+#include "AccelByteHttpWorker.h"
+#include "AccelByteRegistry.h"
+#include "Benchmark.h"
+#include "MockHttp.h"
+
+using AccelByte::FHttpRetryScheduler;
+using AccelByte::EHttpRequestClass;
+
+namespace
+{
+	const int32 TaskCounts[] = { 10, 1000, 10000, 100000 };
+	const int32 IdlePollCount = 1000;
+
+	/** Small counts run more often so that every count measures about as many tasks. */
+	int32 GetRunCount(int32 TaskCount)
+	{
+		return FMath::Clamp(100000 / TaskCount, 3, 200);
+	}
+
+	/** Every task is dispatched, none waits in a lane queue. */
+	void Unthrottle(FHttpRetryScheduler& Scheduler, int32 TaskCount)
+	{
+		Scheduler.SetMaxInFlight(EHttpRequestClass::Interactive, TaskCount);
+		Scheduler.SetMaxInFlightPerService(TaskCount);
+	}
+
+	void Succeed(const TSharedRef<MockHttpRequest>& Request)
+	{
+		((MockHttpResponse*)Request->GetResponse().Get())->SetResponseCode(200);
+		Request->SetStatus(EHttpRequestStatus::Succeeded);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HttpSchedulerBenchmarkInFlight, "AccelByte.Benchmarks.HttpScheduler.InFlight", AutomationFlagMaskBenchmark);
+bool HttpSchedulerBenchmarkInFlight::RunTest(const FString& Parameters)
+{
+	FBenchmarkReport Report(TEXT("HttpScheduler"));
+
+	for (int32 TaskCount : TaskCounts)
+	{
+		TArray<double> ProcessCosts;
+		TArray<double> IdlePollCosts;
+		TArray<double> CompletionCosts;
+		SIZE_T SchedulerSize = 0;
+		uint64 ProcessSize = 0;
+
+		for (int32 Run = 0; Run < GetRunCount(TaskCount); Run++)
+		{
+			uint64 UsedBefore = FPlatformMemory::GetStats().UsedPhysical;
+			FHttpRetryScheduler Scheduler;
+			Unthrottle(Scheduler, TaskCount);
+			TArray<TSharedRef<MockHttpRequest>> Requests;
+			Requests.Reserve(TaskCount);
+			int32 CompletedCount = 0;
+			double CurrentTime = 10.0;
+
+			for (int32 i = 0; i < TaskCount; i++)
+			{
+				Requests.Add(MakeShared<MockHttpRequest>());
+			}
+
+			FHttpRequestCompleteDelegate OnComplete = FHttpRequestCompleteDelegate::CreateLambda([&CompletedCount](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+			{
+				CompletedCount++;
+			});
+			double StartTime = FPlatformTime::Seconds();
+
+			for (const TSharedRef<MockHttpRequest>& Request : Requests)
+			{
+				Scheduler.ProcessRequest(Request, OnComplete, CurrentTime);
+			}
+
+			ProcessCosts.Add((FPlatformTime::Seconds() - StartTime) / TaskCount);
+			SchedulerSize = Scheduler.GetAllocatedSize();
+			ProcessSize = FPlatformMemory::GetStats().UsedPhysical - FMath::Min(UsedBefore, FPlatformMemory::GetStats().UsedPhysical);
+
+			// Nothing is due nor finished
+			CurrentTime += 0.5;
+			StartTime = FPlatformTime::Seconds();
+
+			for (int32 i = 0; i < IdlePollCount; i++)
+			{
+				Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+			}
+
+			IdlePollCosts.Add((FPlatformTime::Seconds() - StartTime) / IdlePollCount);
+
+			// Responses arrive, then the next poll settles them
+			StartTime = FPlatformTime::Seconds();
+
+			for (const TSharedRef<MockHttpRequest>& Request : Requests)
+			{
+				Succeed(Request);
+			}
+
+			Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+			CompletionCosts.Add((FPlatformTime::Seconds() - StartTime) / TaskCount);
+
+			check(CompletedCount == TaskCount);
+			check(Scheduler.GetTaskCount() == 0);
+		}
+
+		TMap<FString, int64> Counts{ { TEXT("tasks"), TaskCount } };
+		Report.Add(TEXT("ProcessRequest"), Counts, FBenchmarkReport::Median(ProcessCosts) * 1e9, TEXT("ns/op"));
+		Report.Add(TEXT("PollRetry.Idle"), Counts, FBenchmarkReport::Median(IdlePollCosts) * 1e9, TEXT("ns/op"));
+		Report.Add(TEXT("Completion"), Counts, FBenchmarkReport::Median(CompletionCosts) * 1e9, TEXT("ns/task"));
+		Report.Add(TEXT("Memory.Scheduler"), Counts, static_cast<double>(SchedulerSize) / TaskCount, TEXT("bytes/task"));
+
+		// The process figure includes the mock requests, it is only meaningful once the tasks outweigh the allocator's noise
+		if (TaskCount >= 10000)
+		{
+			Report.Add(TEXT("Memory.Process"), Counts, static_cast<double>(ProcessSize) / TaskCount, TEXT("bytes/task"));
+		}
+	}
+
+	check(!Report.Write().IsEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HttpSchedulerBenchmarkFanOut, "AccelByte.Benchmarks.HttpScheduler.CompletionFanOut", AutomationFlagMaskBenchmark);
+bool HttpSchedulerBenchmarkFanOut::RunTest(const FString& Parameters)
+{
+	FBenchmarkReport Report(TEXT("HttpSchedulerFanOut"));
+
+	for (int32 WaiterCount : TaskCounts)
+	{
+		TArray<double> JoinCosts;
+		TArray<double> FanOutCosts;
+
+		for (int32 Run = 0; Run < GetRunCount(WaiterCount); Run++)
+		{
+			FHttpRetryScheduler Scheduler;
+			TArray<TSharedRef<MockHttpRequest>> Requests;
+			Requests.Reserve(WaiterCount);
+			int32 CompletedCount = 0;
+			double CurrentTime = 10.0;
+
+			// Identical GETs share the first one's response
+			for (int32 i = 0; i < WaiterCount; i++)
+			{
+				auto Request = MakeShared<MockHttpRequest>();
+				Request->SetVerb(TEXT("GET"));
+				Request->SetURL(TEXT("http://accelbyte.example/platform/public/namespaces/game01/categories"));
+				Request->SetHeader(TEXT("Authorization"), TEXT("Bearer user_access_token"));
+				Requests.Add(Request);
+			}
+
+			FHttpRequestCompleteDelegate OnComplete = FHttpRequestCompleteDelegate::CreateLambda([&CompletedCount](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+			{
+				CompletedCount++;
+			});
+			double StartTime = FPlatformTime::Seconds();
+
+			for (const TSharedRef<MockHttpRequest>& Request : Requests)
+			{
+				Scheduler.ProcessRequest(Request, OnComplete, CurrentTime);
+			}
+
+			JoinCosts.Add((FPlatformTime::Seconds() - StartTime) / WaiterCount);
+			StartTime = FPlatformTime::Seconds();
+			Succeed(Requests[0]);
+			Scheduler.PollRetry(CurrentTime, FRegistry::Credentials);
+			FanOutCosts.Add((FPlatformTime::Seconds() - StartTime) / WaiterCount);
+
+			check(Requests[0]->RetryCount == 1);
+			check(CompletedCount == WaiterCount);
+			check(Scheduler.GetTaskCount() == 0);
+		}
+
+		TMap<FString, int64> Counts{ { TEXT("waiters"), WaiterCount } };
+		Report.Add(TEXT("ProcessRequest.Coalesced"), Counts, FBenchmarkReport::Median(JoinCosts) * 1e9, TEXT("ns/op"));
+		Report.Add(TEXT("FanOut"), Counts, FBenchmarkReport::Median(FanOutCosts) * 1e9, TEXT("ns/waiter"));
+	}
+
+	check(!Report.Write().IsEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HttpSchedulerBenchmarkCompletionLatency, "AccelByte.Benchmarks.HttpScheduler.CompletionLatency", AutomationFlagMaskBenchmark);
+bool HttpSchedulerBenchmarkCompletionLatency::RunTest(const FString& Parameters)
+{
+	FBenchmarkReport Report(TEXT("HttpSchedulerCompletionLatency"));
+	const int32 RequestCount = 100;
+	const float PollInterval = 0.05f;
+	const float CompletionSpacing = 0.002f;
+	TArray<double> FinishTimes;
+	FinishTimes.SetNumZeroed(RequestCount);
+
+	// Completion found by polling the request status with a real cadence, as the scheduler used to
+	TArray<double> PolledLatencies;
+
+	{
+		FThreadSafeCounter FinishedCount;
+		TFuture<void> Transport = Async<void>(EAsyncExecution::Thread, [&FinishTimes, &FinishedCount, RequestCount, CompletionSpacing]()
+		{
+			for (int32 i = 0; i < RequestCount; i++)
+			{
+				FPlatformProcess::Sleep(CompletionSpacing);
+				FinishTimes[i] = FPlatformTime::Seconds();
+				FinishedCount.Increment();
+			}
+		});
+
+		while (PolledLatencies.Num() < RequestCount)
+		{
+			FPlatformProcess::Sleep(PollInterval);
+			double PollTime = FPlatformTime::Seconds();
+
+			for (int32 i = PolledLatencies.Num(); i < FinishedCount.GetValue(); i++)
+			{
+				PolledLatencies.Add(PollTime - FinishTimes[i]);
+			}
+		}
+
+		Transport.Wait();
+	}
+
+	// Completion reported by the request's callback, fired from the transport thread and handled by the worker
+	FHttpRetryScheduler Scheduler;
+	AccelByte::Credentials UserCredentials;
+	AccelByte::FHttpWorker Worker(Scheduler, UserCredentials);
+	TArray<TSharedRef<MockHttpRequest>> Requests;
+	TArray<double> CallbackLatencies;
+	CallbackLatencies.SetNumZeroed(RequestCount);
+	FThreadSafeCounter DeliveredCount;
+	Unthrottle(Scheduler, RequestCount);
+	check(Worker.Startup());
+
+	for (int32 i = 0; i < RequestCount; i++)
+	{
+		auto Request = MakeShared<MockHttpRequest>();
+		Request->SetVerb(TEXT("GET"));
+		Request->SetURL(FString::Printf(TEXT("http://accelbyte.example/platform/public/namespaces/game01/items/%d"), i));
+		Requests.Add(Request);
+		Scheduler.ProcessRequest(Request, FHttpRequestCompleteDelegate::CreateLambda([&CallbackLatencies, &FinishTimes, &DeliveredCount, i](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+		{
+			CallbackLatencies[i] = FPlatformTime::Seconds() - FinishTimes[i];
+			DeliveredCount.Increment();
+		}), FPlatformTime::Seconds());
+	}
+
+	double Timeout = FPlatformTime::Seconds() + 10.0;
+
+	while (Requests.Last()->GetStatus() != EHttpRequestStatus::Processing && FPlatformTime::Seconds() < Timeout)
+	{
+		FPlatformProcess::Sleep(0.01f);
+	}
+
+	TFuture<void> Transport = Async<void>(EAsyncExecution::Thread, [&Requests, &FinishTimes, CompletionSpacing]()
+	{
+		for (int32 i = 0; i < Requests.Num(); i++)
+		{
+			FPlatformProcess::Sleep(CompletionSpacing);
+			((MockHttpResponse*)Requests[i]->GetResponse().Get())->SetResponseCode(200);
+			FinishTimes[i] = FPlatformTime::Seconds();
+			Requests[i]->SetStatus(EHttpRequestStatus::Succeeded);
+		}
+	});
+
+	while (DeliveredCount.GetValue() < RequestCount && FPlatformTime::Seconds() < Timeout)
+	{
+		FPlatformProcess::Sleep(0.01f);
+	}
+
+	Transport.Wait();
+	Worker.Shutdown();
+	check(DeliveredCount.GetValue() == RequestCount);
+	check(Scheduler.GetTaskCount() == 0);
+
+	PolledLatencies.Sort();
+	CallbackLatencies.Sort();
+	TMap<FString, int64> Counts{ { TEXT("requests"), RequestCount }, { TEXT("pollIntervalMs"), static_cast<int64>(PollInterval * 1000) } };
+	Report.Add(TEXT("Completion.Callback.P50"), Counts, CallbackLatencies[RequestCount / 2] * 1e6, TEXT("us"));
+	Report.Add(TEXT("Completion.Callback.P99"), Counts, CallbackLatencies[(RequestCount * 99) / 100] * 1e6, TEXT("us"));
+	Report.Add(TEXT("Completion.Polled.P50"), Counts, PolledLatencies[RequestCount / 2] * 1e6, TEXT("us"));
+	Report.Add(TEXT("Completion.Polled.P99"), Counts, PolledLatencies[(RequestCount * 99) / 100] * 1e6, TEXT("us"));
+
+	check(!Report.Write().IsEmpty());
+
+	return true;
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Payloads as the services send them, for the model (de)serialization benchmarks.
+ * Each element is one captured record, fields the SDK doesn't model included; {i} marks where the record's index goes so that ids and names differ along a page.
+ */
+namespace JsonBenchmarkCorpus
+{
+	/** Element counts of the pages and arrays, from a single record to the largest page a service returns. */
+	const TArray<int32>& GetElementCounts();
+
+	/** Element, element, ..., Count times, comma separated. */
+	FString Repeat(const TCHAR* Element, int32 Count);
+	/** [Element, ...]. */
+	FString Array(const TCHAR* Element, int32 Count);
+	/** {"data":[Element, ...],"paging":{...}}, the sliced results of the Platform service. */
+	FString SlicedPage(const TCHAR* Element, int32 Count);
+	/** Element as a single object, i.e. its first record. */
+	FString Object(const TCHAR* Element);
+
+	/** friendsPresenceResponse with Count friends, as converted by LobbyMessageToJson. */
+	FString FriendsPresence(int32 Count);
+	/** listOfFriendsResponse with Count friends, as converted by LobbyMessageToJson. */
+	FString FriendList(int32 Count);
+
+	// AccelByteItemModels.h
+	extern const TCHAR* const Item;
+	// AccelByteEntitlementModels.h
+	extern const TCHAR* const Entitlement;
+	// AccelByteOrderModels.h
+	extern const TCHAR* const Order;
+	extern const TCHAR* const OrderHistory;
+	extern const TCHAR* const OrderCreate;
+	// AccelByteCategoryModels.h
+	extern const TCHAR* const Category;
+	// AccelByteWalletModels.h
+	extern const TCHAR* const Wallet;
+	// AccelByteGameProfileModels.h
+	extern const TCHAR* const GameProfile;
+	extern const TCHAR* const PublicGameProfile;
+	extern const TCHAR* const GameProfileRequest;
+	// AccelByteCloudStorageModels.h
+	extern const TCHAR* const Slot;
+	// AccelByteUserProfileModels.h
+	extern const TCHAR* const UserProfile;
+	extern const TCHAR* const UserProfileUpdate;
+	// AccelByteUserModels.h
+	extern const TCHAR* const UserData;
+	extern const TCHAR* const PlatformLink;
+	extern const TCHAR* const Register;
+	// AccelByteOauth2Models.h
+	extern const TCHAR* const Token;
+}
@@ -0,0 +1,282 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AutomationTest.h"
+#include "JsonObjectConverter.h"
+#include "AccelByteError.h"
+#include "AccelByteJsonDecoder.h"
+#include "Models/AccelByteItemModels.h"
+#include "Models/AccelByteEntitlementModels.h"
+#include "Models/AccelByteOrderModels.h"
+#include "Models/AccelByteCategoryModels.h"
+#include "Models/AccelByteWalletModels.h"
+#include "Models/AccelByteGameProfileModels.h"
+#include "Models/AccelByteCloudStorageModels.h"
+#include "Models/AccelByteUserProfileModels.h"
+#include "Models/AccelByteUserModels.h"
+#include "Models/AccelByteOauth2Models.h"
+#include "Models/AccelByteLobbyModels.h"
+#include "JsonBenchmarkCorpus.h"
+#include "MockHttp.h"
+
+namespace JsonDecoder = AccelByte::JsonDecoder;
+
+static const int32 AutomationFlagMaskJsonDecoder = (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ClientContext);
+
+namespace
+{
+	TArray<uint8> ToUtf8(const FString& Json)
+	{
+		FTCHARToUTF8 Converted(*Json);
+
+		return TArray<uint8>(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	}
+
+	/** Bytes as written, e.g. to hand the decoder malformed UTF-8. */
+	TArray<uint8> ToBytes(const ANSICHAR* Bytes)
+	{
+		return TArray<uint8>(reinterpret_cast<const uint8*>(Bytes), FCStringAnsi::Strlen(Bytes));
+	}
+
+	FHttpResponsePtr MakeResponse(const TArray<uint8>& Content)
+	{
+		TSharedRef<MockHttpResponse, ESPMode::ThreadSafe> Response = MakeShared<MockHttpResponse, ESPMode::ThreadSafe>();
+		Response->SetContent(Content);
+
+		return Response;
+	}
+
+	template<class T>
+	FString ToJson(const T& Value)
+	{
+		FString Json;
+		FJsonObjectConverter::UStructToJsonObjectString(Value, Json);
+
+		return Json;
+	}
+
+	template<class T>
+	FString ToJson(const TArray<T>& Values)
+	{
+		FString Json;
+
+		for (const T& Value : Values)
+		{
+			Json += ToJson(Value) + TEXT("\n");
+		}
+
+		return Json;
+	}
+
+	template<class T>
+	bool Convert(const FString& Json, T& OutResult)
+	{
+		return FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OutResult, 0, 0);
+	}
+
+	template<class T>
+	bool Convert(const FString& Json, TArray<T>& OutResult)
+	{
+		return FJsonObjectConverter::JsonArrayStringToUStruct(Json, &OutResult, 0, 0);
+	}
+
+	template<class T>
+	bool TryDecode(const TArray<uint8>& Content, T& OutResult)
+	{
+		return JsonDecoder::TryDecodeObject(T::StaticStruct(), &OutResult, Content.GetData(), Content.Num());
+	}
+
+	template<class T>
+	bool TryDecode(const TArray<uint8>& Content, TArray<T>& OutResult)
+	{
+		return JsonDecoder::TryDecodeArray(T::StaticStruct(), Content.GetData(), Content.Num(), [&OutResult]() -> void*
+		{
+			return &OutResult[OutResult.AddDefaulted()];
+		});
+	}
+
+	/** Whether the decoder reads Content on its own, without falling back to the converter. */
+	template<class T>
+	bool IsStreamed(const TArray<uint8>& Content)
+	{
+		T Result;
+
+		return TryDecode(Content, Result);
+	}
+
+	/** Whether JsonDecoder::Decode returns and fills what FJsonObjectConverter alone does with the same response. */
+	template<class T>
+	bool DecodesAsConverter(const TArray<uint8>& Content)
+	{
+		FHttpResponsePtr Response = MakeResponse(Content);
+		T Expected;
+		bool bIsConverted = Convert(Response->GetContentAsString(), Expected);
+		T Decoded;
+		bool bIsDecoded = JsonDecoder::Decode(Response, Decoded);
+
+		return bIsDecoded == bIsConverted && ToJson(Decoded).Equals(ToJson(Expected), ESearchCase::CaseSensitive);
+	}
+
+	template<class T>
+	bool IsStreamedAsConverter(const TArray<uint8>& Content)
+	{
+		return IsStreamed<T>(Content) && DecodesAsConverter<T>(Content);
+	}
+
+	template<class T>
+	bool FallsBackAsConverter(const TArray<uint8>& Content)
+	{
+		return !IsStreamed<T>(Content) && DecodesAsConverter<T>(Content);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(Decode_BenchmarkCorpus_StreamedAsConverter, "AccelByte.Tests.Core.JsonDecoder.Decode_BenchmarkCorpus_StreamedAsConverter", AutomationFlagMaskJsonDecoder);
+bool Decode_BenchmarkCorpus_StreamedAsConverter::RunTest(const FString& Parameters)
+{
+	using namespace JsonBenchmarkCorpus;
+
+	for (int32 Count : { 0, 1, 10, 100 })
+	{
+		check(IsStreamedAsConverter<FAccelByteModelsItemPagingSlicedResult>(ToUtf8(SlicedPage(Item, Count))));
+		check(IsStreamedAsConverter<FAccelByteModelsEntitlementPagingSlicedResult>(ToUtf8(SlicedPage(Entitlement, Count))));
+		check(IsStreamedAsConverter<TArray<FAccelByteModelsOrderHistoryInfo>>(ToUtf8(Array(OrderHistory, Count))));
+		check(IsStreamedAsConverter<TArray<FAccelByteModelsFullCategoryInfo>>(ToUtf8(Array(Category, Count))));
+		check(IsStreamedAsConverter<TArray<FAccelByteModelsGameProfile>>(ToUtf8(Array(GameProfile, Count))));
+		check(IsStreamedAsConverter<TArray<FAccelByteModelsPublicGameProfile>>(ToUtf8(Array(PublicGameProfile, Count))));
+		check(IsStreamedAsConverter<TArray<FAccelByteModelsSlot>>(ToUtf8(Array(Slot, Count))));
+		check(IsStreamedAsConverter<TArray<FPlatformLink>>(ToUtf8(Array(PlatformLink, Count))));
+		check(IsStreamedAsConverter<FAccelByteModelsGetOnlineUsersResponse>(ToUtf8(FriendsPresence(Count))));
+		check(IsStreamedAsConverter<FAccelByteModelsLoadFriendListResponse>(ToUtf8(FriendList(Count))));
+	}
+
+	check(IsStreamedAsConverter<FAccelByteModelsItemInfo>(ToUtf8(Object(Item))));
+	check(IsStreamedAsConverter<FAccelByteModelsOrderInfo>(ToUtf8(Object(Order))));
+	check(IsStreamedAsConverter<FAccelByteModelsWalletInfo>(ToUtf8(Object(Wallet))));
+	check(IsStreamedAsConverter<FAccelByteModelsUserProfileInfo>(ToUtf8(Object(UserProfile))));
+	check(IsStreamedAsConverter<FUserData>(ToUtf8(Object(UserData))));
+	check(IsStreamedAsConverter<FOauth2Token>(ToUtf8(Object(Token))));
+	check(IsStreamedAsConverter<FAccelByteModelsOrderCreate>(ToUtf8(OrderCreate)));
+	check(IsStreamedAsConverter<FAccelByteModelsGameProfileRequest>(ToUtf8(GameProfileRequest)));
+	check(IsStreamedAsConverter<FAccelByteModelsUserProfileUpdateRequest>(ToUtf8(UserProfileUpdate)));
+	check(IsStreamedAsConverter<FRegisterRequest>(ToUtf8(Register)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(Decode_EscapesUnicodeAndLooseTypes_StreamedAsConverter, "AccelByte.Tests.Core.JsonDecoder.Decode_EscapesUnicodeAndLooseTypes_StreamedAsConverter", AutomationFlagMaskJsonDecoder);
+bool Decode_EscapesUnicodeAndLooseTypes_StreamedAsConverter::RunTest(const FString& Parameters)
+{
+	TArray<uint8> Content = ToBytes(
+		" {\r\n\t\"title\" : \"Line\\n\\\"quoted\\\" \\\\ \\/ tab\\t \\u00e9\\u65E5 \xC3\xA9\xE6\x97\xA5\","
+		"\"LongDescription\":\"\xF0\x9F\x8E\xAE padded well past sixteen bytes so the wide scan runs \xC3\xA9\","
+		"\"Description\":null,"
+		"\"Na\\u006De\":\"sword\","
+		"\"extra\":{\"nested\":[1,-2.5e+3,{\"deep\":[true,false,null]}],\"text\":\"\\u0041\"},"
+		"\"UseCount\":\"12\","
+		"\"MaxCount\":3.0E1,"
+		"\"MaxCountPerUser\":-7.9,"
+		"\"CreatedAt\":\"2019-03-04T05:06:07.089Z\","
+		"\"Tags\":[\"a\",null,\"c\"],"
+		"\"RegionData\":[{\"Price\":100,\"CurrencyCode\":\"GOLD\",\"unknown\":[]}],"
+		"\"ThumbnailImage\":{\"Height\":0,\"Width\":-0}"
+		"} \n");
+
+	check(IsStreamedAsConverter<FAccelByteModelsItemInfo>(Content));
+
+	FString Title = TEXT("Line\n\"quoted\" \\ / tab\t ");
+	Title.AppendChar(0xE9);
+	Title.AppendChar(0x65E5);
+	Title.AppendChar(TEXT(' '));
+	Title.AppendChar(0xE9);
+	Title.AppendChar(0x65E5);
+
+	FAccelByteModelsItemInfo Item;
+	check(JsonDecoder::Decode(MakeResponse(Content), Item));
+	check(Item.Title.Equals(Title, ESearchCase::CaseSensitive));
+	check(Item.Description.IsEmpty());
+	check(Item.Name == TEXT("sword"));
+	check(Item.UseCount == 12);
+	check(Item.MaxCount == 30);
+	check(Item.MaxCountPerUser == -7);
+	check(Item.CreatedAt.GetYear() == 2019 && Item.CreatedAt.GetDay() == 4 && Item.CreatedAt.GetSecond() == 7);
+	check(Item.Tags.Num() == 3 && Item.Tags[0] == TEXT("a") && Item.Tags[1].IsEmpty() && Item.Tags[2] == TEXT("c"));
+	check(Item.RegionData.Num() == 1 && Item.RegionData[0].Price == 100 && Item.RegionData[0].CurrencyCode == TEXT("GOLD"));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(Decode_EnumsMapsAndArrays_StreamedAsConverter, "AccelByte.Tests.Core.JsonDecoder.Decode_EnumsMapsAndArrays_StreamedAsConverter", AutomationFlagMaskJsonDecoder);
+bool Decode_EnumsMapsAndArrays_StreamedAsConverter::RunTest(const FString& Parameters)
+{
+	TArray<uint8> Entitlements = ToBytes("[{\"Status\":\"active\",\"Type\":1,\"Clazz\":null,\"AppType\":\"GAME\"},{}]");
+	TArray<uint8> Profiles = ToBytes("[{\"attributes\":{\"level\":\"3\",\"Rank\":\"gold\",\"skipped\":null,\"caf\xC3\xA9\":\"\\u00e9\"},\"tags\":[]}]");
+	TArray<uint8> Empty = ToBytes("[ ]");
+
+	check(IsStreamedAsConverter<TArray<FAccelByteModelsEntitlementInfo>>(Entitlements));
+	check(IsStreamedAsConverter<TArray<FAccelByteModelsGameProfile>>(Profiles));
+	check(IsStreamedAsConverter<TArray<FAccelByteModelsGameProfile>>(Empty));
+
+	TArray<FAccelByteModelsGameProfile> Result;
+	check(JsonDecoder::Decode(MakeResponse(Profiles), Result));
+	check(Result.Num() == 1);
+	check(Result[0].attributes.Num() == 3);
+	check(Result[0].attributes.FindRef(TEXT("rank")) == TEXT("gold"));
+	check(!Result[0].attributes.Contains(TEXT("skipped")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(Decode_UnmirroredInput_FallsBackAsConverter, "AccelByte.Tests.Core.JsonDecoder.Decode_UnmirroredInput_FallsBackAsConverter", AutomationFlagMaskJsonDecoder);
+bool Decode_UnmirroredInput_FallsBackAsConverter::RunTest(const FString& Parameters)
+{
+	JsonDecoder::FDecoderStats Before = JsonDecoder::GetStats();
+
+	// Repeated keys, the FJsonObject keeps the last one
+	check(FallsBackAsConverter<FAccelByteModelsItemInfo>(ToBytes("{\"Title\":\"first\",\"title\":\"last\"}")));
+	check(FallsBackAsConverter<FAccelByteModelsGameProfile>(ToBytes("{\"attributes\":{\"level\":\"1\",\"LEVEL\":\"2\"}}")));
+	// Malformed documents
+	check(FallsBackAsConverter<FAccelByteModelsItemInfo>(ToBytes("{\"Title\":\"a\",}")));
+	check(FallsBackAsConverter<FAccelByteModelsItemInfo>(ToBytes("{\"Title\":\"a\"")));
+	check(FallsBackAsConverter<FAccelByteModelsItemInfo>(ToBytes("{\"Title\":\"a\"} trailing")));
+	check(FallsBackAsConverter<FAccelByteModelsItemInfo>(ToBytes("{\"UseCount\":012}")));
+	check(FallsBackAsConverter<FAccelByteModelsItemInfo>(ToBytes("")));
+	// Values the converter reads its own way
+	check(FallsBackAsConverter<FAccelByteModelsEntitlementInfo>(ToBytes("{\"Status\":\"GONE\"}")));
+	check(FallsBackAsConverter<FAccelByteModelsItemInfo>(ToBytes("{\"Title\":true}")));
+	check(FallsBackAsConverter<FAccelByteModelsItemInfo>(ToBytes("{\"CreatedAt\":\"not a date\"}")));
+	check(FallsBackAsConverter<FAccelByteModelsItemInfo>(ToBytes("{\"Tags\":\"a\"}")));
+	// Text the platform's conversion might read differently
+	check(FallsBackAsConverter<FAccelByteModelsItemInfo>(ToBytes("{\"Title\":\"\xC3\x28\"}")));
+	check(FallsBackAsConverter<FAccelByteModelsItemInfo>(ToBytes("{\"Title\":\"\\ud83c\\udfae\"}")));
+	check(FallsBackAsConverter<FAccelByteModelsItemInfo>(ToBytes("\xEF\xBB\xBF{\"Title\":\"a\"}")));
+
+	JsonDecoder::FDecoderStats After = JsonDecoder::GetStats();
+	check(After.FellBack - Before.FellBack >= 14);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HandleHttpError_ErrorBody_DecodedCodeAndMessage, "AccelByte.Tests.Core.JsonDecoder.HandleHttpError_ErrorBody_DecodedCodeAndMessage", AutomationFlagMaskJsonDecoder);
+bool HandleHttpError_ErrorBody_DecodedCodeAndMessage::RunTest(const FString& Parameters)
+{
+	TSharedRef<MockHttpResponse, ESPMode::ThreadSafe> ErrorResponse = MakeShared<MockHttpResponse, ESPMode::ThreadSafe>();
+	ErrorResponse->SetResponseCode(400);
+	ErrorResponse->SetContentAsString(TEXT("{\"numericErrorCode\":12345,\"errorCode\":\"invalid\",\"errorMessage\":\"Name is too long\",\"attributes\":{}}"));
+	TSharedRef<MockHttpResponse, ESPMode::ThreadSafe> GatewayResponse = MakeShared<MockHttpResponse, ESPMode::ThreadSafe>();
+	GatewayResponse->SetResponseCode(502);
+	GatewayResponse->SetContentAsString(TEXT("<html>Bad Gateway</html>"));
+
+	int32 ErrorCode = 0;
+	FString ErrorMessage;
+	AccelByte::HandleHttpError(nullptr, ErrorResponse, ErrorCode, ErrorMessage);
+	int32 GatewayCode = 0;
+	FString GatewayMessage;
+	AccelByte::HandleHttpError(nullptr, GatewayResponse, GatewayCode, GatewayMessage);
+
+	check(ErrorCode == 12345);
+	check(ErrorMessage.EndsWith(TEXT("Name is too long")));
+	check(GatewayCode == 502);
+
+	return true;
+}
@@ -0,0 +1,232 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AutomationTest.h"
+#include "JsonObjectConverter.h"
+#include "AccelByteError.h"
+#include "AccelByteJsonDecoder.h"
+#include "Models/AccelByteItemModels.h"
+#include "Models/AccelByteEntitlementModels.h"
+#include "Models/AccelByteOrderModels.h"
+#include "Models/AccelByteCategoryModels.h"
+#include "Models/AccelByteWalletModels.h"
+#include "Models/AccelByteGameProfileModels.h"
+#include "Models/AccelByteCloudStorageModels.h"
+#include "Models/AccelByteUserProfileModels.h"
+#include "Models/AccelByteUserModels.h"
+#include "Models/AccelByteOauth2Models.h"
+#include "Models/AccelByteLobbyModels.h"
+#include "Benchmark.h"
+#include "JsonBenchmarkCorpus.h"
+#include "MockHttp.h"
+
+namespace
+{
+	/** Each timed batch covers about this much payload, small payloads are decoded many times over. */
+	const int64 BatchBytes = 4 * 1024 * 1024;
+	const int32 MaxBatchSize = 2000;
+	const int32 BatchCount = 5;
+
+	template<class T>
+	FString GetTypeName(const T*)
+	{
+		return TEXT("F") + T::StaticStruct()->GetName();
+	}
+
+	template<class T>
+	FString GetTypeName(const TArray<T>*)
+	{
+		return FString::Printf(TEXT("TArray<F%s>"), *T::StaticStruct()->GetName());
+	}
+
+	struct FDecodeCost
+	{
+		double Seconds;
+		int64 AllocationCount;
+		int64 PeakBytes;
+	};
+
+	/** Decodes Response the way a response handler does; median time, then allocations and peak memory of one decode. */
+	template<class T>
+	FDecodeCost MeasureDecode(const FHttpResponsePtr& Response, int32 BatchSize, const TFunction<bool(const T&)>& IsDecoded)
+	{
+		TArray<double> Costs;
+
+		for (int32 Batch = 0; Batch < BatchCount; Batch++)
+		{
+			double StartTime = FPlatformTime::Seconds();
+
+			for (int32 i = 0; i < BatchSize; i++)
+			{
+				T Result;
+				AccelByte::DecodeHttpResult(Response, Result);
+			}
+
+			Costs.Add((FPlatformTime::Seconds() - StartTime) / BatchSize);
+		}
+
+		FDecodeCost Cost{ FBenchmarkReport::Median(Costs), 0, 0 };
+		bool bIsDecoded = false;
+		{
+			FBenchmarkAllocationScope Allocations;
+			{
+				T Result;
+				AccelByte::DecodeHttpResult(Response, Result);
+				bIsDecoded = IsDecoded(Result);
+			}
+			Cost.AllocationCount = Allocations.GetAllocationCount();
+			Cost.PeakBytes = Allocations.GetPeakBytes();
+		}
+
+		// A payload the converter rejects would be measured as a very fast decode
+		check(bIsDecoded);
+
+		return Cost;
+	}
+
+	void ReportDecode(FBenchmarkReport& Report, const FString& Name, const TMap<FString, int64>& Parameters, int64 Bytes, const FDecodeCost& Cost)
+	{
+		Report.Add(Name, Parameters, Bytes / Cost.Seconds / 1e6, TEXT("MB/s"));
+		Report.Add(Name + TEXT(".Allocations"), Parameters, static_cast<double>(Cost.AllocationCount), TEXT("allocations"));
+		Report.Add(Name + TEXT(".PeakMemory"), Parameters, static_cast<double>(Cost.PeakBytes), TEXT("bytes"));
+	}
+
+	/** Reports the streaming decoder, and FJsonObjectConverter on its own as the .Converter baseline. */
+	template<class T>
+	void BenchmarkDecode(FBenchmarkReport& Report, const FString& Header, const FString& Json, int32 ElementCount, const TFunction<bool(const T&)>& IsDecoded)
+	{
+		TSharedRef<MockHttpResponse, ESPMode::ThreadSafe> Content = MakeShared<MockHttpResponse, ESPMode::ThreadSafe>();
+		Content->SetContentAsString(Json);
+		FHttpResponsePtr Response = Content;
+		int64 Bytes = Content->GetContentLength();
+		int32 BatchSize = static_cast<int32>(FMath::Clamp<int64>(BatchBytes / Bytes, 1, MaxBatchSize));
+
+		AccelByte::JsonDecoder::SetEnabled(false);
+		FDecodeCost ConverterCost = MeasureDecode<T>(Response, BatchSize, IsDecoded);
+		AccelByte::JsonDecoder::SetEnabled(true);
+		FDecodeCost DecoderCost = MeasureDecode<T>(Response, BatchSize, IsDecoded);
+
+		FString Name = FString::Printf(TEXT("%s.%s.Decode"), *Header, *GetTypeName(static_cast<const T*>(nullptr)));
+		TMap<FString, int64> Parameters{ { TEXT("elements"), ElementCount }, { TEXT("bytes"), Bytes } };
+		ReportDecode(Report, Name, Parameters, Bytes, DecoderCost);
+		ReportDecode(Report, Name + TEXT(".Converter"), Parameters, Bytes, ConverterCost);
+	}
+
+	/** Decodes every page size of the corpus. */
+	template<class T>
+	void BenchmarkDecodePages(FBenchmarkReport& Report, const FString& Header, const TFunction<FString(int32)>& MakeJson, const TFunction<int32(const T&)>& GetElementCount)
+	{
+		for (int32 ElementCount : JsonBenchmarkCorpus::GetElementCounts())
+		{
+			BenchmarkDecode<T>(Report, Header, MakeJson(ElementCount), ElementCount, [&](const T& Result)
+			{
+				return GetElementCount(Result) == ElementCount;
+			});
+		}
+	}
+
+	/** Encodes a request body the way the API classes do before sending it. */
+	template<class T>
+	void BenchmarkEncode(FBenchmarkReport& Report, const FString& Header, const FString& Json)
+	{
+		T Request;
+		bool bIsDecoded = FJsonObjectConverter::JsonObjectStringToUStruct(Json, &Request, 0, 0);
+		check(bIsDecoded);
+		FString Content;
+		FJsonObjectConverter::UStructToJsonObjectString(Request, Content);
+		int64 Bytes = FTCHARToUTF8(*Content).Length();
+		int32 BatchSize = static_cast<int32>(FMath::Clamp<int64>(BatchBytes / Bytes, 1, MaxBatchSize));
+		TArray<double> Costs;
+
+		for (int32 Batch = 0; Batch < BatchCount; Batch++)
+		{
+			double StartTime = FPlatformTime::Seconds();
+
+			for (int32 i = 0; i < BatchSize; i++)
+			{
+				FString Body;
+				FJsonObjectConverter::UStructToJsonObjectString(Request, Body);
+			}
+
+			Costs.Add((FPlatformTime::Seconds() - StartTime) / BatchSize);
+		}
+
+		int64 AllocationCount = 0;
+		int64 PeakBytes = 0;
+		{
+			FBenchmarkAllocationScope Allocations;
+			{
+				FString Body;
+				FJsonObjectConverter::UStructToJsonObjectString(Request, Body);
+			}
+			AllocationCount = Allocations.GetAllocationCount();
+			PeakBytes = Allocations.GetPeakBytes();
+		}
+
+		FString Name = FString::Printf(TEXT("%s.%s.Encode"), *Header, *GetTypeName(static_cast<const T*>(nullptr)));
+		TMap<FString, int64> Parameters{ { TEXT("elements"), 1 }, { TEXT("bytes"), Bytes } };
+		Report.Add(Name, Parameters, Bytes / FBenchmarkReport::Median(Costs) / 1e6, TEXT("MB/s"));
+		Report.Add(Name + TEXT(".Allocations"), Parameters, static_cast<double>(AllocationCount), TEXT("allocations"));
+		Report.Add(Name + TEXT(".PeakMemory"), Parameters, static_cast<double>(PeakBytes), TEXT("bytes"));
+	}
+
+	template<class T>
+	int32 GetDataCount(const T& Result)
+	{
+		return Result.Data.Num();
+	}
+
+	template<class T>
+	int32 GetArrayCount(const TArray<T>& Result)
+	{
+		return Result.Num();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(JsonModelBenchmarkDecode, "AccelByte.Benchmarks.JsonModels.Decode", AutomationFlagMaskBenchmark);
+bool JsonModelBenchmarkDecode::RunTest(const FString& Parameters)
+{
+	using namespace JsonBenchmarkCorpus;
+
+	FBenchmarkReport Report(TEXT("JsonModelsDecode"));
+
+	BenchmarkDecodePages<FAccelByteModelsItemPagingSlicedResult>(Report, TEXT("AccelByteItemModels"), [](int32 Count) { return SlicedPage(Item, Count); }, &GetDataCount<FAccelByteModelsItemPagingSlicedResult>);
+	BenchmarkDecode<FAccelByteModelsItemInfo>(Report, TEXT("AccelByteItemModels"), Object(Item), 1, [](const FAccelByteModelsItemInfo& Result) { return Result.RegionData.Num() == 1; });
+	BenchmarkDecodePages<FAccelByteModelsEntitlementPagingSlicedResult>(Report, TEXT("AccelByteEntitlementModels"), [](int32 Count) { return SlicedPage(Entitlement, Count); }, &GetDataCount<FAccelByteModelsEntitlementPagingSlicedResult>);
+	BenchmarkDecode<FAccelByteModelsOrderInfo>(Report, TEXT("AccelByteOrderModels"), Object(Order), 1, [](const FAccelByteModelsOrderInfo& Result) { return Result.Transactions.Num() == 1; });
+	BenchmarkDecodePages<TArray<FAccelByteModelsOrderHistoryInfo>>(Report, TEXT("AccelByteOrderModels"), [](int32 Count) { return Array(OrderHistory, Count); }, &GetArrayCount<FAccelByteModelsOrderHistoryInfo>);
+	BenchmarkDecodePages<TArray<FAccelByteModelsFullCategoryInfo>>(Report, TEXT("AccelByteCategoryModels"), [](int32 Count) { return Array(Category, Count); }, &GetArrayCount<FAccelByteModelsFullCategoryInfo>);
+	BenchmarkDecode<FAccelByteModelsWalletInfo>(Report, TEXT("AccelByteWalletModels"), Object(Wallet), 1, [](const FAccelByteModelsWalletInfo& Result) { return Result.Balance == 48300; });
+	BenchmarkDecodePages<TArray<FAccelByteModelsGameProfile>>(Report, TEXT("AccelByteGameProfileModels"), [](int32 Count) { return Array(GameProfile, Count); }, &GetArrayCount<FAccelByteModelsGameProfile>);
+	BenchmarkDecodePages<TArray<FAccelByteModelsPublicGameProfile>>(Report, TEXT("AccelByteGameProfileModels"), [](int32 Count) { return Array(PublicGameProfile, Count); }, &GetArrayCount<FAccelByteModelsPublicGameProfile>);
+	BenchmarkDecodePages<TArray<FAccelByteModelsSlot>>(Report, TEXT("AccelByteCloudStorageModels"), [](int32 Count) { return Array(Slot, Count); }, &GetArrayCount<FAccelByteModelsSlot>);
+	BenchmarkDecode<FAccelByteModelsUserProfileInfo>(Report, TEXT("AccelByteUserProfileModels"), Object(UserProfile), 1, [](const FAccelByteModelsUserProfileInfo& Result) { return !Result.UserId.IsEmpty(); });
+	BenchmarkDecode<FUserData>(Report, TEXT("AccelByteUserModels"), Object(UserData), 1, [](const FUserData& Result) { return Result.Roles.Num() == 1; });
+	BenchmarkDecodePages<TArray<FPlatformLink>>(Report, TEXT("AccelByteUserModels"), [](int32 Count) { return Array(PlatformLink, Count); }, &GetArrayCount<FPlatformLink>);
+	BenchmarkDecode<FOauth2Token>(Report, TEXT("AccelByteOauth2Models"), Object(Token), 1, [](const FOauth2Token& Result) { return Result.Permissions.Num() == 5; });
+	// Lobby messages reach the converter as JSON too, once LobbyMessageToJson has rewritten them
+	BenchmarkDecodePages<FAccelByteModelsGetOnlineUsersResponse>(Report, TEXT("AccelByteLobbyModels"), &FriendsPresence, [](const FAccelByteModelsGetOnlineUsersResponse& Result) { return Result.friendsId.Num(); });
+	BenchmarkDecodePages<FAccelByteModelsLoadFriendListResponse>(Report, TEXT("AccelByteLobbyModels"), &FriendList, [](const FAccelByteModelsLoadFriendListResponse& Result) { return Result.friendsId.Num(); });
+
+	check(!Report.Write().IsEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(JsonModelBenchmarkEncode, "AccelByte.Benchmarks.JsonModels.Encode", AutomationFlagMaskBenchmark);
+bool JsonModelBenchmarkEncode::RunTest(const FString& Parameters)
+{
+	using namespace JsonBenchmarkCorpus;
+
+	FBenchmarkReport Report(TEXT("JsonModelsEncode"));
+
+	BenchmarkEncode<FAccelByteModelsOrderCreate>(Report, TEXT("AccelByteOrderModels"), OrderCreate);
+	BenchmarkEncode<FAccelByteModelsGameProfileRequest>(Report, TEXT("AccelByteGameProfileModels"), GameProfileRequest);
+	BenchmarkEncode<FAccelByteModelsUserProfileUpdateRequest>(Report, TEXT("AccelByteUserProfileModels"), UserProfileUpdate);
+	BenchmarkEncode<FRegisterRequest>(Report, TEXT("AccelByteUserModels"), Register);
+
+	check(!Report.Write().IsEmpty());
+
+	return true;
+}
@@ -0,0 +1,1427 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "LocalBackend.h"
+#include "Base64.h"
+#include "JsonObjectConverter.h"
+#include "Misc/SecureHash.h"
+#include "Core/AccelByteEndpoints.h"
+
+using namespace AccelByte;
+
+namespace
+{
+	template <typename T>
+	FString ToJson(const T& Value)
+	{
+		FString Json;
+		FJsonObjectConverter::UStructToJsonObjectString(Value, Json);
+
+		return Json;
+	}
+
+	template <typename T>
+	FString ToJsonArray(const TArray<T>& Values)
+	{
+		FString Json = TEXT("[");
+
+		for (int32 i = 0; i < Values.Num(); i++)
+		{
+			if (i > 0)
+			{
+				Json.AppendChar(TEXT(','));
+			}
+
+			Json.Append(ToJson(Values[i]));
+		}
+
+		Json.AppendChar(TEXT(']'));
+
+		return Json;
+	}
+
+	/** False with a 400 response when the body is not the expected JSON. */
+	template <typename T>
+	bool FromJson(const FLocalHttpRequest& Request, FLocalHttpResponse& Response, T& OutValue)
+	{
+		if (FJsonObjectConverter::JsonObjectStringToUStruct(Request.GetBodyAsString(), &OutValue, 0, 0))
+		{
+			return true;
+		}
+
+		Response.SetError(400, 20002, TEXT("Malformed request body"));
+
+		return false;
+	}
+
+	/** Page of Values as selected by the page and size query parameters. */
+	template <typename T>
+	TArray<T> GetPage(const FLocalHttpRequest& Request, const TArray<T>& Values)
+	{
+		int32 Page = FCString::Atoi(*Request.GetQuery(TEXT("page")));
+		FString SizeParameter = Request.GetQuery(TEXT("size"));
+		int32 Size = SizeParameter.IsEmpty() ? 20 : FMath::Max(1, FCString::Atoi(*SizeParameter));
+		TArray<T> Result;
+
+		for (int32 i = Page * Size; i < Values.Num() && i < (Page + 1) * Size; i++)
+		{
+			Result.Add(Values[i]);
+		}
+
+		return Result;
+	}
+
+	FString GetNow()
+	{
+		return FDateTime::UtcNow().ToIso8601();
+	}
+
+	const TCHAR* GetServicePrefix(EHttpService Service)
+	{
+		switch (Service)
+		{
+		case EHttpService::Iam:
+			return TEXT("/iam");
+		case EHttpService::Platform:
+			return TEXT("/platform");
+		case EHttpService::Basic:
+			return TEXT("/basic");
+		case EHttpService::CloudStorage:
+			return TEXT("/binary-store");
+		default:
+			return TEXT("/soc-profile");
+		}
+	}
+
+	/** Admin calls of DeleteUserById in the test utilities, the SDK has no endpoint for them. */
+	const FHttpEndpoint GetJusticeUser{ TEXT("GET"), EHttpService::Iam, TEXT("/namespaces/{namespace}/users/{userId}/platforms/justice/{publisherNamespace}"), EHttpAuthorization::Client };
+	const FHttpEndpoint DeleteUser{ TEXT("DELETE"), EHttpService::Iam, TEXT("/namespaces/{publisherNamespace}/users/{userId}"), EHttpAuthorization::Client };
+
+	/** Active item of the seeded catalog, priced in the seeded currency. */
+	FAccelByteModelsItemInfo MakeItem(const FLocalBackend::FConfig& Config, int32 Index, const FString& CategoryPath, const FString& ItemType, int32 Price)
+	{
+		FAccelByteModelsItemInfoRegionData RegionData;
+		RegionData.Price = Price;
+		RegionData.DiscountedPrice = Price;
+		RegionData.CurrencyCode = Config.CurrencyCode;
+		RegionData.CurrencyType = TEXT("VIRTUAL");
+		RegionData.CurrencyNamespace = Config.Namespace;
+
+		FAccelByteModelsItemInfo Item;
+		Item.ItemId = FString::Printf(TEXT("item-%d"), Index);
+		Item.Sku = Item.ItemId;
+		Item.Name = FString::Printf(TEXT("Item %d"), Index);
+		Item.Title = Item.Name;
+		Item.Namespace = Config.Namespace;
+		Item.CategoryPath = CategoryPath;
+		Item.EntitlementType = TEXT("DURABLE");
+		Item.Status = TEXT("ACTIVE");
+		Item.ItemType = ItemType;
+		Item.Region = TEXT("US");
+		Item.Language = TEXT("en");
+		Item.MaxCount = -1;
+		Item.MaxCountPerUser = -1;
+		Item.RegionData.Add(RegionData);
+
+		return Item;
+	}
+
+	struct FFormPart
+	{
+		FString Name;
+		FString FileName;
+		FString ContentType;
+		TArray<uint8> Data;
+	};
+
+	/** Parts of a multipart/form-data body, in the layout the CloudStorage API writes. */
+	TArray<FFormPart> ParseMultipart(const FLocalHttpRequest& Request)
+	{
+		TArray<FFormPart> Parts;
+		FString Boundary;
+
+		if (!Request.GetHeader(TEXT("Content-Type")).Split(TEXT("boundary="), nullptr, &Boundary))
+		{
+			return Parts;
+		}
+
+		FTCHARToUTF8 Delimiter(*(TEXT("--") + Boundary));
+		const uint8* Body = Request.Body.GetData();
+		int32 Size = Request.Body.Num();
+		TArray<int32> Starts;
+
+		for (int32 i = 0; i + Delimiter.Length() <= Size; i++)
+		{
+			if (FMemory::Memcmp(Body + i, Delimiter.Get(), Delimiter.Length()) == 0)
+			{
+				Starts.Add(i);
+				i += Delimiter.Length() - 1;
+			}
+		}
+
+		for (int32 i = 0; i + 1 < Starts.Num(); i++)
+		{
+			// Each part is CRLF, headers, blank line, content and the CRLF before the next delimiter
+			int32 Begin = Starts[i] + Delimiter.Length() + 2;
+			int32 End = Starts[i + 1] - 2;
+			int32 HeaderEnd = INDEX_NONE;
+
+			for (int32 j = Begin; j + 4 <= End; j++)
+			{
+				if (FMemory::Memcmp(Body + j, "\r\n\r\n", 4) == 0)
+				{
+					HeaderEnd = j;
+					break;
+				}
+			}
+
+			if (HeaderEnd == INDEX_NONE)
+			{
+				continue;
+			}
+
+			FUTF8ToTCHAR HeaderConverter(reinterpret_cast<const ANSICHAR*>(Body + Begin), HeaderEnd - Begin);
+			FString Headers(HeaderConverter.Length(), HeaderConverter.Get());
+			FFormPart Part;
+			Headers.Split(TEXT("name=\""), nullptr, &Part.Name);
+			Part.Name.Split(TEXT("\""), &Part.Name, nullptr);
+
+			if (Headers.Split(TEXT("filename=\""), nullptr, &Part.FileName))
+			{
+				Part.FileName.Split(TEXT("\""), &Part.FileName, nullptr);
+			}
+
+			if (Headers.Split(TEXT("Content-Type:"), nullptr, &Part.ContentType))
+			{
+				Part.ContentType.Split(TEXT("\r\n"), &Part.ContentType, nullptr);
+				Part.ContentType.TrimStartAndEndInline();
+			}
+
+			Part.Data.Append(Body + HeaderEnd + 4, FMath::Max(0, End - HeaderEnd - 4));
+			Parts.Add(MoveTemp(Part));
+		}
+
+		return Parts;
+	}
+}
+
+FLocalBackend::FLocalBackend(const FConfig& InConfig)
+	: Config(InConfig)
+	, LastId(0)
+	, LostAnswers(InConfig.LostAnswers)
+{
+	Server.SetConfig(Config.Server);
+
+	FAccelByteModelsFullCategoryInfo Root;
+	Root.Namespace = Config.Namespace;
+	Root.CategoryPath = TEXT("/game");
+	Root.DisplayName = TEXT("Game");
+	Root.Root = true;
+	AddCategory(Root);
+
+	FAccelByteModelsFullCategoryInfo Child = Root;
+	Child.ParentCategoryPath = Root.CategoryPath;
+	Child.CategoryPath = TEXT("/game/items");
+	Child.DisplayName = TEXT("Items");
+	Child.Root = false;
+	AddCategory(Child);
+
+	FAccelByteModelsFullCategoryInfo GrandChild = Child;
+	GrandChild.ParentCategoryPath = Child.CategoryPath;
+	GrandChild.CategoryPath = TEXT("/game/items/bundles");
+	GrandChild.DisplayName = TEXT("Bundles");
+	AddCategory(GrandChild);
+
+	for (int32 i = 0; i < 2; i++)
+	{
+		AddItem(MakeItem(Config, i + 1, Child.CategoryPath, TEXT("INGAMEITEM"), 10 * (i + 1)));
+	}
+
+	// What the Ecommerce integration tests look for when run against this backend
+	AddItem(MakeItem(Config, 3, Root.CategoryPath, TEXT("INGAMEITEM"), 2));
+	FAccelByteModelsItemInfo Coins = MakeItem(Config, 4, Child.CategoryPath, TEXT("COINS"), 0);
+	Coins.EntitlementType = TEXT("CONSUMABLE");
+	AddItem(Coins);
+
+	RouteIam();
+	RouteBasic();
+	RoutePlatform();
+	RouteCloudStorage();
+	RouteGameProfile();
+}
+
+FLocalBackend::~FLocalBackend()
+{
+	// The server thread must be gone before the state its handlers use
+	Shutdown();
+}
+
+bool FLocalBackend::Start(int32 Port)
+{
+	return Server.Start(Port);
+}
+
+void FLocalBackend::Shutdown()
+{
+	Server.Shutdown();
+}
+
+void FLocalBackend::ApplyTo(Settings& Target) const
+{
+	FString Url = Server.GetUrl();
+	Target.ClientId = Config.ClientId;
+	Target.ClientSecret = Config.ClientSecret;
+	Target.Namespace = Config.Namespace;
+	Target.PublisherNamespace = Config.PublisherNamespace;
+	Target.BaseUrl = Url;
+	Target.IamServerUrl = Url + GetServicePrefix(EHttpService::Iam);
+	Target.PlatformServerUrl = Url + GetServicePrefix(EHttpService::Platform);
+	Target.BasicServerUrl = Url + GetServicePrefix(EHttpService::Basic);
+	Target.CloudStorageServerUrl = Url + GetServicePrefix(EHttpService::CloudStorage);
+	Target.GameProfileServerUrl = Url + GetServicePrefix(EHttpService::GameProfile);
+	// Writes are applied once per Idempotency-Key (see Route)
+	Target.bRetryKeyedWrites = true;
+}
+
+void FLocalBackend::AddCategory(const FAccelByteModelsFullCategoryInfo& Category)
+{
+	Categories.Add(Category);
+}
+
+void FLocalBackend::AddItem(const FAccelByteModelsItemInfo& Item)
+{
+	Items.Add(Item);
+}
+
+FLocalHttpServer& FLocalBackend::GetServer()
+{
+	return Server;
+}
+
+FString FLocalBackend::FindUserId(const FString& AccessToken) const
+{
+	const FToken* Token = AccessTokens.Find(AccessToken);
+
+	return Token != nullptr && Token->ExpiresAt >= FPlatformTime::Seconds() ? Token->UserId : FString();
+}
+
+void FLocalBackend::Route(const FHttpEndpoint& Endpoint, const FHandler& Handler, bool bIsCacheable)
+{
+	EHttpAuthorization Authorization = Endpoint.Authorization;
+	FString Path = Endpoint.Path;
+
+	Server.Route(Endpoint.Verb, FString(GetServicePrefix(Endpoint.Service)) + Endpoint.Path, [this, Authorization, Path, Handler, bIsCacheable](const FLocalHttpRequest& Request, FLocalHttpResponse& Response)
+	{
+		FString Header = Request.GetHeader(TEXT("Authorization"));
+		FString UserId;
+
+		if (Authorization == EHttpAuthorization::Basic)
+		{
+			if (!AuthorizeClient(Request, Response))
+			{
+				return;
+			}
+		}
+		else if (Authorization != EHttpAuthorization::None)
+		{
+			const FToken* Token = Header.StartsWith(TEXT("Bearer ")) ? AccessTokens.Find(Header.Mid(7)) : nullptr;
+
+			if (Token == nullptr || Token->ExpiresAt < FPlatformTime::Seconds())
+			{
+				Response.SetError(401, 20001, TEXT("Unauthorized access"));
+
+				return;
+			}
+
+			if (Authorization == EHttpAuthorization::User && Token->UserId.IsEmpty())
+			{
+				Response.SetError(403, 20013, TEXT("Insufficient permissions"));
+
+				return;
+			}
+
+			UserId = Token->UserId;
+		}
+
+		FString Key = Request.GetHeader(TEXT("Idempotency-Key"));
+
+		if (Key.IsEmpty())
+		{
+			Handler(Request, Response, UserId);
+		}
+		else
+		{
+			FString Scope = FString::Printf(TEXT("%s %s %s %s"), *UserId, *Request.Verb, *Request.Path, *Key);
+
+			if (const FLocalHttpResponse* Answer = KeyedAnswers.Find(Scope))
+			{
+				Response = *Answer;
+			}
+			else
+			{
+				Handler(Request, Response, UserId);
+				KeyedAnswers.Add(Scope, Response);
+			}
+		}
+
+		int32* Lost = LostAnswers.Find(Path);
+
+		if (Lost != nullptr && *Lost > 0)
+		{
+			(*Lost)--;
+			Response.SetError(502, 502, TEXT("Answer lost by the gateway"));
+		}
+
+		if (bIsCacheable && !Config.CacheControl.IsEmpty() && Response.Code == 200)
+		{
+			FString ETag = FString::Printf(TEXT("\"%08x\""), FCrc::MemCrc32(Response.Body.GetData(), Response.Body.Num()));
+			Response.Headers.Add(TEXT("Cache-Control"), Config.CacheControl);
+			Response.Headers.Add(TEXT("ETag"), ETag);
+
+			if (Request.GetHeader(TEXT("If-None-Match")) == ETag)
+			{
+				Response.Code = 304;
+				Response.Body.Reset();
+			}
+		}
+	});
+}
+
+void FLocalBackend::RouteIam()
+{
+	Route(Endpoints::Oauth2::Token, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		if (!AuthorizeClient(Request, Response))
+		{
+			return;
+		}
+
+		TMap<FString, FString> Form = Request.GetForm();
+		FString GrantType = Form.FindRef(TEXT("grant_type"));
+
+		if (GrantType == TEXT("client_credentials"))
+		{
+			IssueToken(FString(), Response);
+		}
+		else if (GrantType == TEXT("password"))
+		{
+			FUser* Found = FindUserByLoginId(Form.FindRef(TEXT("username")));
+
+			if (Found == nullptr || Found->Password != Form.FindRef(TEXT("password")))
+			{
+				Response.SetError(401, 10020, TEXT("Invalid username or password"));
+
+				return;
+			}
+
+			IssueToken(Found->Data.UserId, Response);
+		}
+		else if (GrantType == TEXT("refresh_token"))
+		{
+			FString UserId;
+
+			if (!RefreshTokens.RemoveAndCopyValue(Form.FindRef(TEXT("refresh_token")), UserId))
+			{
+				Response.SetError(401, 10021, TEXT("Invalid refresh token"));
+
+				return;
+			}
+
+			IssueToken(UserId, Response);
+		}
+		else if (GrantType == TEXT("authorization_code"))
+		{
+			// As if the launcher had logged the user in, the code is the id of the user
+			FString UserId = Form.FindRef(TEXT("code"));
+
+			if (!Users.Contains(UserId))
+			{
+				Response.SetError(401, 10022, TEXT("Invalid authorization code"));
+
+				return;
+			}
+
+			IssueToken(UserId, Response);
+		}
+		else
+		{
+			Response.SetError(400, 10023, TEXT("Unsupported grant type"));
+		}
+	});
+
+	Route(Endpoints::Oauth2::PlatformToken, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		if (!AuthorizeClient(Request, Response))
+		{
+			return;
+		}
+
+		TMap<FString, FString> Form = Request.GetForm();
+		FString PlatformUserId = Form.Contains(TEXT("device_id")) ? Form.FindRef(TEXT("device_id")) : Form.FindRef(TEXT("platform_token"));
+
+		if (PlatformUserId.IsEmpty())
+		{
+			Response.SetError(400, 10024, TEXT("Missing platform token"));
+
+			return;
+		}
+
+		// Platform accounts are headless until upgraded
+		FString LoginId = Request.Params[0] + TEXT(":") + PlatformUserId;
+		FUser* Found = FindUserByLoginId(LoginId);
+
+		if (Found == nullptr)
+		{
+			Found = &AddUser(LoginId, FString(), LoginId, TEXT("EMAILPASSWD"));
+			Found->Data.PlatformId = Request.Params[0];
+			Found->Data.PlatformUserId = PlatformUserId;
+		}
+
+		IssueToken(Found->Data.UserId, Response);
+	});
+
+	Route(Endpoints::User::Register, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		FRegisterRequest Register;
+
+		if (!FromJson(Request, Response, Register))
+		{
+			return;
+		}
+
+		if (FindUserByLoginId(Register.LoginId) != nullptr)
+		{
+			Response.SetError(409, 10133, TEXT("User already exists"));
+
+			return;
+		}
+
+		Response.SetContent(201, ToJson(AddUser(Register.LoginId, Register.Password, Register.DisplayName, Register.AuthType).Data));
+	});
+
+
+	Route(Endpoints::User::Update, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FUserUpdateRequest Update;
+
+		if (!FromJson(Request, Response, Update))
+		{
+			return;
+		}
+
+		FUserData& Data = Users[UserId].Data;
+		Data.Country = Update.Country.IsEmpty() ? Data.Country : Update.Country;
+		Data.DisplayName = Update.DisplayName.IsEmpty() ? Data.DisplayName : Update.DisplayName;
+
+		if (!Update.EmailAddress.IsEmpty() && Update.EmailAddress != Data.EmailAddress)
+		{
+			Data.OldEmailAddress = Data.EmailAddress;
+			Data.NewEmailAddress = Update.EmailAddress;
+			Data.EmailAddress = Update.EmailAddress;
+			Data.EmailVerified = false;
+		}
+
+		Response.SetContent(200, ToJson(Data));
+	});
+
+	// Verification codes are not checked, every code is the one that was sent
+	FHandler UpgradeHeadless = [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		FUpgradeAndVerifyRequest Upgrade;
+
+		if (!FromJson(Request, Response, Upgrade))
+		{
+			return;
+		}
+
+		FUser* Found = Users.Find(Request.Params[1]);
+
+		if (Found == nullptr)
+		{
+			Response.SetError(404, 10139, TEXT("User not found"));
+
+			return;
+		}
+
+		if (FindUserByLoginId(Upgrade.LoginId) != nullptr)
+		{
+			Response.SetError(409, 10133, TEXT("User already exists"));
+
+			return;
+		}
+
+		Found->Data.LoginId = Upgrade.LoginId;
+		Found->Data.EmailAddress = Upgrade.LoginId;
+		Found->Data.EmailVerified = !Upgrade.Code.IsEmpty();
+		Found->Password = Upgrade.Password;
+		Response.SetContent(200, ToJson(Found->Data));
+	};
+
+	Route(Endpoints::User::Upgrade, UpgradeHeadless);
+	Route(Endpoints::User::UpgradeAndVerify, UpgradeHeadless);
+
+	Route(Endpoints::User::Verify, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		FUser* Found = Users.Find(Request.Params[1]);
+
+		if (Found == nullptr)
+		{
+			Response.SetError(404, 10139, TEXT("User not found"));
+
+			return;
+		}
+
+		Found->Data.EmailVerified = true;
+		Response.Code = 204;
+	});
+
+	FHandler AcceptRequest = [](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		Response.Code = 204;
+	};
+
+	Route(Endpoints::User::SendVerificationCode, AcceptRequest);
+	Route(Endpoints::User::SendResetPasswordCode, AcceptRequest);
+
+	Route(Endpoints::User::ResetPassword, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		FResetPasswordRequest Reset;
+
+		if (!FromJson(Request, Response, Reset))
+		{
+			return;
+		}
+
+		FUser* Found = FindUserByLoginId(Reset.LoginId);
+
+		if (Found == nullptr)
+		{
+			Response.SetError(404, 10139, TEXT("User not found"));
+
+			return;
+		}
+
+		Found->Password = Reset.NewPassword;
+		Response.Code = 204;
+	});
+
+	Route(Endpoints::User::GetPlatformLinks, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		const FUser* Found = Users.Find(Request.Params[1]);
+		Response.SetContent(200, ToJsonArray(Found != nullptr ? Found->Links : TArray<FPlatformLink>()));
+	});
+
+	Route(Endpoints::User::LinkOtherPlatform, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		FUser* Found = Users.Find(Request.Params[1]);
+
+		if (Found == nullptr)
+		{
+			Response.SetError(404, 10139, TEXT("User not found"));
+
+			return;
+		}
+
+		FPlatformLink Link;
+		Link.Namespace = Config.Namespace;
+		Link.OriginNamespace = Config.Namespace;
+		Link.UserId = Found->Data.UserId;
+		Link.DisplayName = Found->Data.DisplayName;
+		Link.PlatformId = Request.Params[2];
+		Link.PlatformUserId = Request.GetForm().FindRef(TEXT("ticket"));
+		Link.LinkedAt = GetNow();
+		Found->Links.Add(Link);
+		Response.Code = 204;
+	});
+
+	Route(Endpoints::User::UnlinkOtherPlatform, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		if (FUser* Found = Users.Find(Request.Params[1]))
+		{
+			const FString& PlatformId = Request.Params[2];
+			Found->Links.RemoveAll([&PlatformId](const FPlatformLink& Link) { return Link.PlatformId == PlatformId; });
+		}
+
+		Response.Code = 204;
+	});
+
+	Route(Endpoints::User::GetUserByLoginId, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		const FUser* Found = FindUserByLoginId(Request.GetQuery(TEXT("loginId")));
+
+		if (Found == nullptr)
+		{
+			Response.SetError(404, 10139, TEXT("User not found"));
+
+			return;
+		}
+
+		Response.SetContent(200, ToJson(Found->Data));
+	});
+
+	// GetData and GetPublicUserInfo share their path, the caller's own id gets the full data
+	Route(Endpoints::User::GetData, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		const FUser* Found = Users.Find(Request.Params[1]);
+
+		if (Found == nullptr)
+		{
+			Response.SetError(404, 10139, TEXT("User not found"));
+
+			return;
+		}
+
+		if (Found->Data.UserId == UserId)
+		{
+			Response.SetContent(200, ToJson(Found->Data));
+
+			return;
+		}
+
+		FPublicUserInfo Info;
+		Info.Namespace = Found->Data.Namespace;
+		Info.UserId = Found->Data.UserId;
+		Info.DisplayName = Found->Data.DisplayName;
+		Info.AuthType = Found->Data.AuthType;
+		Info.LoginId = Found->Data.LoginId;
+		Info.EmailAddress = Found->Data.EmailAddress;
+		Response.SetContent(200, ToJson(Info));
+	});
+
+	// The publisher account of a game user is the user itself here
+	Route(GetJusticeUser, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		if (!Users.Contains(Request.Params[1]))
+		{
+			Response.SetError(404, 10139, TEXT("User not found"));
+
+			return;
+		}
+
+		Response.SetContent(200, FString::Printf(TEXT("{\"Namespace\":\"%s\",\"UserId\":\"%s\"}"), *Config.PublisherNamespace, *Request.Params[1]));
+	});
+
+	Route(DeleteUser, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		const FString& UserId = Request.Params[1];
+
+		if (Users.Remove(UserId) == 0)
+		{
+			Response.SetError(404, 10139, TEXT("User not found"));
+
+			return;
+		}
+
+		for (auto It = AccessTokens.CreateIterator(); It; ++It)
+		{
+			if (It.Value().UserId == UserId)
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		Profiles.Remove(UserId);
+		Wallets.Remove(UserId);
+		Response.Code = 204;
+	});
+}
+
+void FLocalBackend::RouteBasic()
+{
+	Route(Endpoints::UserProfile::GetUserProfile, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		const FAccelByteModelsUserProfileInfo* Profile = Profiles.Find(UserId);
+
+		if (Profile == nullptr)
+		{
+			Response.SetError(404, 11440, TEXT("User profile not found"));
+
+			return;
+		}
+
+		Response.SetContent(200, ToJson(*Profile));
+	}, true);
+
+	Route(Endpoints::UserProfile::GetPublicUserProfileInfo, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		const FAccelByteModelsUserProfileInfo* Profile = Profiles.Find(Request.Params[1]);
+
+		if (Profile == nullptr)
+		{
+			Response.SetError(404, 11440, TEXT("User profile not found"));
+
+			return;
+		}
+
+		FAccelByteModelsPublicUserProfileInfo Info;
+		Info.UserId = Profile->UserId;
+		Info.Namespace = Profile->Namespace;
+		Info.AvatarSmallUrl = Profile->AvatarSmallUrl;
+		Info.AvatarUrl = Profile->AvatarUrl;
+		Info.AvatarLargeUrl = Profile->AvatarLargeUrl;
+		Info.Timezone = Profile->Timezone;
+		Response.SetContent(200, ToJson(Info));
+	}, true);
+
+	Route(Endpoints::UserProfile::CreateUserProfile, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FAccelByteModelsUserProfileCreateRequest Create;
+
+		if (!FromJson(Request, Response, Create))
+		{
+			return;
+		}
+
+		if (Profiles.Contains(UserId))
+		{
+			Response.SetError(409, 11441, TEXT("User profile already exists"));
+
+			return;
+		}
+
+		FAccelByteModelsUserProfileInfo& Profile = Profiles.Add(UserId);
+		Profile.UserId = UserId;
+		Profile.Namespace = Config.Namespace;
+		Profile.FirstName = Create.FirstName;
+		Profile.LastName = Create.LastName;
+		Profile.AvatarSmallUrl = Create.AvatarSmallUrl;
+		Profile.AvatarUrl = Create.AvatarUrl;
+		Profile.AvatarLargeUrl = Create.AvatarLargeUrl;
+		Profile.Status = TEXT("ACTIVE");
+		Profile.Language = Create.Language;
+		Profile.Timezone = Create.Timezone;
+		Profile.DateOfBirth = Create.DateOfBirth;
+		Response.SetContent(201, ToJson(Profile));
+	});
+
+	Route(Endpoints::UserProfile::UpdateUserProfile, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FAccelByteModelsUserProfileUpdateRequest Update;
+
+		if (!FromJson(Request, Response, Update))
+		{
+			return;
+		}
+
+		FAccelByteModelsUserProfileInfo* Profile = Profiles.Find(UserId);
+
+		if (Profile == nullptr)
+		{
+			Response.SetError(404, 11440, TEXT("User profile not found"));
+
+			return;
+		}
+
+		// Fields left empty keep their value
+		auto Merge = [](FString& Field, const FString& Value)
+		{
+			Field = Value.IsEmpty() ? Field : Value;
+		};
+		Merge(Profile->FirstName, Update.FirstName);
+		Merge(Profile->LastName, Update.LastName);
+		Merge(Profile->AvatarSmallUrl, Update.AvatarSmallUrl);
+		Merge(Profile->AvatarUrl, Update.AvatarUrl);
+		Merge(Profile->AvatarLargeUrl, Update.AvatarLargeUrl);
+		Merge(Profile->Language, Update.Language);
+		Merge(Profile->Timezone, Update.Timezone);
+		Merge(Profile->DateOfBirth, Update.DateOfBirth);
+		Response.SetContent(200, ToJson(*Profile));
+	});
+}
+
+void FLocalBackend::RoutePlatform()
+{
+	Route(Endpoints::Category::GetRootCategories, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		Response.SetContent(200, ToJsonArray(Categories.FilterByPredicate([](const FAccelByteModelsFullCategoryInfo& Category) { return Category.Root; })));
+	}, true);
+
+	Route(Endpoints::Category::GetCategory, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		const FString& Path = Request.Params[1];
+		const FAccelByteModelsFullCategoryInfo* Category = Categories.FindByPredicate([&Path](const FAccelByteModelsFullCategoryInfo& Candidate) { return Candidate.CategoryPath == Path; });
+
+		if (Category == nullptr)
+		{
+			Response.SetError(404, 30241, TEXT("Category not found"));
+
+			return;
+		}
+
+		Response.SetContent(200, ToJson(*Category));
+	}, true);
+
+	Route(Endpoints::Category::GetChildCategories, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		const FString& Path = Request.Params[1];
+		Response.SetContent(200, ToJsonArray(Categories.FilterByPredicate([&Path](const FAccelByteModelsFullCategoryInfo& Category) { return Category.ParentCategoryPath == Path; })));
+	}, true);
+
+	Route(Endpoints::Category::GetDescendantCategories, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		FString Prefix = Request.Params[1] + TEXT("/");
+		Response.SetContent(200, ToJsonArray(Categories.FilterByPredicate([&Prefix](const FAccelByteModelsFullCategoryInfo& Category) { return Category.CategoryPath.StartsWith(Prefix); })));
+	}, true);
+
+	Route(Endpoints::Item::GetItemById, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		const FString& ItemId = Request.Params[1];
+		const FAccelByteModelsItemInfo* Item = Items.FindByPredicate([&ItemId](const FAccelByteModelsItemInfo& Candidate) { return Candidate.ItemId == ItemId; });
+
+		if (Item == nullptr)
+		{
+			Response.SetError(404, 30341, TEXT("Item not found"));
+
+			return;
+		}
+
+		Response.SetContent(200, ToJson(*Item));
+	}, true);
+
+	Route(Endpoints::Item::GetItemsByCriteria, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		FString CategoryPath = Request.GetQuery(TEXT("categoryPath"));
+		FString ItemType = Request.GetQuery(TEXT("itemType"));
+		FAccelByteModelsItemPagingSlicedResult Result;
+		Result.Data = GetPage(Request, Items.FilterByPredicate([&](const FAccelByteModelsItemInfo& Item)
+		{
+			return (CategoryPath.IsEmpty() || Item.CategoryPath == CategoryPath) && (ItemType.IsEmpty() || Item.ItemType == ItemType);
+		}));
+		Response.SetContent(200, ToJson(Result));
+	}, true);
+
+	Route(Endpoints::Order::CreateNewOrder, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FAccelByteModelsOrderCreate Create;
+
+		if (!FromJson(Request, Response, Create))
+		{
+			return;
+		}
+
+		const FAccelByteModelsItemInfo* Item = Items.FindByPredicate([&Create](const FAccelByteModelsItemInfo& Candidate) { return Candidate.ItemId == Create.ItemId; });
+
+		if (Item == nullptr)
+		{
+			Response.SetError(404, 30341, TEXT("Item not found"));
+
+			return;
+		}
+
+		int32 Quantity = FMath::Max(1, Create.Quantity);
+		FAccelByteModelsOrderInfo Order;
+		Order.OrderNo = NewId();
+		Order.UserId = UserId;
+		Order.ItemId = Item->ItemId;
+		Order.Namespace = Config.Namespace;
+		Order.Quantity = Quantity;
+		Order.Price = Create.Price;
+		Order.DiscountedPrice = Create.DiscountedPrice;
+		Order.Currency.CurrencyCode = Create.CurrencyCode;
+		Order.Currency.Namespace = Config.Namespace;
+		Order.Status = TEXT("INIT");
+		Order.CreatedTime = GetNow();
+		Order.CreatedAt = Order.CreatedTime;
+		Order.UpdatedAt = Order.CreatedTime;
+
+		TArray<FAccelByteModelsOrderHistoryInfo> History;
+		History.Add(FAccelByteModelsOrderHistoryInfo{ Order.OrderNo, TEXT("USER"), TEXT("INIT"), FString(), UserId, Order.CreatedAt, Order.CreatedAt });
+
+		// Virtual currency is paid from the wallet at once, other currencies wait for FulfillOrder as if paid elsewhere
+		if (FAccelByteModelsWalletInfo* Wallet = Wallets.FindOrAdd(UserId).Find(Create.CurrencyCode))
+		{
+			if (Wallet->Balance < Create.DiscountedPrice)
+			{
+				Response.SetError(400, 35123, TEXT("Insufficient balance"));
+
+				return;
+			}
+
+			Wallet->Balance -= Create.DiscountedPrice;
+			Wallet->UpdatedAt = GetNow();
+			Order.Currency.CurrencyType = TEXT("VIRTUAL");
+			Order.EntitlementIds.Add(Grant(UserId, *Item, Quantity).Id);
+			Order.Status = TEXT("FULFILLED");
+			Order.ChargedTime = GetNow();
+			Order.FulfilledTime = Order.ChargedTime;
+			History.Add(FAccelByteModelsOrderHistoryInfo{ Order.OrderNo, TEXT("SYSTEM"), TEXT("CHARGED"), FString(), UserId, Order.ChargedTime, Order.ChargedTime });
+			History.Add(FAccelByteModelsOrderHistoryInfo{ Order.OrderNo, TEXT("SYSTEM"), TEXT("FULFILLED"), FString(), UserId, Order.FulfilledTime, Order.FulfilledTime });
+		}
+		else
+		{
+			Order.Currency.CurrencyType = TEXT("REAL");
+			Order.PaymentStationUrl = Server.GetUrl() + TEXT("/payment/") + Order.OrderNo;
+		}
+
+		Orders.Add(Order.OrderNo, Order);
+		OrderHistories.Add(Order.OrderNo, History);
+		Response.SetContent(201, ToJson(Order));
+	});
+
+	Route(Endpoints::Order::GetUserOrder, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		const FAccelByteModelsOrderInfo* Order = Orders.Find(Request.Params[2]);
+
+		if (Order == nullptr || Order->UserId != UserId)
+		{
+			Response.SetError(404, 32141, TEXT("Order not found"));
+
+			return;
+		}
+
+		Response.SetContent(200, ToJson(*Order));
+	});
+
+	Route(Endpoints::Order::GetUserOrders, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		TArray<FAccelByteModelsOrderInfo> Owned;
+
+		for (const TPair<FString, FAccelByteModelsOrderInfo>& Order : Orders)
+		{
+			if (Order.Value.UserId == UserId)
+			{
+				Owned.Add(Order.Value);
+			}
+		}
+
+		Response.SetContent(200, FString::Printf(TEXT("{\"data\":%s,\"paging\":{}}"), *ToJsonArray(GetPage(Request, Owned))));
+	});
+
+	Route(Endpoints::Order::FulfillOrder, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FAccelByteModelsOrderInfo* Order = Orders.Find(Request.Params[2]);
+
+		if (Order == nullptr || Order->UserId != UserId)
+		{
+			Response.SetError(404, 32141, TEXT("Order not found"));
+
+			return;
+		}
+
+		if (Order->Status != TEXT("FULFILLED"))
+		{
+			const FString& ItemId = Order->ItemId;
+			const FAccelByteModelsItemInfo* Item = Items.FindByPredicate([&ItemId](const FAccelByteModelsItemInfo& Candidate) { return Candidate.ItemId == ItemId; });
+
+			if (Item != nullptr)
+			{
+				Order->EntitlementIds.Add(Grant(UserId, *Item, Order->Quantity).Id);
+			}
+
+			Order->Status = TEXT("FULFILLED");
+			Order->FulfilledTime = GetNow();
+			Order->UpdatedAt = Order->FulfilledTime;
+			OrderHistories.FindOrAdd(Order->OrderNo).Add(FAccelByteModelsOrderHistoryInfo{ Order->OrderNo, TEXT("USER"), TEXT("FULFILLED"), FString(), UserId, Order->FulfilledTime, Order->FulfilledTime });
+		}
+
+		Response.SetContent(200, ToJson(*Order));
+	});
+
+	Route(Endpoints::Order::GetUserOrderHistory, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		const FAccelByteModelsOrderInfo* Order = Orders.Find(Request.Params[2]);
+
+		if (Order == nullptr || Order->UserId != UserId)
+		{
+			Response.SetError(404, 32141, TEXT("Order not found"));
+
+			return;
+		}
+
+		Response.SetContent(200, ToJsonArray(OrderHistories.FindRef(Order->OrderNo)));
+	});
+
+	Route(Endpoints::Entitlement::QueryUserEntitlement, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FString Name = Request.GetQuery(TEXT("entitlementName"));
+		FString ItemId = Request.GetQuery(TEXT("itemId"));
+		FAccelByteModelsEntitlementPagingSlicedResult Result;
+		Result.Data = GetPage(Request, Entitlements.FilterByPredicate([&](const FAccelByteModelsEntitlementInfo& Entitlement)
+		{
+			return Entitlement.UserId == UserId && (Name.IsEmpty() || Entitlement.Name == Name) && (ItemId.IsEmpty() || Entitlement.ItemId == ItemId);
+		}));
+		Response.SetContent(200, ToJson(Result));
+	});
+
+	Route(Endpoints::Wallet::GetWalletInfoByCurrencyCode, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		const FAccelByteModelsWalletInfo* Wallet = Wallets.FindOrAdd(UserId).Find(Request.Params[2]);
+
+		if (Wallet == nullptr)
+		{
+			Response.SetError(404, 35141, TEXT("Wallet not found"));
+
+			return;
+		}
+
+		Response.SetContent(200, ToJson(*Wallet));
+	});
+}
+
+void FLocalBackend::RouteCloudStorage()
+{
+	Route(Endpoints::CloudStorage::GetAllSlots, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		TArray<FAccelByteModelsSlot> Owned;
+
+		for (const TPair<FString, FSlot>& Slot : Slots)
+		{
+			if (Slot.Value.Metadata.UserId == UserId)
+			{
+				Owned.Add(Slot.Value.Metadata);
+			}
+		}
+
+		Response.SetContent(200, ToJsonArray(Owned));
+	});
+
+	Route(Endpoints::CloudStorage::CreateSlot, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FSlot Slot;
+		Slot.Metadata.SlotId = NewId();
+		Slot.Metadata.UserId = UserId;
+		Slot.Metadata.Namespace = Config.Namespace;
+		Slot.Metadata.StoredName = Slot.Metadata.SlotId;
+		Slot.Metadata.Status = TEXT("UPLOADED");
+		Slot.Metadata.DateCreated = FDateTime::UtcNow();
+		UpdateSlot(Slot, Request, true);
+		Response.SetContent(201, ToJson(Slots.Add(Slot.Metadata.SlotId, MoveTemp(Slot)).Metadata));
+	});
+
+	Route(Endpoints::CloudStorage::GetSlot, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FSlot* Slot = nullptr;
+
+		if (FindSlot(Request, Response, UserId, Slot))
+		{
+			Slot->Metadata.DateAccessed = FDateTime::UtcNow();
+			Response.Code = 200;
+			Response.ContentType = Slot->Metadata.MimeType.IsEmpty() ? TEXT("application/octet-stream") : Slot->Metadata.MimeType;
+			Response.Body = Slot->Data;
+		}
+	});
+
+	Route(Endpoints::CloudStorage::UpdateSlot, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FSlot* Slot = nullptr;
+
+		if (FindSlot(Request, Response, UserId, Slot))
+		{
+			UpdateSlot(*Slot, Request, true);
+			Response.SetContent(200, ToJson(Slot->Metadata));
+		}
+	});
+
+	Route(Endpoints::CloudStorage::UpdateSlotMetadata, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FSlot* Slot = nullptr;
+
+		if (FindSlot(Request, Response, UserId, Slot))
+		{
+			UpdateSlot(*Slot, Request, false);
+			Response.SetContent(200, ToJson(Slot->Metadata));
+		}
+	});
+
+	Route(Endpoints::CloudStorage::DeleteSlot, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FSlot* Slot = nullptr;
+
+		if (FindSlot(Request, Response, UserId, Slot))
+		{
+			Slots.Remove(Request.Params[2]);
+			Response.Code = 204;
+		}
+	});
+}
+
+void FLocalBackend::RouteGameProfile()
+{
+	Route(Endpoints::GameProfile::BatchGetPublicGameProfiles, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString&)
+	{
+		TArray<FAccelByteModelsPublicGameProfile> Result;
+
+		for (const FString& UserId : Request.GetQueryValues(TEXT("userIds")))
+		{
+			FAccelByteModelsPublicGameProfile& Public = Result[Result.AddDefaulted()];
+			Public.userId = UserId;
+
+			for (const TPair<FString, FAccelByteModelsGameProfile>& Profile : GameProfiles)
+			{
+				if (Profile.Value.userId == UserId)
+				{
+					Public.gameProfiles.Add(FAccelByteModelsPublicGameProfileInfo{ Profile.Value.profileId, Profile.Value.Namespace, Profile.Value.profileName, Profile.Value.avatarUrl });
+				}
+			}
+		}
+
+		Response.SetContent(200, ToJsonArray(Result));
+	});
+
+	Route(Endpoints::GameProfile::GetAllGameProfiles, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		TArray<FAccelByteModelsGameProfile> Owned;
+
+		for (const TPair<FString, FAccelByteModelsGameProfile>& Profile : GameProfiles)
+		{
+			if (Profile.Value.userId == UserId)
+			{
+				Owned.Add(Profile.Value);
+			}
+		}
+
+		Response.SetContent(200, ToJsonArray(Owned));
+	});
+
+	Route(Endpoints::GameProfile::CreateGameProfile, [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FAccelByteModelsGameProfileRequest Create;
+
+		if (!FromJson(Request, Response, Create))
+		{
+			return;
+		}
+
+		FAccelByteModelsGameProfile Profile{ NewId(), UserId, Config.Namespace, Create.profileName, Create.avatarUrl, Create.label, Create.tags, Create.attributes };
+		Response.SetContent(201, ToJson(GameProfiles.Add(Profile.profileId, Profile)));
+	});
+
+	// Profiles of other users are not found, as the service does
+	auto FindProfile = [this](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId) -> FAccelByteModelsGameProfile*
+	{
+		FAccelByteModelsGameProfile* Profile = GameProfiles.Find(Request.Params[2]);
+
+		if (Profile == nullptr || Profile->userId != UserId)
+		{
+			Response.SetError(404, 12041, TEXT("Game profile not found"));
+
+			return nullptr;
+		}
+
+		return Profile;
+	};
+
+	Route(Endpoints::GameProfile::GetGameProfile, [FindProfile](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		if (FAccelByteModelsGameProfile* Profile = FindProfile(Request, Response, UserId))
+		{
+			Response.SetContent(200, ToJson(*Profile));
+		}
+	});
+
+	Route(Endpoints::GameProfile::UpdateGameProfile, [FindProfile](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FAccelByteModelsGameProfileRequest Update;
+
+		if (!FromJson(Request, Response, Update))
+		{
+			return;
+		}
+
+		if (FAccelByteModelsGameProfile* Profile = FindProfile(Request, Response, UserId))
+		{
+			Profile->profileName = Update.profileName;
+			Profile->avatarUrl = Update.avatarUrl;
+			Profile->label = Update.label;
+			Profile->tags = Update.tags;
+			Profile->attributes = Update.attributes;
+			Response.SetContent(200, ToJson(*Profile));
+		}
+	});
+
+	Route(Endpoints::GameProfile::DeleteGameProfile, [this, FindProfile](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		if (FindProfile(Request, Response, UserId) != nullptr)
+		{
+			GameProfiles.Remove(Request.Params[2]);
+			Response.Code = 204;
+		}
+	});
+
+	Route(Endpoints::GameProfile::GetGameProfileAttribute, [FindProfile](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FAccelByteModelsGameProfile* Profile = FindProfile(Request, Response, UserId);
+
+		if (Profile == nullptr)
+		{
+			return;
+		}
+
+		const FString* Value = Profile->attributes.Find(Request.Params[3]);
+
+		if (Value == nullptr)
+		{
+			Response.SetError(404, 12042, TEXT("Game profile attribute not found"));
+
+			return;
+		}
+
+		Response.SetContent(200, ToJson(FAccelByteModelsGameProfileAttribute{ Request.Params[3], *Value }));
+	});
+
+	Route(Endpoints::GameProfile::UpdateGameProfileAttribute, [FindProfile](const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)
+	{
+		FAccelByteModelsGameProfileAttribute Attribute;
+
+		if (!FromJson(Request, Response, Attribute))
+		{
+			return;
+		}
+
+		if (FAccelByteModelsGameProfile* Profile = FindProfile(Request, Response, UserId))
+		{
+			Profile->attributes.Add(Request.Params[3], Attribute.value);
+			Response.SetContent(200, ToJson(*Profile));
+		}
+	});
+}
+
+bool FLocalBackend::AuthorizeClient(const FLocalHttpRequest& Request, FLocalHttpResponse& Response) const
+{
+	if (Request.GetHeader(TEXT("Authorization")) == TEXT("Basic ") + FBase64::Encode(Config.ClientId + TEXT(":") + Config.ClientSecret))
+	{
+		return true;
+	}
+
+	Response.SetError(401, 20001, TEXT("Unauthorized client"));
+
+	return false;
+}
+
+FLocalBackend::FUser& FLocalBackend::AddUser(const FString& LoginId, const FString& Password, const FString& DisplayName, const FString& AuthType)
+{
+	FString UserId = NewId();
+	FUser& Added = Users.Add(UserId);
+	Added.Password = Password;
+	Added.Data.UserId = UserId;
+	Added.Data.Namespace = Config.Namespace;
+	Added.Data.LoginId = LoginId;
+	Added.Data.EmailAddress = LoginId;
+	Added.Data.DisplayName = DisplayName;
+	Added.Data.AuthType = AuthType;
+	Added.Data.CreatedAt = GetNow();
+	Added.Data.Enabled = true;
+	Added.Data.Roles.Add(TEXT("user"));
+
+	FAccelByteModelsWalletInfo Wallet;
+	Wallet.Id = NewId();
+	Wallet.Namespace = Config.Namespace;
+	Wallet.UserId = UserId;
+	Wallet.CurrencyCode = Config.CurrencyCode;
+	Wallet.CurrencySymbol = Config.CurrencyCode;
+	Wallet.Balance = Config.InitialBalance;
+	Wallet.CreatedAt = Added.Data.CreatedAt;
+	Wallet.UpdatedAt = Added.Data.CreatedAt;
+	Wallet.Status = TEXT("ACTIVE");
+	Wallets.FindOrAdd(UserId).Add(Config.CurrencyCode, Wallet);
+
+	return Added;
+}
+
+FLocalBackend::FUser* FLocalBackend::FindUserByLoginId(const FString& LoginId)
+{
+	for (TPair<FString, FUser>& Candidate : Users)
+	{
+		if (Candidate.Value.Data.LoginId == LoginId)
+		{
+			return &Candidate.Value;
+		}
+	}
+
+	return nullptr;
+}
+
+void FLocalBackend::IssueToken(const FString& UserId, FLocalHttpResponse& Response)
+{
+	FOauth2Token Token;
+	Token.Access_token = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+	Token.Token_type = TEXT("Bearer");
+	Token.Expires_in = Config.TokenLifetime;
+	Token.Namespace = Config.Namespace;
+	AccessTokens.Add(Token.Access_token, FToken{ UserId, FPlatformTime::Seconds() + Config.TokenLifetime });
+
+	// Client tokens can't be refreshed
+	if (const FUser* Owner = Users.Find(UserId))
+	{
+		Token.Refresh_token = FGuid::NewGuid().ToString(EGuidFormats::Digits);
+		Token.User_id = UserId;
+		Token.Display_name = Owner->Data.DisplayName;
+		Token.Roles = Owner->Data.Roles;
+		RefreshTokens.Add(Token.Refresh_token, UserId);
+	}
+
+	Response.SetContent(200, ToJson(Token));
+}
+
+FAccelByteModelsEntitlementInfo FLocalBackend::Grant(const FString& UserId, const FAccelByteModelsItemInfo& Item, int32 Quantity)
+{
+	FAccelByteModelsEntitlementInfo Entitlement;
+	Entitlement.Id = NewId();
+	Entitlement.Namespace = Config.Namespace;
+	Entitlement.Clazz = EAccelByteEntitlementClass::ENTITLEMENT;
+	Entitlement.Type = Item.EntitlementType == TEXT("CONSUMABLE") ? EAccelByteEntitlementType::CONSUMABLE : EAccelByteEntitlementType::DURABLE;
+	Entitlement.Status = EAccelByteEntitlementStatus::ACTIVE;
+	Entitlement.Sku = Item.Sku;
+	Entitlement.UserId = UserId;
+	Entitlement.ItemId = Item.ItemId;
+	Entitlement.ItemNamespace = Item.Namespace;
+	Entitlement.Name = Item.Name;
+	Entitlement.UseCount = Item.UseCount;
+	Entitlement.Quantity = Quantity;
+	Entitlement.ItemSnapshot.ItemId = Item.ItemId;
+	Entitlement.ItemSnapshot.Sku = Item.Sku;
+	Entitlement.ItemSnapshot.Namespace = Item.Namespace;
+	Entitlement.ItemSnapshot.Name = Item.Name;
+	Entitlement.ItemSnapshot.Title = Item.Title;
+	Entitlement.GrantedAt = GetNow();
+	Entitlement.CreatedAt = Entitlement.GrantedAt;
+	Entitlement.UpdatedAt = Entitlement.GrantedAt;
+	Entitlements.Add(Entitlement);
+
+	return Entitlement;
+}
+
+bool FLocalBackend::FindSlot(const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId, FSlot*& OutSlot)
+{
+	OutSlot = Slots.Find(Request.Params[2]);
+
+	if (OutSlot == nullptr || OutSlot->Metadata.UserId != UserId)
+	{
+		OutSlot = nullptr;
+		Response.SetError(404, 13041, TEXT("Slot not found"));
+
+		return false;
+	}
+
+	return true;
+}
+
+void FLocalBackend::UpdateSlot(FSlot& Slot, const FLocalHttpRequest& Request, bool bHasFile)
+{
+	Slot.Metadata.Tags = Request.GetQueryValues(TEXT("tags"));
+	Slot.Metadata.Label = Request.GetQuery(TEXT("label"));
+	Slot.Metadata.DateModified = FDateTime::UtcNow();
+
+	for (FFormPart& Part : ParseMultipart(Request))
+	{
+		if (Part.Name == TEXT("customAttribute"))
+		{
+			FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Part.Data.GetData()), Part.Data.Num());
+			Slot.Metadata.CustomAttribute = FString(Converter.Length(), Converter.Get());
+		}
+		else if (Part.Name == TEXT("file") && bHasFile)
+		{
+			Slot.Metadata.OriginalName = Part.FileName;
+			Slot.Metadata.MimeType = Part.ContentType;
+			Slot.Metadata.Checksum = FMD5::HashBytes(Part.Data.GetData(), Part.Data.Num());
+			Slot.Data = MoveTemp(Part.Data);
+		}
+	}
+}
+
+FString FLocalBackend::NewId()
+{
+	// Ids look like the services' ones, 32 hex digits, and stay unique across backends of one run
+	return FString::Printf(TEXT("%08x%s"), ++LastId, *FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(24).ToLower());
+}
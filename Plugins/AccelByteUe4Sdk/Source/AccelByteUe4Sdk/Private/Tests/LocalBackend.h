@@ -0,0 +1,136 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LocalHttpServer.h"
+#include "AccelByteSettings.h"
+#include "AccelByteHttpRequestFactory.h"
+#include "Models/AccelByteOauth2Models.h"
+#include "Models/AccelByteUserModels.h"
+#include "Models/AccelByteUserProfileModels.h"
+#include "Models/AccelByteWalletModels.h"
+#include "Models/AccelByteOrderModels.h"
+#include "Models/AccelByteItemModels.h"
+#include "Models/AccelByteCategoryModels.h"
+#include "Models/AccelByteEntitlementModels.h"
+#include "Models/AccelByteCloudStorageModels.h"
+#include "Models/AccelByteGameProfileModels.h"
+
+/**
+ * @brief Stand-in for the IAM, Platform, Basic, CloudStorage and GameProfile services, kept in memory behind a FLocalHttpServer.
+ * Routes are the SDK's own endpoint descriptors, so every request the SDK can build finds its handler, and they check the Authorization the endpoint sends.
+ * A request sent again with the Idempotency-Key of one already applied gets the first answer back instead of being applied twice.
+ * The catalog starts with a root, a child and a grandchild category, items priced in the seeded currency and a free COINS item; every new user gets a wallet of it.
+ * The IAM admin calls of DeleteUserById are answered too, so the integration tests can run against it (see UseLocalBackendIfRequested).
+ * State is only touched from the server thread; the Add functions are called before Start.
+ */
+class FLocalBackend
+{
+public:
+	struct FConfig
+	{
+		FLocalHttpServer::FConfig Server;
+		FString ClientId = TEXT("local-client");
+		FString ClientSecret = TEXT("local-secret");
+		FString Namespace = TEXT("local");
+		FString PublisherNamespace = TEXT("local-publisher");
+		FString CurrencyCode = TEXT("LOCAL");
+		int32 InitialBalance = 1000;
+		/** Lifetime of the access tokens, in seconds. */
+		int32 TokenLifetime = 3600;
+		/** Per endpoint path, how many of its first answers are replaced by a 502 once the handler has run, as a gateway losing them. */
+		TMap<FString, int32> LostAnswers;
+		/** Cache-Control of the catalog and profile answers, which then carry an ETag and are answered 304 when it matches; empty sends neither. */
+		FString CacheControl;
+	};
+
+	explicit FLocalBackend(const FConfig& Config = FConfig());
+	~FLocalBackend();
+
+	bool Start(int32 Port = 0);
+	void Shutdown();
+
+	/**
+	 * @brief Points every service URL and the client of Settings at this backend.
+	 */
+	void ApplyTo(AccelByte::Settings& Settings) const;
+
+	void AddCategory(const FAccelByteModelsFullCategoryInfo& Category);
+	void AddItem(const FAccelByteModelsItemInfo& Item);
+
+	FLocalHttpServer& GetServer();
+
+	/**
+	 * @brief Owner of a user access token, empty when it is unknown, expired or the client's.
+	 * Called on the server thread only, e.g. as the resolver of a FLocalLobbyServer routed on GetServer.
+	 */
+	FString FindUserId(const FString& AccessToken) const;
+
+private:
+	struct FUser
+	{
+		FUserData Data;
+		FString Password;
+		TArray<FPlatformLink> Links;
+	};
+
+	struct FToken
+	{
+		/** Empty for client tokens. */
+		FString UserId;
+		double ExpiresAt;
+	};
+
+	struct FSlot
+	{
+		FAccelByteModelsSlot Metadata;
+		TArray<uint8> Data;
+	};
+
+	typedef TFunction<void(const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId)> FHandler;
+
+	/** Routes an endpoint of the SDK; UserId is the owner of the bearer token, empty for the client's. Cacheable answers follow FConfig::CacheControl. */
+	void Route(const AccelByte::FHttpEndpoint& Endpoint, const FHandler& Handler, bool bIsCacheable = false);
+	void RouteIam();
+	void RouteBasic();
+	void RoutePlatform();
+	void RouteCloudStorage();
+	void RouteGameProfile();
+
+	/** False with a 401 response when the request doesn't carry the Basic authorization of the client. */
+	bool AuthorizeClient(const FLocalHttpRequest& Request, FLocalHttpResponse& Response) const;
+	FUser& AddUser(const FString& LoginId, const FString& Password, const FString& DisplayName, const FString& AuthType);
+	FUser* FindUserByLoginId(const FString& LoginId);
+	void IssueToken(const FString& UserId, FLocalHttpResponse& Response);
+	FAccelByteModelsEntitlementInfo Grant(const FString& UserId, const FAccelByteModelsItemInfo& Item, int32 Quantity);
+	/** False with an error response when the slot doesn't exist or belongs to another user. */
+	bool FindSlot(const FLocalHttpRequest& Request, FLocalHttpResponse& Response, const FString& UserId, FSlot*& OutSlot);
+	void UpdateSlot(FSlot& Slot, const FLocalHttpRequest& Request, bool bHasFile);
+	FString NewId();
+
+	FConfig Config;
+	FLocalHttpServer Server;
+	int32 LastId;
+
+	TMap<FString, FUser> Users;
+	TMap<FString, FToken> AccessTokens;
+	/** Refresh token to user id, each one is used once. */
+	TMap<FString, FString> RefreshTokens;
+	TMap<FString, FAccelByteModelsUserProfileInfo> Profiles;
+	/** Per user, per currency code. */
+	TMap<FString, TMap<FString, FAccelByteModelsWalletInfo>> Wallets;
+	TMap<FString, FAccelByteModelsOrderInfo> Orders;
+	TMap<FString, TArray<FAccelByteModelsOrderHistoryInfo>> OrderHistories;
+	TArray<FAccelByteModelsFullCategoryInfo> Categories;
+	TArray<FAccelByteModelsItemInfo> Items;
+	TArray<FAccelByteModelsEntitlementInfo> Entitlements;
+	TMap<FString, FSlot> Slots;
+	TMap<FString, FAccelByteModelsGameProfile> GameProfiles;
+	/** First answer per user, verb, path and Idempotency-Key. */
+	TMap<FString, FLocalHttpResponse> KeyedAnswers;
+	/** Answers still to lose per endpoint path, from FConfig::LostAnswers. */
+	TMap<FString, int32> LostAnswers;
+};
@@ -0,0 +1,303 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AutomationTest.h"
+#include "AccelByteRegistry.h"
+#include "AccelByteUserApi.h"
+#include "AccelByteUserProfileApi.h"
+#include "AccelByteOrderApi.h"
+#include "AccelByteWalletApi.h"
+#include "AccelByteEntitlementApi.h"
+#include "AccelByteCloudStorageApi.h"
+#include "AccelByteItemApi.h"
+#include "AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteEndpoints.h"
+#include "LocalBackend.h"
+#include "TestUtilities.h"
+
+using AccelByte::FErrorHandler;
+using AccelByte::FVoidHandler;
+using AccelByte::THandler;
+using AccelByte::Settings;
+using AccelByte::FRegistry;
+using AccelByte::Api::User;
+using AccelByte::Api::UserProfile;
+using AccelByte::Api::Order;
+using AccelByte::Api::Wallet;
+using AccelByte::Api::Entitlement;
+using AccelByte::Api::CloudStorage;
+using AccelByte::Api::Item;
+using AccelByte::FHttpBatchScope;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteLocalBackendTest, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteLocalBackendTest);
+
+static const int32 AutomationFlagMaskLocalBackend = (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ClientContext);
+
+static const auto LocalBackendTestErrorHandler = FErrorHandler::CreateLambda([](int32 ErrorCode, const FString& ErrorMessage)
+{
+	UE_LOG(LogAccelByteLocalBackendTest, Fatal, TEXT("Error code: %d\nError message:%s"), ErrorCode, *ErrorMessage);
+});
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(LocalBackendUserJourney, "AccelByte.Tests.LocalBackend.UserJourney_RunsWithoutDeployment", AutomationFlagMaskLocalBackend);
+bool LocalBackendUserJourney::RunTest(const FString& Parameters)
+{
+	FLocalBackend::FConfig Config;
+	Config.Server.Latency = AccelByte::FLatencyDistribution::Constant(0.05);
+	FLocalBackend Backend(Config);
+	check(Backend.Start());
+
+	Settings OriginalSettings = FRegistry::Settings;
+	Backend.ApplyTo(FRegistry::Settings);
+	FRegistry::Credentials.ForgetAll();
+
+	bool bIsClientLoggedIn = false;
+	User::LoginWithClientCredentials(FVoidHandler::CreateLambda([&]()
+	{
+		bIsClientLoggedIn = true;
+	}), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+
+	const FString Email = TEXT("local@example.com");
+	const FString Password = TEXT("password");
+	bool bIsRegistered = false;
+	User::Register(Email, Password, TEXT("Local"), THandler<FUserData>::CreateLambda([&](const FUserData& Result)
+	{
+		bIsRegistered = Result.LoginId == Email;
+	}), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+
+	bool bIsLoggedIn = false;
+	double LoginStartTime = FPlatformTime::Seconds();
+	User::LoginWithUsername(Email, Password, FVoidHandler::CreateLambda([&]()
+	{
+		bIsLoggedIn = true;
+	}), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+	double LoginDuration = FPlatformTime::Seconds() - LoginStartTime;
+
+	FAccelByteModelsUserProfileCreateRequest ProfileCreate;
+	ProfileCreate.FirstName = TEXT("Local");
+	ProfileCreate.Language = TEXT("en");
+	FAccelByteModelsUserProfileInfo Profile;
+	UserProfile::CreateUserProfile(ProfileCreate, THandler<FAccelByteModelsUserProfileInfo>(), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+	UserProfile::GetUserProfile(THandler<FAccelByteModelsUserProfileInfo>::CreateLambda([&](const FAccelByteModelsUserProfileInfo& Result)
+	{
+		Profile = Result;
+	}), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+
+	FAccelByteModelsOrderCreate OrderCreate;
+	OrderCreate.ItemId = TEXT("item-1");
+	OrderCreate.Quantity = 1;
+	OrderCreate.Price = 10;
+	OrderCreate.DiscountedPrice = 10;
+	OrderCreate.CurrencyCode = Config.CurrencyCode;
+	FAccelByteModelsOrderInfo CreatedOrder;
+	Order::CreateNewOrder(OrderCreate, THandler<FAccelByteModelsOrderInfo>::CreateLambda([&](const FAccelByteModelsOrderInfo& Result)
+	{
+		CreatedOrder = Result;
+	}), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+
+	int32 Balance = -1;
+	Wallet::GetWalletInfoByCurrencyCode(Config.CurrencyCode, THandler<FAccelByteModelsWalletInfo>::CreateLambda([&](const FAccelByteModelsWalletInfo& Result)
+	{
+		Balance = Result.Balance;
+	}), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+
+	int32 EntitlementCount = 0;
+	Entitlement::QueryUserEntitlement(TEXT(""), TEXT("item-1"), 0, 20, THandler<FAccelByteModelsEntitlementPagingSlicedResult>::CreateLambda([&](const FAccelByteModelsEntitlementPagingSlicedResult& Result)
+	{
+		EntitlementCount = Result.Data.Num();
+	}), LocalBackendTestErrorHandler, EAccelByteEntitlementClass::NONE, EAccelByteAppType::NONE);
+	FlushHttpRequests();
+
+	TArray<uint8> Payload = UAccelByteBlueprintsTest::FStringToBytes(TEXT("local payload"));
+	FAccelByteModelsSlot Slot;
+	CloudStorage::CreateSlot(Payload, TEXT("local.txt"), { TEXT("tag") }, TEXT("label"), TEXT("attribute"), THandler<FAccelByteModelsSlot>::CreateLambda([&](const FAccelByteModelsSlot& Result)
+	{
+		Slot = Result;
+	}), nullptr, LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+
+	TArray<uint8> Downloaded;
+	CloudStorage::GetSlot(Slot.SlotId, THandler<TArray<uint8>>::CreateLambda([&](const TArray<uint8>& Result)
+	{
+		Downloaded = Result;
+	}), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+
+	FRegistry::Credentials.ForgetAll();
+	FRegistry::Settings = OriginalSettings;
+	int32 RequestCount = Backend.GetServer().GetRequestCount();
+	Backend.Shutdown();
+
+	check(bIsClientLoggedIn);
+	check(bIsRegistered);
+	check(bIsLoggedIn);
+	check(LoginDuration >= 0.05);
+	check(Profile.FirstName == ProfileCreate.FirstName);
+	check(CreatedOrder.Status == TEXT("FULFILLED"));
+	check(Balance == Config.InitialBalance - OrderCreate.DiscountedPrice);
+	check(EntitlementCount == 1);
+	check(Slot.Tags.Num() == 1 && Slot.Label == TEXT("label") && Slot.CustomAttribute == TEXT("attribute"));
+	check(Downloaded == Payload);
+	check(RequestCount >= 11);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(LocalBackendLostAnswers, "AccelByte.Tests.LocalBackend.KeyedWrites_AnswerLostAfterCommit_AppliedOnce", AutomationFlagMaskLocalBackend);
+bool LocalBackendLostAnswers::RunTest(const FString& Parameters)
+{
+	// The gateway loses the first answers after the backend applied them, the SDK sends them again with the same key
+	FLocalBackend::FConfig Config;
+	Config.LostAnswers.Add(AccelByte::Endpoints::User::Register.Path, 1);
+	Config.LostAnswers.Add(AccelByte::Endpoints::Order::CreateNewOrder.Path, 1);
+	FLocalBackend Backend(Config);
+	check(Backend.Start());
+
+	Settings OriginalSettings = FRegistry::Settings;
+	Backend.ApplyTo(FRegistry::Settings);
+	FRegistry::Credentials.ForgetAll();
+
+	User::LoginWithClientCredentials(FVoidHandler(), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+
+	const FString Email = TEXT("lost@example.com");
+	const FString Password = TEXT("password");
+	bool bIsRegistered = false;
+	bool bIsRegisterFailed = false;
+	User::Register(Email, Password, TEXT("Lost"), THandler<FUserData>::CreateLambda([&](const FUserData& Result)
+	{
+		bIsRegistered = Result.LoginId == Email;
+	}), FErrorHandler::CreateLambda([&](int32 ErrorCode, const FString& ErrorMessage)
+	{
+		bIsRegisterFailed = true;
+	}));
+	FlushHttpRequests();
+
+	User::LoginWithUsername(Email, Password, FVoidHandler(), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+
+	FAccelByteModelsOrderCreate OrderCreate;
+	OrderCreate.ItemId = TEXT("item-1");
+	OrderCreate.Quantity = 1;
+	OrderCreate.Price = 10;
+	OrderCreate.DiscountedPrice = 10;
+	OrderCreate.CurrencyCode = Config.CurrencyCode;
+	FAccelByteModelsOrderInfo CreatedOrder;
+	bool bIsOrderFailed = false;
+	Order::CreateNewOrder(OrderCreate, THandler<FAccelByteModelsOrderInfo>::CreateLambda([&](const FAccelByteModelsOrderInfo& Result)
+	{
+		CreatedOrder = Result;
+	}), FErrorHandler::CreateLambda([&](int32 ErrorCode, const FString& ErrorMessage)
+	{
+		bIsOrderFailed = true;
+	}));
+	FlushHttpRequests();
+
+	int32 OrderCount = 0;
+	Order::GetUserOrders(0, 20, THandler<FAccelByteModelsOrderInfoPaging>::CreateLambda([&](const FAccelByteModelsOrderInfoPaging& Result)
+	{
+		OrderCount = Result.Data.Num();
+	}), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+
+	int32 Balance = -1;
+	Wallet::GetWalletInfoByCurrencyCode(Config.CurrencyCode, THandler<FAccelByteModelsWalletInfo>::CreateLambda([&](const FAccelByteModelsWalletInfo& Result)
+	{
+		Balance = Result.Balance;
+	}), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+
+	FRegistry::Credentials.ForgetAll();
+	FRegistry::Settings = OriginalSettings;
+	Backend.Shutdown();
+
+	check(bIsRegistered);
+	check(!bIsRegisterFailed);
+	check(!bIsOrderFailed);
+	check(CreatedOrder.Status == TEXT("FULFILLED"));
+	check(OrderCount == 1);
+	check(Balance == Config.InitialBalance - OrderCreate.DiscountedPrice);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(LocalBackendBatchScope, "AccelByte.Tests.LocalBackend.BatchScope_StorePage_DuplicatesSentOnce", AutomationFlagMaskLocalBackend);
+bool LocalBackendBatchScope::RunTest(const FString& Parameters)
+{
+	FLocalBackend::FConfig Config;
+	Config.Server.Latency = AccelByte::FLatencyDistribution::Constant(0.05);
+	FLocalBackend Backend(Config);
+	check(Backend.Start());
+
+	Settings OriginalSettings = FRegistry::Settings;
+	Backend.ApplyTo(FRegistry::Settings);
+	FRegistry::Credentials.ForgetAll();
+
+	const FString Email = TEXT("batch@example.com");
+	const FString Password = TEXT("password");
+	User::LoginWithClientCredentials(FVoidHandler(), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+	User::Register(Email, Password, TEXT("Batch"), THandler<FUserData>(), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+	User::LoginWithUsername(Email, Password, FVoidHandler(), LocalBackendTestErrorHandler);
+	FlushHttpRequests();
+
+	// A store page of eight tiles showing two items, and the wallet checked by two widgets
+	int32 RequestCountBefore = Backend.GetServer().GetRequestCount();
+	int32 ItemCount = 0;
+	int32 WalletCount = 0;
+	int32 HandledBeforeBatch = -1;
+	int32 BatchCount = 0;
+	int32 HeldCount = 0;
+
+	{
+		FHttpBatchScope Batch(FRegistry::HttpRetryScheduler, FVoidHandler::CreateLambda([&]()
+		{
+			HandledBeforeBatch = ItemCount + WalletCount;
+			BatchCount++;
+		}));
+
+		for (int32 i = 0; i < 8; i++)
+		{
+			Item::GetItemById(FString::Printf(TEXT("item-%d"), i % 2 + 1), TEXT("en"), TEXT("US"), THandler<FAccelByteModelsItemInfo>::CreateLambda([&](const FAccelByteModelsItemInfo& Result)
+			{
+				ItemCount++;
+			}), LocalBackendTestErrorHandler);
+		}
+
+		for (int32 i = 0; i < 2; i++)
+		{
+			Wallet::GetWalletInfoByCurrencyCode(Config.CurrencyCode, THandler<FAccelByteModelsWalletInfo>::CreateLambda([&](const FAccelByteModelsWalletInfo& Result)
+			{
+				WalletCount++;
+			}), LocalBackendTestErrorHandler);
+		}
+
+		HeldCount = Batch.Num();
+	}
+
+	FlushHttpRequests();
+	int32 RequestCount = Backend.GetServer().GetRequestCount() - RequestCountBefore;
+
+	FRegistry::Credentials.ForgetAll();
+	FRegistry::Settings = OriginalSettings;
+	Backend.Shutdown();
+
+	check(HeldCount == 10);
+	check(ItemCount == 8);
+	check(WalletCount == 2);
+	check(BatchCount == 1);
+	check(HandledBeforeBatch == 10);
+	// Ten calls, three distinct requests
+	check(RequestCount == 3);
+
+	return true;
+}
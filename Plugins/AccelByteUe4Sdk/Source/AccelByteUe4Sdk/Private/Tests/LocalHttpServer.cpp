@@ -0,0 +1,925 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "LocalHttpServer.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SecureHash.h"
+#include "Misc/Base64.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "AccelByteHttpCompression.h"
+
+using namespace AccelByte;
+
+/** Requests whose headers don't fit are malformed. */
+static const int32 MaxHeaderSize = 64 * 1024;
+static const int32 MaxMessageSize = 16 * 1024 * 1024;
+static const TCHAR* const WebSocketGuid = TEXT("258EAFA5-E914-47DA-95CA-C5AB0DC85B11");
+
+namespace WebSocketOpcode
+{
+	const uint8 Continuation = 0x0;
+	const uint8 Text = 0x1;
+	const uint8 Binary = 0x2;
+	const uint8 Close = 0x8;
+	const uint8 Ping = 0x9;
+	const uint8 Pong = 0xA;
+}
+
+static FString BytesToString(const uint8* Data, int32 Size)
+{
+	FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data), Size);
+
+	return FString(Converter.Length(), Converter.Get());
+}
+
+static void AppendString(TArray<uint8>& Data, const FString& String)
+{
+	FTCHARToUTF8 Converter(*String);
+	Data.Append(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+}
+
+/** Appends an unmasked final frame, as servers send them. */
+static void AppendFrame(TArray<uint8>& Data, uint8 Opcode, const uint8* Payload, int32 Size)
+{
+	Data.Add(0x80 | Opcode);
+
+	if (Size < 126)
+	{
+		Data.Add(static_cast<uint8>(Size));
+	}
+	else if (Size <= 0xFFFF)
+	{
+		Data.Add(126);
+		Data.Add(static_cast<uint8>(Size >> 8));
+		Data.Add(static_cast<uint8>(Size));
+	}
+	else
+	{
+		Data.Add(127);
+
+		for (int32 Shift = 56; Shift >= 0; Shift -= 8)
+		{
+			Data.Add(static_cast<uint8>(static_cast<uint64>(Size) >> Shift));
+		}
+	}
+
+	Data.Append(Payload, Size);
+}
+
+static const TCHAR* GetReasonPhrase(int32 Code)
+{
+	switch (Code)
+	{
+	case 101: return TEXT("Switching Protocols");
+	case 200: return TEXT("OK");
+	case 201: return TEXT("Created");
+	case 204: return TEXT("No Content");
+	case 304: return TEXT("Not Modified");
+	case 400: return TEXT("Bad Request");
+	case 401: return TEXT("Unauthorized");
+	case 403: return TEXT("Forbidden");
+	case 404: return TEXT("Not Found");
+	case 409: return TEXT("Conflict");
+	case 429: return TEXT("Too Many Requests");
+	case 500: return TEXT("Internal Server Error");
+	case 502: return TEXT("Bad Gateway");
+	case 503: return TEXT("Service Unavailable");
+	case 504: return TEXT("Gateway Timeout");
+	default: return TEXT("Unknown");
+	}
+}
+
+static void ParsePairs(const FString& Encoded, const TCHAR* Separator, TArray<TPair<FString, FString>>& OutPairs)
+{
+	TArray<FString> Fields;
+	Encoded.ParseIntoArray(Fields, Separator, true);
+
+	for (const FString& Field : Fields)
+	{
+		FString Name;
+		FString Value;
+
+		if (!Field.Split(TEXT("="), &Name, &Value))
+		{
+			Name = Field;
+		}
+
+		OutPairs.Add(TPair<FString, FString>(FGenericPlatformHttp::UrlDecode(Name), FGenericPlatformHttp::UrlDecode(Value.Replace(TEXT("+"), TEXT("%20")))));
+	}
+}
+
+FString FLocalHttpRequest::GetHeader(const FString& Name) const
+{
+	const FString* Value = Headers.Find(Name.ToLower());
+
+	return Value != nullptr ? *Value : FString();
+}
+
+FString FLocalHttpRequest::GetQuery(const FString& Name) const
+{
+	for (const TPair<FString, FString>& Pair : Query)
+	{
+		if (Pair.Key == Name)
+		{
+			return Pair.Value;
+		}
+	}
+
+	return FString();
+}
+
+TArray<FString> FLocalHttpRequest::GetQueryValues(const FString& Name) const
+{
+	TArray<FString> Values;
+
+	for (const TPair<FString, FString>& Pair : Query)
+	{
+		if (Pair.Key == Name)
+		{
+			Values.Add(Pair.Value);
+		}
+	}
+
+	return Values;
+}
+
+FString FLocalHttpRequest::GetBodyAsString() const
+{
+	return BytesToString(Body.GetData(), Body.Num());
+}
+
+TMap<FString, FString> FLocalHttpRequest::GetForm() const
+{
+	TArray<TPair<FString, FString>> Pairs;
+	ParsePairs(GetBodyAsString(), TEXT("&"), Pairs);
+
+	TMap<FString, FString> Form;
+
+	for (const TPair<FString, FString>& Pair : Pairs)
+	{
+		Form.Add(Pair.Key, Pair.Value);
+	}
+
+	return Form;
+}
+
+void FLocalHttpResponse::SetContent(int32 InCode, const FString& Content)
+{
+	Code = InCode;
+	Body.Reset();
+	AppendString(Body, Content);
+}
+
+void FLocalHttpResponse::SetError(int32 InCode, int32 ErrorCode, const FString& Message)
+{
+	FString Json;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("numericErrorCode"), ErrorCode);
+	Writer->WriteValue(TEXT("errorCode"), FString::FromInt(ErrorCode));
+	Writer->WriteValue(TEXT("errorMessage"), Message);
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	ContentType = TEXT("application/json");
+	SetContent(InCode, Json);
+}
+
+FLocalHttpServer::FLocalHttpServer()
+	: Listener(nullptr)
+	, Thread(nullptr)
+	, bIsStopping(false)
+	, Port(0)
+	, LastConnectionId(0)
+{
+}
+
+FLocalHttpServer::~FLocalHttpServer()
+{
+	Shutdown();
+}
+
+void FLocalHttpServer::Route(const FString& Verb, const FString& Pattern, const FHandler& Handler)
+{
+	check(Thread == nullptr);
+
+	FRoute Added{ Verb };
+	Pattern.ParseIntoArray(Added.Segments, TEXT("/"), true);
+	Added.Handler = Handler;
+	Added.bIsWebSocket = false;
+	Routes.Add(MoveTemp(Added));
+}
+
+void FLocalHttpServer::RouteWebSocket(const FString& Pattern, const FWebSocketHandler& Handler)
+{
+	check(Thread == nullptr);
+
+	FRoute Added{ TEXT("GET") };
+	Pattern.ParseIntoArray(Added.Segments, TEXT("/"), true);
+	Added.bIsWebSocket = true;
+	Added.WebSocket = Handler;
+	Routes.Add(MoveTemp(Added));
+}
+
+void FLocalHttpServer::SetTick(const TFunction<void(double CurrentTime)>& InTick)
+{
+	check(Thread == nullptr);
+
+	Tick = InTick;
+}
+
+bool FLocalHttpServer::Start(int32 InPort)
+{
+	check(Thread == nullptr);
+
+	ISocketSubsystem* Sockets = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	Listener = Sockets->CreateSocket(NAME_Stream, TEXT("AccelByte local HTTP server"), false);
+
+	if (Listener == nullptr)
+	{
+		return false;
+	}
+
+	TSharedRef<FInternetAddr> Address = Sockets->CreateInternetAddr();
+	Address->SetIp(0x7f000001);
+	Address->SetPort(InPort);
+
+	if (!Listener->Bind(*Address) || !Listener->Listen(64) || !Listener->SetNonBlocking(true))
+	{
+		Sockets->DestroySocket(Listener);
+		Listener = nullptr;
+
+		return false;
+	}
+
+	Port = Listener->GetPortNo();
+	Random.Initialize(GetConfig().Seed);
+	bIsStopping = false;
+	Thread = FRunnableThread::Create(this, TEXT("AccelByteLocalHttpServer"));
+
+	return true;
+}
+
+void FLocalHttpServer::Shutdown()
+{
+	if (Thread == nullptr)
+	{
+		return;
+	}
+
+	Stop();
+	Thread->WaitForCompletion();
+	delete Thread;
+	Thread = nullptr;
+
+	for (FConnection& Connection : Connections)
+	{
+		Close(Connection);
+	}
+
+	Connections.Reset();
+	Tasks.Reset();
+	Listener->Close();
+	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Listener);
+	Listener = nullptr;
+}
+
+int32 FLocalHttpServer::GetPort() const
+{
+	return Port;
+}
+
+FString FLocalHttpServer::GetUrl() const
+{
+	return FString::Printf(TEXT("http://127.0.0.1:%d"), Port);
+}
+
+void FLocalHttpServer::SetConfig(const FConfig& InConfig)
+{
+	FScopeLock Lock(&ConfigMutex);
+	Config = InConfig;
+}
+
+FLocalHttpServer::FConfig FLocalHttpServer::GetConfig() const
+{
+	FScopeLock Lock(&ConfigMutex);
+
+	return Config;
+}
+
+int32 FLocalHttpServer::GetRequestCount() const
+{
+	return RequestCount.GetValue();
+}
+
+int32 FLocalHttpServer::GetMessageCount() const
+{
+	return MessageCount.GetValue();
+}
+
+void FLocalHttpServer::Post(const TFunction<void()>& Task)
+{
+	FScopeLock Lock(&TaskMutex);
+	Tasks.Add(Task);
+}
+
+bool FLocalHttpServer::SendText(int32 ConnectionId, const FString& Message)
+{
+	FConnection* Connection = FindConnection(ConnectionId);
+
+	if (Connection == nullptr || Connection->WebSocketRoute == nullptr || Connection->bIsClosing)
+	{
+		return false;
+	}
+
+	FTCHARToUTF8 Converter(*Message);
+	AppendFrame(Connection->Outgoing, WebSocketOpcode::Text, reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+
+	return true;
+}
+
+void FLocalHttpServer::CloseWebSocket(int32 ConnectionId)
+{
+	FConnection* Connection = FindConnection(ConnectionId);
+
+	if (Connection == nullptr || Connection->WebSocketRoute == nullptr || Connection->bIsClosing)
+	{
+		return;
+	}
+
+	// 1000, normal closure
+	const uint8 Status[] = { 0x03, 0xE8 };
+	AppendFrame(Connection->Outgoing, WebSocketOpcode::Close, Status, sizeof(Status));
+	Connection->bIsClosing = true;
+}
+
+uint32 FLocalHttpServer::Run()
+{
+	while (!bIsStopping)
+	{
+		Accept();
+
+		double CurrentTime = FPlatformTime::Seconds();
+		bool bHasProgressed = false;
+		TArray<TFunction<void()>> Posted;
+		{
+			FScopeLock Lock(&TaskMutex);
+			Posted = MoveTemp(Tasks);
+			Tasks.Reset();
+		}
+
+		for (const TFunction<void()>& Task : Posted)
+		{
+			Task();
+			bHasProgressed = true;
+		}
+
+		if (Tick)
+		{
+			Tick(CurrentTime);
+		}
+
+		for (int32 i = Connections.Num() - 1; i >= 0; --i)
+		{
+			if (!Service(Connections[i], CurrentTime, bHasProgressed))
+			{
+				const FRoute* WebSocketRoute = Connections[i].WebSocketRoute;
+				int32 ClosedId = Connections[i].Id;
+				Close(Connections[i]);
+				Connections.RemoveAtSwap(i);
+
+				if (WebSocketRoute != nullptr && WebSocketRoute->WebSocket.Close)
+				{
+					WebSocketRoute->WebSocket.Close(ClosedId);
+				}
+			}
+		}
+
+		// Answers waiting for their latency are checked every millisecond
+		if (!bHasProgressed)
+		{
+			FPlatformProcess::Sleep(0.001f);
+		}
+	}
+
+	return 0;
+}
+
+void FLocalHttpServer::Stop()
+{
+	bIsStopping = true;
+}
+
+void FLocalHttpServer::Accept()
+{
+	bool bHasPendingConnection = false;
+
+	while (Listener->HasPendingConnection(bHasPendingConnection) && bHasPendingConnection)
+	{
+		FSocket* Socket = Listener->Accept(TEXT("AccelByte local HTTP connection"));
+
+		if (Socket == nullptr)
+		{
+			return;
+		}
+
+		Socket->SetNonBlocking(true);
+		Socket->SetNoDelay(true);
+
+		FConnection Accepted;
+		Accepted.Id = ++LastConnectionId;
+		Accepted.Socket = Socket;
+		Connections.Add(MoveTemp(Accepted));
+	}
+}
+
+bool FLocalHttpServer::Service(FConnection& Connection, double CurrentTime, bool& bOutHasProgressed)
+{
+	uint8 Buffer[16 * 1024];
+	int32 BytesRead = 0;
+
+	// Recv succeeds with nothing read when no data is waiting, and fails once the peer has closed
+	while (!Connection.bIsClosing)
+	{
+		if (!Connection.Socket->Recv(Buffer, sizeof(Buffer), BytesRead))
+		{
+			return false;
+		}
+
+		if (BytesRead <= 0)
+		{
+			break;
+		}
+
+		Connection.Received.Append(Buffer, BytesRead);
+		bOutHasProgressed = true;
+	}
+
+	if (!Connection.bIsClosing)
+	{
+		bool bIsParsed = Connection.WebSocketRoute != nullptr ? ParseFrames(Connection) : ParseRequests(Connection, CurrentTime);
+
+		if (!bIsParsed)
+		{
+			return false;
+		}
+	}
+
+	while (Connection.Pending.Num() > 0 && Connection.Pending[0].DueTime <= CurrentTime)
+	{
+		FPendingResponse& Due = Connection.Pending[0];
+
+		if (Due.bIsDropped)
+		{
+			return false;
+		}
+
+		Connection.Outgoing.Append(Due.Data);
+		Connection.bIsClosing = Due.bIsLast;
+		Connection.Pending.RemoveAt(0);
+		bOutHasProgressed = true;
+	}
+
+	while (Connection.OutgoingOffset < Connection.Outgoing.Num())
+	{
+		int32 BytesSent = 0;
+
+		if (!Connection.Socket->Send(Connection.Outgoing.GetData() + Connection.OutgoingOffset, Connection.Outgoing.Num() - Connection.OutgoingOffset, BytesSent))
+		{
+			if (ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK)
+			{
+				break;
+			}
+
+			return false;
+		}
+
+		if (BytesSent <= 0)
+		{
+			break;
+		}
+
+		Connection.OutgoingOffset += BytesSent;
+		bOutHasProgressed = true;
+	}
+
+	if (Connection.OutgoingOffset == Connection.Outgoing.Num())
+	{
+		Connection.Outgoing.Reset();
+		Connection.OutgoingOffset = 0;
+
+		if (Connection.bIsClosing)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FLocalHttpServer::ParseRequests(FConnection& Connection, double CurrentTime)
+{
+	static const uint8 HeaderTerminator[] = { '\r', '\n', '\r', '\n' };
+
+	for (;;)
+	{
+		int32 HeaderEnd = INDEX_NONE;
+
+		for (int32 i = 0; i + 4 <= Connection.Received.Num(); i++)
+		{
+			if (FMemory::Memcmp(Connection.Received.GetData() + i, HeaderTerminator, 4) == 0)
+			{
+				HeaderEnd = i;
+				break;
+			}
+		}
+
+		if (HeaderEnd == INDEX_NONE)
+		{
+			return Connection.Received.Num() < MaxHeaderSize;
+		}
+
+		TArray<FString> Lines;
+		BytesToString(Connection.Received.GetData(), HeaderEnd).ParseIntoArray(Lines, TEXT("\r\n"), true);
+		TArray<FString> RequestLine;
+
+		if (Lines.Num() > 0)
+		{
+			Lines[0].ParseIntoArrayWS(RequestLine);
+		}
+
+		if (RequestLine.Num() != 3)
+		{
+			return false;
+		}
+
+		FLocalHttpRequest Request;
+		Request.Verb = RequestLine[0];
+		FString QueryString;
+
+		if (!RequestLine[1].Split(TEXT("?"), &Request.Path, &QueryString))
+		{
+			Request.Path = RequestLine[1];
+		}
+
+		ParsePairs(QueryString, TEXT("&"), Request.Query);
+
+		for (int32 i = 1; i < Lines.Num(); i++)
+		{
+			FString Name;
+			FString Value;
+
+			if (Lines[i].Split(TEXT(":"), &Name, &Value))
+			{
+				Request.Headers.Add(Name.TrimStartAndEnd().ToLower(), Value.TrimStartAndEnd());
+			}
+		}
+
+		// The SDK's bodies always have a length, chunked ones are not supported
+		if (!Request.GetHeader(TEXT("Transfer-Encoding")).IsEmpty())
+		{
+			return false;
+		}
+
+		int32 BodyStart = HeaderEnd + 4;
+		int32 ContentLength = FCString::Atoi(*Request.GetHeader(TEXT("Content-Length")));
+
+		if (ContentLength < 0)
+		{
+			return false;
+		}
+
+		if (Connection.Received.Num() < BodyStart + ContentLength)
+		{
+			return true;
+		}
+
+		Request.Body.Append(Connection.Received.GetData() + BodyStart, ContentLength);
+		Connection.Received.RemoveAt(0, BodyStart + ContentLength, false);
+
+		if (Request.GetHeader(TEXT("Upgrade")).Equals(TEXT("websocket"), ESearchCase::IgnoreCase))
+		{
+			// What follows the handshake are frames
+			return Upgrade(Connection, Request) && ParseFrames(Connection);
+		}
+
+		FString Encoding = Request.GetHeader(TEXT("Content-Encoding"));
+		TArray<uint8> Decompressed;
+
+		if (!Encoding.IsEmpty() && HttpCompression::Decompress(Encoding, Request.Body, Decompressed))
+		{
+			Request.Body = MoveTemp(Decompressed);
+		}
+
+		RequestCount.Increment();
+
+		FConfig Current = GetConfig();
+		FPendingResponse Pending;
+		Pending.bIsDropped = Random.FRand() < Current.DropRate;
+		Pending.DueTime = CurrentTime + Current.Latency.Sample(Random);
+		Pending.bIsLast = Request.GetHeader(TEXT("Connection")).Equals(TEXT("close"), ESearchCase::IgnoreCase) || RequestLine[2] == TEXT("HTTP/1.0");
+
+		FLocalHttpResponse Response;
+		int32 InjectedCode = 0;
+		float Draw = Random.FRand();
+
+		for (const TPair<int32, float>& Rate : Current.StatusRates)
+		{
+			if (Draw < Rate.Value)
+			{
+				InjectedCode = Rate.Key;
+				break;
+			}
+
+			Draw -= Rate.Value;
+		}
+
+		if (InjectedCode != 0)
+		{
+			Response.SetError(InjectedCode, InjectedCode, TEXT("Injected by the local server"));
+		}
+		else if (!Pending.bIsDropped)
+		{
+			Dispatch(Request, Response);
+		}
+
+		FString Head = FString::Printf(TEXT("HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %d\r\nConnection: %s\r\n"),
+			Response.Code,
+			GetReasonPhrase(Response.Code),
+			*Response.ContentType,
+			Response.Body.Num(),
+			Pending.bIsLast ? TEXT("close") : TEXT("keep-alive"));
+
+		for (const TPair<FString, FString>& Header : Response.Headers)
+		{
+			Head += FString::Printf(TEXT("%s: %s\r\n"), *Header.Key, *Header.Value);
+		}
+
+		Head += TEXT("\r\n");
+		AppendString(Pending.Data, Head);
+		Pending.Data.Append(Response.Body);
+		Connection.Pending.Add(MoveTemp(Pending));
+
+		if (Connection.Pending.Last().bIsLast)
+		{
+			// Nothing after this request is answered
+			Connection.Received.Reset();
+
+			return true;
+		}
+	}
+}
+
+bool FLocalHttpServer::Upgrade(FConnection& Connection, FLocalHttpRequest& Request)
+{
+	FString Key = Request.GetHeader(TEXT("Sec-WebSocket-Key"));
+	const FRoute* Matched = Match(Request);
+
+	// Answers still pending would be written after the frames
+	if (Matched == nullptr || !Matched->bIsWebSocket || Key.IsEmpty() || Connection.Pending.Num() > 0)
+	{
+		return false;
+	}
+
+	RequestCount.Increment();
+	int32 HandshakeOffset = Connection.Outgoing.Num();
+	Connection.WebSocketRoute = Matched;
+
+	if (Matched->WebSocket.Open && !Matched->WebSocket.Open(Connection.Id, Request))
+	{
+		Connection.WebSocketRoute = nullptr;
+		Connection.Outgoing.SetNum(HandshakeOffset);
+		AppendString(Connection.Outgoing, TEXT("HTTP/1.1 401 Unauthorized\r\nContent-Length: 0\r\nConnection: close\r\n\r\n"));
+		Connection.bIsClosing = true;
+		Connection.Received.Reset();
+
+		return true;
+	}
+
+	FTCHARToUTF8 AcceptSource(*(Key + WebSocketGuid));
+	uint8 Digest[20];
+	FSHA1::HashBuffer(AcceptSource.Get(), AcceptSource.Length(), Digest);
+	FString Head = FString::Printf(TEXT("HTTP/1.1 101 %s\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: %s\r\n"),
+		GetReasonPhrase(101),
+		*FBase64::Encode(TArray<uint8>(Digest, sizeof(Digest))));
+
+	// Clients like the one of the SDK insist on getting one of the protocols they offered
+	FString Protocols = Request.GetHeader(TEXT("Sec-WebSocket-Protocol"));
+	FString Protocol;
+
+	if (!Protocols.Split(TEXT(","), &Protocol, nullptr))
+	{
+		Protocol = Protocols;
+	}
+
+	if (!Protocol.TrimStartAndEnd().IsEmpty())
+	{
+		Head += FString::Printf(TEXT("Sec-WebSocket-Protocol: %s\r\n"), *Protocol.TrimStartAndEnd());
+	}
+
+	TArray<uint8> Handshake;
+	AppendString(Handshake, Head + TEXT("\r\n"));
+	Connection.Outgoing.Insert(Handshake, HandshakeOffset);
+
+	return true;
+}
+
+bool FLocalHttpServer::ParseFrames(FConnection& Connection)
+{
+	// Frames of clients are masked, their header is at most 14 bytes
+	while (!Connection.bIsClosing && Connection.Received.Num() >= 2)
+	{
+		const uint8* Data = Connection.Received.GetData();
+		int32 Size = Connection.Received.Num();
+		bool bIsFinal = (Data[0] & 0x80) != 0;
+		uint8 Opcode = Data[0] & 0x0F;
+		uint64 Length = Data[1] & 0x7F;
+		int32 Offset = 2;
+
+		if ((Data[1] & 0x80) == 0)
+		{
+			return false;
+		}
+
+		if (Length == 126)
+		{
+			if (Size < 4)
+			{
+				return true;
+			}
+
+			Length = (Data[2] << 8) | Data[3];
+			Offset = 4;
+		}
+		else if (Length == 127)
+		{
+			if (Size < 10)
+			{
+				return true;
+			}
+
+			Length = 0;
+
+			for (int32 i = 2; i < 10; i++)
+			{
+				Length = (Length << 8) | Data[i];
+			}
+
+			Offset = 10;
+		}
+
+		if (Length + Connection.Message.Num() > MaxMessageSize)
+		{
+			return false;
+		}
+
+		int32 FrameSize = Offset + 4 + static_cast<int32>(Length);
+
+		if (Size < FrameSize)
+		{
+			return true;
+		}
+
+		const uint8* Mask = Data + Offset;
+		TArray<uint8> Payload;
+		Payload.SetNumUninitialized(static_cast<int32>(Length));
+
+		for (int32 i = 0; i < Payload.Num(); i++)
+		{
+			Payload[i] = Data[Offset + 4 + i] ^ Mask[i & 3];
+		}
+
+		Connection.Received.RemoveAt(0, FrameSize, false);
+
+		switch (Opcode)
+		{
+		case WebSocketOpcode::Continuation:
+		case WebSocketOpcode::Text:
+		case WebSocketOpcode::Binary:
+			Connection.Message.Append(Payload);
+
+			if (bIsFinal)
+			{
+				FString Message = BytesToString(Connection.Message.GetData(), Connection.Message.Num());
+				Connection.Message.Reset();
+				MessageCount.Increment();
+
+				if (Connection.WebSocketRoute->WebSocket.Message)
+				{
+					Connection.WebSocketRoute->WebSocket.Message(Connection.Id, Message);
+				}
+			}
+			break;
+		case WebSocketOpcode::Close:
+			// Echoes the status, then closes once it is written
+			AppendFrame(Connection.Outgoing, WebSocketOpcode::Close, Payload.GetData(), FMath::Min(Payload.Num(), 2));
+			Connection.bIsClosing = true;
+			break;
+		case WebSocketOpcode::Ping:
+			AppendFrame(Connection.Outgoing, WebSocketOpcode::Pong, Payload.GetData(), Payload.Num());
+			break;
+		case WebSocketOpcode::Pong:
+			break;
+		default:
+			return false;
+		}
+	}
+
+	return true;
+}
+
+const FLocalHttpServer::FRoute* FLocalHttpServer::Match(FLocalHttpRequest& Request) const
+{
+	TArray<FString> Segments;
+	Request.Path.ParseIntoArray(Segments, TEXT("/"), true);
+	const FRoute* Matched = nullptr;
+	int32 MatchedLiterals = -1;
+
+	for (const FRoute& Candidate : Routes)
+	{
+		if (Candidate.Verb != Request.Verb || Candidate.Segments.Num() != Segments.Num())
+		{
+			continue;
+		}
+
+		int32 Literals = 0;
+		bool bIsMatch = true;
+
+		for (int32 i = 0; i < Segments.Num() && bIsMatch; i++)
+		{
+			if (Candidate.Segments[i].StartsWith(TEXT("{")))
+			{
+				continue;
+			}
+
+			bIsMatch = Candidate.Segments[i] == Segments[i];
+			Literals++;
+		}
+
+		if (bIsMatch && Literals > MatchedLiterals)
+		{
+			Matched = &Candidate;
+			MatchedLiterals = Literals;
+		}
+	}
+
+	if (Matched == nullptr)
+	{
+		return nullptr;
+	}
+
+	for (int32 i = 0; i < Segments.Num(); i++)
+	{
+		if (Matched->Segments[i].StartsWith(TEXT("{")))
+		{
+			Request.Params.Add(FGenericPlatformHttp::UrlDecode(Segments[i]));
+		}
+	}
+
+	return Matched;
+}
+
+void FLocalHttpServer::Dispatch(FLocalHttpRequest& Request, FLocalHttpResponse& Response)
+{
+	const FRoute* Matched = Match(Request);
+
+	if (Matched == nullptr || Matched->bIsWebSocket)
+	{
+		Response.SetError(404, 404, FString::Printf(TEXT("No route for %s %s"), *Request.Verb, *Request.Path));
+
+		return;
+	}
+
+	Matched->Handler(Request, Response);
+}
+
+FLocalHttpServer::FConnection* FLocalHttpServer::FindConnection(int32 ConnectionId)
+{
+	for (FConnection& Connection : Connections)
+	{
+		if (Connection.Id == ConnectionId)
+		{
+			return &Connection;
+		}
+	}
+
+	return nullptr;
+}
+
+void FLocalHttpServer::Close(FConnection& Connection)
+{
+	if (Connection.Socket != nullptr)
+	{
+		Connection.Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Connection.Socket);
+		Connection.Socket = nullptr;
+	}
+}
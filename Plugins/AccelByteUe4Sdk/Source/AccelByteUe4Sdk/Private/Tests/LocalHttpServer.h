@@ -0,0 +1,202 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Math/RandomStream.h"
+#include "AccelByteSimulatedHttpTransport.h"
+
+class FSocket;
+class FRunnableThread;
+
+/**
+ * @brief Request received by FLocalHttpServer, decoded from its Content-Encoding.
+ */
+struct FLocalHttpRequest
+{
+	FString Verb;
+	/** Path without the query, still URL encoded. */
+	FString Path;
+	/** Header names lower case. */
+	TMap<FString, FString> Headers;
+	/** Decoded values, in the order they were sent. */
+	TArray<TPair<FString, FString>> Query;
+	TArray<uint8> Body;
+	/** Decoded path segments matched by the {...} of the route, in order. */
+	TArray<FString> Params;
+
+	FString GetHeader(const FString& Name) const;
+	/** First value of a query parameter, empty when absent. */
+	FString GetQuery(const FString& Name) const;
+	TArray<FString> GetQueryValues(const FString& Name) const;
+	FString GetBodyAsString() const;
+	/** Decoded fields of an application/x-www-form-urlencoded body. */
+	TMap<FString, FString> GetForm() const;
+};
+
+struct FLocalHttpResponse
+{
+	int32 Code = 200;
+	FString ContentType = TEXT("application/json");
+	/** Sent besides Content-Type, Content-Length and Connection, e.g. Cache-Control and ETag. */
+	TMap<FString, FString> Headers;
+	TArray<uint8> Body;
+
+	void SetContent(int32 InCode, const FString& Content);
+	/** Body in the {"numericErrorCode","errorCode","errorMessage"} shape of the services. */
+	void SetError(int32 InCode, int32 ErrorCode, const FString& Message);
+};
+
+/**
+ * @brief HTTP/1.1 server on 127.0.0.1 for tests and benchmarks that must not depend on a deployment.
+ * One thread accepts, parses and answers every connection, so handlers run one at a time and need no locking among themselves.
+ * Answers wait for the latency drawn for them, a fraction of them is replaced by an error status or dropped with their connection.
+ * WebSocket routes upgrade their connection (RFC 6455, text and binary messages, no extensions); their frames are not delayed nor faulted.
+ */
+class FLocalHttpServer : public FRunnable
+{
+public:
+	struct FConfig
+	{
+		FLatencyDistribution Latency = FLatencyDistribution::Constant(0.0);
+		/** Probability of each status answered instead of the handler's, e.g. { 503, 0.1f }. */
+		TMap<int32, float> StatusRates;
+		/** Probability that the connection is closed instead of answering. */
+		float DropRate = 0.0f;
+		int32 Seed = 0;
+	};
+
+	typedef TFunction<void(const FLocalHttpRequest& Request, FLocalHttpResponse& Response)> FHandler;
+
+	/**
+	 * @brief Callbacks of a WebSocket route, called on the server thread with the id of the connection.
+	 */
+	struct FWebSocketHandler
+	{
+		/** False refuses the upgrade with a 401. Messages sent from here follow the handshake. */
+		TFunction<bool(int32 ConnectionId, const FLocalHttpRequest& Request)> Open;
+		TFunction<void(int32 ConnectionId, const FString& Message)> Message;
+		/** Called once the connection is gone, whichever side closed it, except on Shutdown. */
+		TFunction<void(int32 ConnectionId)> Close;
+	};
+
+	FLocalHttpServer();
+	virtual ~FLocalHttpServer();
+
+	/**
+	 * @brief Pattern is a path where each {...} segment matches any single segment, the route with the most literal segments wins.
+	 * Routes are added before Start.
+	 */
+	void Route(const FString& Verb, const FString& Pattern, const FHandler& Handler);
+	/** Upgrades the GET requests matching Pattern to WebSocket, added before Start. */
+	void RouteWebSocket(const FString& Pattern, const FWebSocketHandler& Handler);
+	/** Called with the current time on every iteration of the server thread, set before Start. */
+	void SetTick(const TFunction<void(double CurrentTime)>& Tick);
+
+	/**
+	 * @brief Listens on 127.0.0.1, on a free port when Port is 0.
+	 */
+	bool Start(int32 Port = 0);
+	/** Closes every connection and waits for the server thread. */
+	void Shutdown();
+
+	int32 GetPort() const;
+	/** http://127.0.0.1:port, without a trailing slash. */
+	FString GetUrl() const;
+
+	/** Takes effect for the requests received from now on; the seed is read by Start. */
+	void SetConfig(const FConfig& Config);
+	FConfig GetConfig() const;
+
+	int32 GetRequestCount() const;
+	/** Messages received on WebSocket connections. */
+	int32 GetMessageCount() const;
+
+	/** Runs Task on the server thread at its next iteration, from any thread. */
+	void Post(const TFunction<void()>& Task);
+
+	/**
+	 * @brief Queues a text message on a WebSocket connection, false when it is gone or closing.
+	 * These are called on the server thread, i.e. from handlers, the tick and posted tasks.
+	 */
+	bool SendText(int32 ConnectionId, const FString& Message);
+	/** Sends a close frame, the connection is closed once everything queued is written. */
+	void CloseWebSocket(int32 ConnectionId);
+
+	// FRunnable
+	uint32 Run() override;
+	void Stop() override;
+
+private:
+	struct FRoute
+	{
+		FString Verb;
+		TArray<FString> Segments;
+		FHandler Handler;
+		bool bIsWebSocket;
+		FWebSocketHandler WebSocket;
+	};
+
+	struct FPendingResponse
+	{
+		double DueTime;
+		/** Drops the connection instead of writing anything. */
+		bool bIsDropped;
+		bool bIsLast;
+		TArray<uint8> Data;
+	};
+
+	struct FConnection
+	{
+		int32 Id;
+		FSocket* Socket;
+		/** Set once upgraded, Received then holds frames instead of requests. */
+		const FRoute* WebSocketRoute = nullptr;
+		TArray<uint8> Received;
+		/** Payload of the fragmented message being received. */
+		TArray<uint8> Message;
+		/** Answers in request order, each waits for the ones before it. */
+		TArray<FPendingResponse> Pending;
+		TArray<uint8> Outgoing;
+		int32 OutgoingOffset = 0;
+		bool bIsClosing = false;
+	};
+
+	void Accept();
+	/** False when the connection is done and must be closed. */
+	bool Service(FConnection& Connection, double CurrentTime, bool& bOutHasProgressed);
+	/** Parses the complete requests received so far; false on a malformed request. */
+	bool ParseRequests(FConnection& Connection, double CurrentTime);
+	/** Answers the upgrade of a request to a WebSocket route, false when it isn't one. */
+	bool Upgrade(FConnection& Connection, FLocalHttpRequest& Request);
+	/** Handles the complete frames received so far; false on a protocol error. */
+	bool ParseFrames(FConnection& Connection);
+	/** The route matching the verb and path of Request, with its Params filled. */
+	const FRoute* Match(FLocalHttpRequest& Request) const;
+	void Dispatch(FLocalHttpRequest& Request, FLocalHttpResponse& Response);
+	FConnection* FindConnection(int32 ConnectionId);
+	void Close(FConnection& Connection);
+
+	TArray<FRoute> Routes;
+	FSocket* Listener;
+	FRunnableThread* Thread;
+	FThreadSafeBool bIsStopping;
+	int32 Port;
+	TArray<FConnection> Connections;
+	int32 LastConnectionId;
+	TFunction<void(double)> Tick;
+
+	FCriticalSection TaskMutex;
+	TArray<TFunction<void()>> Tasks;
+
+	mutable FCriticalSection ConfigMutex;
+	FConfig Config;
+	FRandomStream Random;
+	FThreadSafeCounter RequestCount;
+	FThreadSafeCounter MessageCount;
+};
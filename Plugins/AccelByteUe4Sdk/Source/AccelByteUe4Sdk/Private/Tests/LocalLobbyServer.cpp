@@ -0,0 +1,804 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "LocalLobbyServer.h"
+
+using namespace AccelByte;
+
+namespace
+{
+	/** Any code but 0 is a failure for the SDK, these only tell the cases apart in logs. */
+	namespace LobbyCode
+	{
+		const TCHAR* const Success = TEXT("0");
+		const TCHAR* const BadRequest = TEXT("11000");
+		const TCHAR* const NotInParty = TEXT("11100");
+		const TCHAR* const AlreadyInParty = TEXT("11101");
+		const TCHAR* const NotLeader = TEXT("11102");
+		const TCHAR* const NotInvited = TEXT("11103");
+		const TCHAR* const NoFriendship = TEXT("11200");
+		const TCHAR* const NoMatchmaking = TEXT("11300");
+	}
+
+	/**
+	 * @brief Message in the wire format of the lobby: one "key: value" line per field after the type,
+	 * arrays written [a,b,] as Lobby::LobbyMessageToJson expects them.
+	 */
+	class FLobbyMessage
+	{
+	public:
+		explicit FLobbyMessage(const FString& Type, const FString& Id = FString())
+			: Text(TEXT("type: ") + Type)
+		{
+			if (!Id.IsEmpty())
+			{
+				Add(TEXT("id"), Id);
+			}
+		}
+
+		FLobbyMessage& Add(const TCHAR* Key, const FString& Value)
+		{
+			Text += FString::Printf(TEXT("\n%s: %s"), Key, *Value);
+
+			return *this;
+		}
+
+		FLobbyMessage& Add(const TCHAR* Key, const TArray<FString>& Values)
+		{
+			Text += FString::Printf(TEXT("\n%s: ["), Key);
+
+			for (const FString& Value : Values)
+			{
+				Text += Value + TEXT(",");
+			}
+
+			Text += TEXT("]");
+
+			return *this;
+		}
+
+		const FString& ToString() const
+		{
+			return Text;
+		}
+
+	private:
+		FString Text;
+	};
+
+	FString GetNow()
+	{
+		return FDateTime::UtcNow().ToIso8601();
+	}
+
+	/** partyInfoRequest answers with partyInfoResponse. */
+	FString GetResponseType(const FString& RequestType)
+	{
+		return RequestType.LeftChop(FCString::Strlen(TEXT("Request"))) + TEXT("Response");
+	}
+
+	FString GetField(const TMap<FString, FString>& Fields, const TCHAR* Key)
+	{
+		const FString* Value = Fields.Find(Key);
+
+		return Value != nullptr ? *Value : FString();
+	}
+}
+
+FLocalLobbyServer::FLocalLobbyServer(FLocalHttpServer& InServer, const FUserResolver& InResolveUser, const FConfig& InConfig)
+	: Server(InServer)
+	, ResolveUser(InResolveUser)
+	, Config(InConfig)
+	, LastId(0)
+{
+	FLocalHttpServer::FWebSocketHandler Handler;
+	Handler.Open = [this](int32 ConnectionId, const FLocalHttpRequest& Request) { return Open(ConnectionId, Request); };
+	Handler.Message = [this](int32 ConnectionId, const FString& Message) { Receive(ConnectionId, Message); };
+	Handler.Close = [this](int32 ConnectionId) { Close(ConnectionId); };
+	Server.RouteWebSocket(Config.Path, Handler);
+	Server.SetTick([this](double CurrentTime) { Tick(CurrentTime); });
+}
+
+FLocalLobbyServer::~FLocalLobbyServer()
+{
+	Server.Shutdown();
+}
+
+FString FLocalLobbyServer::GetUrl() const
+{
+	return FString::Printf(TEXT("ws://127.0.0.1:%d%s"), Server.GetPort(), *Config.Path);
+}
+
+void FLocalLobbyServer::ApplyTo(Settings& Target) const
+{
+	Target.LobbyServerUrl = GetUrl();
+}
+
+void FLocalLobbyServer::Push(const FString& UserId, const FString& Message)
+{
+	Server.Post([this, UserId, Message]()
+	{
+		Send(UserId, Message);
+	});
+}
+
+void FLocalLobbyServer::PushNotifications(const FString& UserId, int32 Count, double Rate, const FString& Topic)
+{
+	Server.Post([this, UserId, Count, Rate, Topic]()
+	{
+		Storms.Add(FStorm{ UserId, Topic, Count, 0, Rate, FPlatformTime::Seconds() });
+	});
+}
+
+int32 FLocalLobbyServer::GetConnectionCount() const
+{
+	return ConnectionCount.GetValue();
+}
+
+int32 FLocalLobbyServer::GetNotificationCount() const
+{
+	return NotificationCount.GetValue();
+}
+
+bool FLocalLobbyServer::Open(int32 ConnectionId, const FLocalHttpRequest& Request)
+{
+	FString Authorization = Request.GetHeader(TEXT("Authorization"));
+
+	if (!Authorization.StartsWith(TEXT("Bearer ")))
+	{
+		return false;
+	}
+
+	FString AccessToken = Authorization.Mid(7);
+	FString UserId = ResolveUser ? ResolveUser(AccessToken) : AccessToken;
+
+	if (UserId.IsEmpty())
+	{
+		return false;
+	}
+
+	Sessions.Add(ConnectionId, UserId);
+	Connections.Add(UserId, ConnectionId);
+	ConnectionCount.Increment();
+
+	FPresence& Presence = Presences.FindOrAdd(UserId);
+	Presence.Availability = TEXT("1");
+	Presence.LastSeenAt = GetNow();
+	Send(UserId, FLobbyMessage(TEXT("connectNotif")).Add(TEXT("lobbySessionID"), NewId()).ToString());
+
+	return true;
+}
+
+void FLocalLobbyServer::Receive(int32 ConnectionId, const FString& Message)
+{
+	const FString* Session = Sessions.Find(ConnectionId);
+
+	// Empty messages are the pings of the SDK
+	if (Session == nullptr || Message.IsEmpty())
+	{
+		return;
+	}
+
+	FString UserId = *Session;
+	FFields Fields;
+	TArray<FString> Lines;
+	Message.ParseIntoArray(Lines, TEXT("\n"), true);
+
+	for (const FString& Line : Lines)
+	{
+		FString Key;
+		FString Value;
+
+		if (Line.Split(TEXT(":"), &Key, &Value))
+		{
+			Fields.Add(Key.TrimStartAndEnd(), Value.TrimStartAndEnd());
+		}
+	}
+
+	FString Type = GetField(Fields, TEXT("type"));
+	FString Id = GetField(Fields, TEXT("id"));
+
+	if (Type == TEXT("offlineNotificationRequest"))
+	{
+		TArray<FString> Stored;
+
+		if (OfflineNotifications.RemoveAndCopyValue(UserId, Stored))
+		{
+			for (const FString& Notification : Stored)
+			{
+				Send(UserId, Notification);
+				NotificationCount.Increment();
+			}
+		}
+
+		return;
+	}
+
+	if (!HandleParty(UserId, Type, Id, Fields)
+		&& !HandleChat(UserId, Type, Id, Fields)
+		&& !HandlePresence(UserId, Type, Id, Fields)
+		&& !HandleFriends(UserId, Type, Id, Fields)
+		&& !HandleMatchmaking(UserId, Type, Id, Fields)
+		&& Type.EndsWith(TEXT("Request")))
+	{
+		Send(UserId, FLobbyMessage(GetResponseType(Type), Id).Add(TEXT("code"), LobbyCode::BadRequest).ToString());
+	}
+}
+
+void FLocalLobbyServer::Close(int32 ConnectionId)
+{
+	FString UserId;
+
+	if (!Sessions.RemoveAndCopyValue(ConnectionId, UserId))
+	{
+		return;
+	}
+
+	ConnectionCount.Decrement();
+
+	// A newer connection of the same user stays
+	if (Connections.FindRef(UserId) != ConnectionId)
+	{
+		return;
+	}
+
+	Connections.Remove(UserId);
+	Matchmakings.RemoveAll([&UserId](const FMatchmaking& Matchmaking) { return Matchmaking.UserId == UserId; });
+	LeaveParty(UserId);
+
+	FPresence& Presence = Presences.FindOrAdd(UserId);
+	Presence.Availability = TEXT("0");
+	Presence.LastSeenAt = GetNow();
+	SendToFriends(UserId, FLobbyMessage(TEXT("userStatusNotif"))
+		.Add(TEXT("userID"), UserId)
+		.Add(TEXT("availability"), Presence.Availability)
+		.Add(TEXT("activity"), Presence.Activity)
+		.ToString());
+}
+
+void FLocalLobbyServer::Tick(double CurrentTime)
+{
+	for (int32 i = 0; i < Matchmakings.Num(); i++)
+	{
+		if (Matchmakings[i].DueTime > CurrentTime)
+		{
+			continue;
+		}
+
+		FMatchmaking Due = Matchmakings[i];
+		Matchmakings.RemoveAt(i--);
+		FString MatchId = NewId();
+		int32 CounterIndex = Matchmakings.IndexOfByPredicate([&Due](const FMatchmaking& Other) { return Other.GameMode == Due.GameMode; });
+
+		// Queued in the same game mode makes an opponent, otherwise the match is played alone
+		if (CounterIndex == INDEX_NONE)
+		{
+			CompleteMatchmaking(Due, TArray<FString>(), MatchId);
+
+			continue;
+		}
+
+		FMatchmaking Counter = Matchmakings[CounterIndex];
+		Matchmakings.RemoveAt(CounterIndex);
+		i = FMath::Min(i, CounterIndex - 1);
+		CompleteMatchmaking(Due, GetTeam(Counter.UserId), MatchId);
+		CompleteMatchmaking(Counter, GetTeam(Due.UserId), MatchId);
+	}
+
+	for (int32 i = Storms.Num() - 1; i >= 0; --i)
+	{
+		FStorm& Storm = Storms[i];
+		int32 Due = Storm.Rate > 0.0 ? FMath::Min(Storm.Count, FMath::FloorToInt((CurrentTime - Storm.StartTime) * Storm.Rate) + 1) : Storm.Count;
+
+		for (; Storm.Sent < Due; Storm.Sent++)
+		{
+			Notify(Storm.UserId, Storm.Topic, FString::FromInt(Storm.Sent));
+		}
+
+		if (Storm.Sent == Storm.Count)
+		{
+			Storms.RemoveAtSwap(i);
+		}
+	}
+}
+
+bool FLocalLobbyServer::HandleParty(const FString& UserId, const FString& Type, const FString& Id, const FFields& Fields)
+{
+	auto AddParty = [](FLobbyMessage& Message, const FParty& Party) -> FLobbyMessage&
+	{
+		return Message
+			.Add(TEXT("partyID"), Party.Id)
+			.Add(TEXT("leaderID"), Party.LeaderId)
+			.Add(TEXT("members"), Party.Members)
+			.Add(TEXT("invitees"), Party.Invitees)
+			.Add(TEXT("invitationToken"), Party.InvitationToken);
+	};
+
+	FLobbyMessage Response(GetResponseType(Type), Id);
+	FParty* Party = FindParty(UserId);
+
+	if (Type == TEXT("partyInfoRequest"))
+	{
+		if (Party == nullptr)
+		{
+			Response.Add(TEXT("code"), LobbyCode::NotInParty);
+		}
+		else
+		{
+			AddParty(Response.Add(TEXT("code"), LobbyCode::Success), *Party);
+		}
+	}
+	else if (Type == TEXT("partyCreateRequest"))
+	{
+		if (Party != nullptr)
+		{
+			Response.Add(TEXT("code"), LobbyCode::AlreadyInParty);
+		}
+		else
+		{
+			FString PartyId = NewId();
+			FParty& Created = Parties.Add(PartyId, FParty{ PartyId, UserId, { UserId }, {}, NewId() });
+			Memberships.Add(UserId, PartyId);
+			AddParty(Response.Add(TEXT("code"), LobbyCode::Success), Created);
+		}
+	}
+	else if (Type == TEXT("partyLeaveRequest"))
+	{
+		Response.Add(TEXT("code"), Party != nullptr ? LobbyCode::Success : LobbyCode::NotInParty);
+		LeaveParty(UserId);
+	}
+	else if (Type == TEXT("partyInviteRequest"))
+	{
+		FString InviteeId = GetField(Fields, TEXT("friendID"));
+
+		if (Party == nullptr)
+		{
+			Response.Add(TEXT("code"), LobbyCode::NotInParty);
+		}
+		else if (InviteeId.IsEmpty() || Party->Members.Contains(InviteeId))
+		{
+			Response.Add(TEXT("code"), LobbyCode::BadRequest);
+		}
+		else
+		{
+			Party->Invitees.AddUnique(InviteeId);
+			Response.Add(TEXT("code"), LobbyCode::Success);
+			Send(InviteeId, FLobbyMessage(TEXT("partyGetInvitedNotif"))
+				.Add(TEXT("from"), UserId)
+				.Add(TEXT("partyID"), Party->Id)
+				.Add(TEXT("invitationToken"), Party->InvitationToken)
+				.ToString());
+			SendToParty(*Party, FLobbyMessage(TEXT("partyInviteNotif"))
+				.Add(TEXT("inviterID"), UserId)
+				.Add(TEXT("inviteeID"), InviteeId)
+				.ToString());
+		}
+	}
+	else if (Type == TEXT("partyJoinRequest"))
+	{
+		FParty* Joined = Parties.Find(GetField(Fields, TEXT("partyID")));
+
+		if (Joined == nullptr || Joined->InvitationToken != GetField(Fields, TEXT("invitationToken")) || !Joined->Invitees.Contains(UserId))
+		{
+			Response.Add(TEXT("code"), LobbyCode::NotInvited);
+		}
+		else
+		{
+			// Joining moves the user out of its current party
+			if (Party != nullptr && Party != Joined)
+			{
+				FString JoinedId = Joined->Id;
+				LeaveParty(UserId);
+				Joined = Parties.Find(JoinedId);
+			}
+
+			SendToParty(*Joined, FLobbyMessage(TEXT("partyJoinNotif")).Add(TEXT("userID"), UserId).ToString());
+			Joined->Invitees.Remove(UserId);
+			Joined->Members.AddUnique(UserId);
+			Memberships.Add(UserId, Joined->Id);
+			AddParty(Response.Add(TEXT("code"), LobbyCode::Success), *Joined);
+		}
+	}
+	else if (Type == TEXT("partyKickRequest"))
+	{
+		FString MemberId = GetField(Fields, TEXT("memberID"));
+
+		if (Party == nullptr)
+		{
+			Response.Add(TEXT("code"), LobbyCode::NotInParty);
+		}
+		else if (Party->LeaderId != UserId || MemberId == UserId || !Party->Members.Contains(MemberId))
+		{
+			Response.Add(TEXT("code"), LobbyCode::NotLeader);
+		}
+		else
+		{
+			// The kicked member is told as well as those who stay
+			SendToParty(*Party, FLobbyMessage(TEXT("partyKickNotif"))
+				.Add(TEXT("leaderID"), UserId)
+				.Add(TEXT("userID"), MemberId)
+				.Add(TEXT("partyID"), Party->Id)
+				.ToString(), UserId);
+			Party->Members.Remove(MemberId);
+			Memberships.Remove(MemberId);
+			Response.Add(TEXT("code"), LobbyCode::Success);
+		}
+	}
+	else
+	{
+		return false;
+	}
+
+	Send(UserId, Response.ToString());
+
+	return true;
+}
+
+bool FLocalLobbyServer::HandleChat(const FString& UserId, const FString& Type, const FString& Id, const FFields& Fields)
+{
+	FLobbyMessage Response(GetResponseType(Type), Id);
+	FString Payload = GetField(Fields, TEXT("payload"));
+
+	if (Type == TEXT("personalChatRequest"))
+	{
+		FString ReceiverId = GetField(Fields, TEXT("to"));
+
+		if (ReceiverId.IsEmpty())
+		{
+			Response.Add(TEXT("code"), LobbyCode::BadRequest);
+		}
+		else
+		{
+			Response.Add(TEXT("code"), LobbyCode::Success);
+			Send(ReceiverId, FLobbyMessage(TEXT("personalChatNotif"))
+				.Add(TEXT("id"), NewId())
+				.Add(TEXT("from"), UserId)
+				.Add(TEXT("to"), ReceiverId)
+				.Add(TEXT("payload"), Payload)
+				.Add(TEXT("receivedAt"), GetNow())
+				.ToString());
+		}
+	}
+	else if (Type == TEXT("partyChatRequest"))
+	{
+		const FParty* Party = FindParty(UserId);
+
+		if (Party == nullptr)
+		{
+			Response.Add(TEXT("code"), LobbyCode::NotInParty);
+		}
+		else
+		{
+			Response.Add(TEXT("code"), LobbyCode::Success);
+			SendToParty(*Party, FLobbyMessage(TEXT("partyChatNotif"))
+				.Add(TEXT("id"), NewId())
+				.Add(TEXT("from"), UserId)
+				.Add(TEXT("to"), Party->Id)
+				.Add(TEXT("payload"), Payload)
+				.Add(TEXT("receivedAt"), GetNow())
+				.ToString(), UserId);
+		}
+	}
+	else
+	{
+		return false;
+	}
+
+	Send(UserId, Response.ToString());
+
+	return true;
+}
+
+bool FLocalLobbyServer::HandlePresence(const FString& UserId, const FString& Type, const FString& Id, const FFields& Fields)
+{
+	FLobbyMessage Response(GetResponseType(Type), Id);
+
+	if (Type == TEXT("setUserStatusRequest"))
+	{
+		FPresence& Presence = Presences.FindOrAdd(UserId);
+		Presence.Availability = GetField(Fields, TEXT("availability"));
+		Presence.Activity = GetField(Fields, TEXT("activity"));
+		Presence.LastSeenAt = GetNow();
+		Response.Add(TEXT("code"), LobbyCode::Success);
+		SendToFriends(UserId, FLobbyMessage(TEXT("userStatusNotif"))
+			.Add(TEXT("userID"), UserId)
+			.Add(TEXT("availability"), Presence.Availability)
+			.Add(TEXT("activity"), Presence.Activity)
+			.ToString());
+	}
+	else if (Type == TEXT("friendsStatusRequest"))
+	{
+		TArray<FString> FriendIds = Friends.FindRef(UserId).Array();
+		TArray<FString> Availabilities;
+		TArray<FString> Activities;
+		TArray<FString> LastSeenAts;
+
+		for (const FString& FriendId : FriendIds)
+		{
+			FPresence Presence = Presences.FindRef(FriendId);
+			Availabilities.Add(Presence.Availability);
+			Activities.Add(Presence.Activity);
+			LastSeenAts.Add(Presence.LastSeenAt);
+		}
+
+		Response
+			.Add(TEXT("code"), LobbyCode::Success)
+			.Add(TEXT("friendsId"), FriendIds)
+			.Add(TEXT("availability"), Availabilities)
+			.Add(TEXT("activity"), Activities)
+			.Add(TEXT("lastSeenAt"), LastSeenAts);
+	}
+	else
+	{
+		return false;
+	}
+
+	Send(UserId, Response.ToString());
+
+	return true;
+}
+
+bool FLocalLobbyServer::HandleFriends(const FString& UserId, const FString& Type, const FString& Id, const FFields& Fields)
+{
+	FLobbyMessage Response(GetResponseType(Type), Id);
+	FString FriendId = GetField(Fields, TEXT("friendId"));
+	// Copies, the maps may grow while handling
+	TSet<FString> UserFriends = Friends.FindRef(UserId);
+	TSet<FString> Outgoing = FriendRequests.FindRef(UserId);
+	auto IsIncoming = [this, &UserId](const FString& RequesterId)
+	{
+		const TSet<FString>* Requested = FriendRequests.Find(RequesterId);
+
+		return Requested != nullptr && Requested->Contains(UserId);
+	};
+
+	if (Type == TEXT("requestFriendsRequest"))
+	{
+		if (FriendId.IsEmpty() || FriendId == UserId || UserFriends.Contains(FriendId))
+		{
+			Response.Add(TEXT("code"), LobbyCode::BadRequest);
+		}
+		else
+		{
+			FriendRequests.FindOrAdd(UserId).Add(FriendId);
+			Response.Add(TEXT("code"), LobbyCode::Success);
+			Send(FriendId, FLobbyMessage(TEXT("requestFriendsNotif")).Add(TEXT("friendId"), UserId).ToString());
+		}
+	}
+	else if (Type == TEXT("unfriendRequest"))
+	{
+		bool bIsRemoved = UserFriends.Contains(FriendId);
+		Friends.FindOrAdd(UserId).Remove(FriendId);
+		Friends.FindOrAdd(FriendId).Remove(UserId);
+		Response.Add(TEXT("code"), bIsRemoved ? LobbyCode::Success : LobbyCode::NoFriendship);
+	}
+	else if (Type == TEXT("listOutgoingFriendsRequest"))
+	{
+		Response.Add(TEXT("code"), LobbyCode::Success).Add(TEXT("friendsId"), Outgoing.Array());
+	}
+	else if (Type == TEXT("cancelFriendsRequest"))
+	{
+		Response.Add(TEXT("code"), Outgoing.Contains(FriendId) ? LobbyCode::Success : LobbyCode::NoFriendship);
+		FriendRequests.FindOrAdd(UserId).Remove(FriendId);
+	}
+	else if (Type == TEXT("listIncomingFriendsRequest"))
+	{
+		TArray<FString> Incoming;
+
+		for (const TPair<FString, TSet<FString>>& Requests : FriendRequests)
+		{
+			if (Requests.Value.Contains(UserId))
+			{
+				Incoming.Add(Requests.Key);
+			}
+		}
+
+		Response.Add(TEXT("code"), LobbyCode::Success).Add(TEXT("friendsId"), Incoming);
+	}
+	else if (Type == TEXT("acceptFriendsRequest") || Type == TEXT("rejectFriendsRequest"))
+	{
+		if (!IsIncoming(FriendId))
+		{
+			Response.Add(TEXT("code"), LobbyCode::NoFriendship);
+		}
+		else
+		{
+			FriendRequests.FindOrAdd(FriendId).Remove(UserId);
+			Response.Add(TEXT("code"), LobbyCode::Success);
+
+			if (Type == TEXT("acceptFriendsRequest"))
+			{
+				FriendRequests.FindOrAdd(UserId).Remove(FriendId);
+				Friends.FindOrAdd(UserId).Add(FriendId);
+				Friends.FindOrAdd(FriendId).Add(UserId);
+				Send(FriendId, FLobbyMessage(TEXT("acceptFriendsNotif")).Add(TEXT("friendId"), UserId).ToString());
+			}
+		}
+	}
+	else if (Type == TEXT("listOfFriendsRequest"))
+	{
+		Response.Add(TEXT("code"), LobbyCode::Success).Add(TEXT("friendsId"), UserFriends.Array());
+	}
+	else if (Type == TEXT("getFriendshipStatusRequest"))
+	{
+		// The values of ERelationshipStatusCode, sent as a string
+		int32 Status = UserFriends.Contains(FriendId) ? 3 : IsIncoming(FriendId) ? 2 : Outgoing.Contains(FriendId) ? 1 : 0;
+		Response.Add(TEXT("code"), LobbyCode::Success).Add(TEXT("friendshipStatus"), FString::FromInt(Status));
+	}
+	else
+	{
+		return false;
+	}
+
+	Send(UserId, Response.ToString());
+
+	return true;
+}
+
+bool FLocalLobbyServer::HandleMatchmaking(const FString& UserId, const FString& Type, const FString& Id, const FFields& Fields)
+{
+	FLobbyMessage Response(GetResponseType(Type), Id);
+	FString GameMode = GetField(Fields, TEXT("gameMode"));
+	const FParty* Party = FindParty(UserId);
+	int32 Queued = Matchmakings.IndexOfByPredicate([&UserId](const FMatchmaking& Matchmaking) { return Matchmaking.UserId == UserId; });
+
+	if (Type == TEXT("startMatchmakingRequest"))
+	{
+		if (GameMode.IsEmpty() || Queued != INDEX_NONE)
+		{
+			Response.Add(TEXT("code"), LobbyCode::BadRequest);
+		}
+		else if (Party != nullptr && Party->LeaderId != UserId)
+		{
+			Response.Add(TEXT("code"), LobbyCode::NotLeader);
+		}
+		else
+		{
+			Matchmakings.Add(FMatchmaking{ UserId, GameMode, FPlatformTime::Seconds() + Config.MatchmakingDelay });
+			Response.Add(TEXT("code"), LobbyCode::Success);
+		}
+	}
+	else if (Type == TEXT("cancelMatchmakingRequest"))
+	{
+		if (Queued == INDEX_NONE)
+		{
+			Response.Add(TEXT("code"), LobbyCode::NoMatchmaking);
+		}
+		else
+		{
+			Matchmakings.RemoveAt(Queued);
+			Response.Add(TEXT("code"), LobbyCode::Success);
+
+			for (const FString& MemberId : GetTeam(UserId))
+			{
+				Send(MemberId, FLobbyMessage(TEXT("matchmakingNotif"))
+					.Add(TEXT("code"), LobbyCode::Success)
+					.Add(TEXT("status"), TEXT("cancel"))
+					.ToString());
+			}
+		}
+	}
+	else
+	{
+		return false;
+	}
+
+	Send(UserId, Response.ToString());
+
+	return true;
+}
+
+bool FLocalLobbyServer::Send(const FString& UserId, const FString& Message)
+{
+	const int32* ConnectionId = Connections.Find(UserId);
+
+	return ConnectionId != nullptr && Server.SendText(*ConnectionId, Message);
+}
+
+void FLocalLobbyServer::Notify(const FString& UserId, const FString& Topic, const FString& Payload)
+{
+	FString Message = FLobbyMessage(TEXT("messageNotif"))
+		.Add(TEXT("id"), NewId())
+		.Add(TEXT("from"), TEXT("local-lobby"))
+		.Add(TEXT("to"), UserId)
+		.Add(TEXT("topic"), Topic)
+		.Add(TEXT("payload"), Payload)
+		.Add(TEXT("sentAt"), GetNow())
+		.ToString();
+
+	if (Send(UserId, Message))
+	{
+		NotificationCount.Increment();
+	}
+	else
+	{
+		OfflineNotifications.FindOrAdd(UserId).Add(Message);
+	}
+}
+
+void FLocalLobbyServer::SendToParty(const FParty& Party, const FString& Message, const FString& ExcludedUserId)
+{
+	for (const FString& MemberId : Party.Members)
+	{
+		if (MemberId != ExcludedUserId)
+		{
+			Send(MemberId, Message);
+		}
+	}
+}
+
+void FLocalLobbyServer::SendToFriends(const FString& UserId, const FString& Message)
+{
+	for (const FString& FriendId : Friends.FindRef(UserId))
+	{
+		Send(FriendId, Message);
+	}
+}
+
+FLocalLobbyServer::FParty* FLocalLobbyServer::FindParty(const FString& UserId)
+{
+	const FString* PartyId = Memberships.Find(UserId);
+
+	return PartyId != nullptr ? Parties.Find(*PartyId) : nullptr;
+}
+
+void FLocalLobbyServer::LeaveParty(const FString& UserId)
+{
+	FParty* Party = FindParty(UserId);
+
+	if (Party == nullptr)
+	{
+		return;
+	}
+
+	Memberships.Remove(UserId);
+	Party->Members.Remove(UserId);
+
+	if (Party->Members.Num() == 0)
+	{
+		Parties.Remove(Party->Id);
+
+		return;
+	}
+
+	// The next member to have joined leads
+	if (Party->LeaderId == UserId)
+	{
+		Party->LeaderId = Party->Members[0];
+	}
+
+	SendToParty(*Party, FLobbyMessage(TEXT("partyLeaveNotif"))
+		.Add(TEXT("userID"), UserId)
+		.Add(TEXT("leaderID"), Party->LeaderId)
+		.ToString());
+}
+
+TArray<FString> FLocalLobbyServer::GetTeam(const FString& UserId)
+{
+	const FParty* Party = FindParty(UserId);
+
+	return Party != nullptr ? Party->Members : TArray<FString>{ UserId };
+}
+
+void FLocalLobbyServer::CompleteMatchmaking(const FMatchmaking& Matchmaking, const TArray<FString>& CounterParty, const FString& MatchId)
+{
+	TArray<FString> Team = GetTeam(Matchmaking.UserId);
+	FString Message = FLobbyMessage(TEXT("matchmakingNotif"))
+		.Add(TEXT("code"), LobbyCode::Success)
+		.Add(TEXT("status"), TEXT("done"))
+		.Add(TEXT("matchId"), MatchId)
+		.Add(TEXT("partyMember"), Team)
+		.Add(TEXT("counterPartyMember"), CounterParty)
+		.ToString();
+
+	for (const FString& MemberId : Team)
+	{
+		Send(MemberId, Message);
+	}
+}
+
+FString FLocalLobbyServer::NewId()
+{
+	return FString::Printf(TEXT("%08x%s"), ++LastId, *FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(24).ToLower());
+}
@@ -0,0 +1,143 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "LocalHttpServer.h"
+#include "AccelByteSettings.h"
+
+/**
+ * @brief Stand-in for the Lobby service, a WebSocket route of a FLocalHttpServer speaking the "type: ...\nid: ..." format of Api::Lobby.
+ * Answers the party, chat, presence, friends, matchmaking and offline notification requests of the SDK and sends their notifications to the other users.
+ * Notifications can also be pushed from the test, as storms paced at a rate, to load the parsing and dispatch of the client.
+ * State is only touched from the server thread; the Push functions post to it and can be called from any thread.
+ */
+class FLocalLobbyServer
+{
+public:
+	/** The user id of an access token, empty to refuse the connection. */
+	typedef TFunction<FString(const FString& AccessToken)> FUserResolver;
+
+	struct FConfig
+	{
+		FString Path = TEXT("/lobby/");
+		/** Seconds between a matchmaking start and its done notification. */
+		double MatchmakingDelay = 0.1;
+	};
+
+	/**
+	 * @brief Routes the lobby on Server, before it is started. Without ResolveUser the access token is taken as the user id,
+	 * so a load test connects as many users as it wants without logging them in.
+	 */
+	explicit FLocalLobbyServer(FLocalHttpServer& Server, const FUserResolver& ResolveUser = FUserResolver(), const FConfig& Config = FConfig());
+	/** Shuts the server down, its thread calls into this. */
+	~FLocalLobbyServer();
+
+	/** ws://127.0.0.1:port/lobby/ */
+	FString GetUrl() const;
+	/**
+	 * @brief Points the LobbyServerUrl of Settings at this lobby.
+	 */
+	void ApplyTo(AccelByte::Settings& Settings) const;
+
+	/** Sends a raw message to the user when connected. */
+	void Push(const FString& UserId, const FString& Message);
+	/**
+	 * @brief Sends Count messageNotif to the user, Rate per second or all at once when 0, with their index as payload.
+	 * Those due while the user is offline are kept for its next offlineNotificationRequest.
+	 */
+	void PushNotifications(const FString& UserId, int32 Count, double Rate = 0.0, const FString& Topic = TEXT("storm"));
+
+	int32 GetConnectionCount() const;
+	/** Notifications sent to connected users, pushed ones included. */
+	int32 GetNotificationCount() const;
+
+private:
+	struct FPresence
+	{
+		FString Availability = TEXT("0");
+		FString Activity;
+		FString LastSeenAt;
+	};
+
+	struct FParty
+	{
+		FString Id;
+		FString LeaderId;
+		TArray<FString> Members;
+		TArray<FString> Invitees;
+		FString InvitationToken;
+	};
+
+	struct FMatchmaking
+	{
+		/** Who started it, the leader of its party if any. */
+		FString UserId;
+		FString GameMode;
+		double DueTime;
+	};
+
+	struct FStorm
+	{
+		FString UserId;
+		FString Topic;
+		int32 Count;
+		int32 Sent;
+		double Rate;
+		double StartTime;
+	};
+
+	typedef TMap<FString, FString> FFields;
+
+	bool Open(int32 ConnectionId, const FLocalHttpRequest& Request);
+	void Receive(int32 ConnectionId, const FString& Message);
+	void Close(int32 ConnectionId);
+	void Tick(double CurrentTime);
+
+	/** Each returns false when the type isn't one of its group. */
+	bool HandleParty(const FString& UserId, const FString& Type, const FString& Id, const FFields& Fields);
+	bool HandleChat(const FString& UserId, const FString& Type, const FString& Id, const FFields& Fields);
+	bool HandlePresence(const FString& UserId, const FString& Type, const FString& Id, const FFields& Fields);
+	bool HandleFriends(const FString& UserId, const FString& Type, const FString& Id, const FFields& Fields);
+	bool HandleMatchmaking(const FString& UserId, const FString& Type, const FString& Id, const FFields& Fields);
+
+	/** False when the user isn't connected. */
+	bool Send(const FString& UserId, const FString& Message);
+	/** Sends a messageNotif, or keeps it until the next offlineNotificationRequest of the user. */
+	void Notify(const FString& UserId, const FString& Topic, const FString& Payload);
+	/** Sends to every member but the one excluded. */
+	void SendToParty(const FParty& Party, const FString& Message, const FString& ExcludedUserId = FString());
+	void SendToFriends(const FString& UserId, const FString& Message);
+	FParty* FindParty(const FString& UserId);
+	void LeaveParty(const FString& UserId);
+	/** The members of the user's party, or the user alone. */
+	TArray<FString> GetTeam(const FString& UserId);
+	void CompleteMatchmaking(const FMatchmaking& Matchmaking, const TArray<FString>& CounterParty, const FString& MatchId);
+	FString NewId();
+
+	FLocalHttpServer& Server;
+	FUserResolver ResolveUser;
+	FConfig Config;
+	int32 LastId;
+
+	/** Connection id to user id. */
+	TMap<int32, FString> Sessions;
+	/** User id to its latest connection. */
+	TMap<FString, int32> Connections;
+	TMap<FString, FPresence> Presences;
+	TMap<FString, FParty> Parties;
+	/** User id to party id. */
+	TMap<FString, FString> Memberships;
+	TMap<FString, TSet<FString>> Friends;
+	/** Requester to the users it asked. */
+	TMap<FString, TSet<FString>> FriendRequests;
+	TArray<FMatchmaking> Matchmakings;
+	TArray<FStorm> Storms;
+	TMap<FString, TArray<FString>> OfflineNotifications;
+
+	FThreadSafeCounter ConnectionCount;
+	FThreadSafeCounter NotificationCount;
+};
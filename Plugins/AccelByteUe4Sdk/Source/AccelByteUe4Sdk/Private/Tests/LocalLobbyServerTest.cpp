@@ -0,0 +1,190 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AutomationTest.h"
+#include "Containers/Ticker.h"
+#include "AccelByteRegistry.h"
+#include "AccelByteLobbyApi.h"
+#include "AccelByteCredentials.h"
+#include "LocalLobbyServer.h"
+
+using AccelByte::Settings;
+using AccelByte::Credentials;
+using AccelByte::FRegistry;
+using AccelByte::Api::Lobby;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteLocalLobbyTest, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteLocalLobbyTest);
+
+static const int32 AutomationFlagMaskLocalLobby = (EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ClientContext);
+
+/** Ticks the WebSockets until Condition holds, false on timeout. */
+static bool WaitUntil(const TFunction<bool()>& Condition, double Timeout = 10.0)
+{
+	double Deadline = FPlatformTime::Seconds() + Timeout;
+
+	while (!Condition())
+	{
+		if (FPlatformTime::Seconds() > Deadline)
+		{
+			return false;
+		}
+
+		FTicker::GetCoreTicker().Tick(0.01f);
+		FPlatformProcess::Sleep(0.01f);
+	}
+
+	return true;
+}
+
+/** The local lobby takes the access token as the user id. */
+static void SetLocalUser(Credentials& Target, const FString& UserId)
+{
+	Target.SetUserToken(UserId, FString(), FPlatformTime::Seconds() + 3600.0, UserId, UserId, FRegistry::Settings.Namespace);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(LocalLobbyPartyChatFriendsMatchmaking, "AccelByte.Tests.LocalLobby.PartyChatFriendsMatchmaking_RunWithoutDeployment", AutomationFlagMaskLocalLobby);
+bool LocalLobbyPartyChatFriendsMatchmaking::RunTest(const FString& Parameters)
+{
+	FLocalHttpServer Server;
+	FLocalLobbyServer LocalLobby(Server);
+	check(Server.Start());
+
+	Settings LobbySettings = FRegistry::Settings;
+	LocalLobby.ApplyTo(LobbySettings);
+	Credentials LeaderCredentials;
+	Credentials MemberCredentials;
+	SetLocalUser(LeaderCredentials, TEXT("leader"));
+	SetLocalUser(MemberCredentials, TEXT("member"));
+	Lobby Leader(LeaderCredentials, LobbySettings);
+	Lobby Member(MemberCredentials, LobbySettings);
+
+	Leader.Connect();
+	Member.Connect();
+	bool bIsConnected = WaitUntil([&]() { return Leader.IsConnected() && Member.IsConnected() && LocalLobby.GetConnectionCount() == 2; });
+
+	FAccelByteModelsCreatePartyResponse Created;
+	Leader.SetCreatePartyResponseDelegate(Lobby::FPartyCreateResponse::CreateLambda([&](const FAccelByteModelsCreatePartyResponse& Result)
+	{
+		Created = Result;
+	}));
+	Leader.SendCreatePartyRequest();
+	WaitUntil([&]() { return !Created.PartyId.IsEmpty(); });
+
+	FAccelByteModelsPartyGetInvitedNotice Invitation;
+	Member.SetPartyGetInvitedNotifDelegate(Lobby::FPartyGetInvitedNotif::CreateLambda([&](const FAccelByteModelsPartyGetInvitedNotice& Result)
+	{
+		Invitation = Result;
+	}));
+	Leader.SendInviteToPartyRequest(TEXT("member"));
+	WaitUntil([&]() { return !Invitation.InvitationToken.IsEmpty(); });
+
+	FAccelByteModelsPartyJoinReponse Joined;
+	FString JoinedUserId;
+	Member.SetInvitePartyJoinResponseDelegate(Lobby::FPartyJoinResponse::CreateLambda([&](const FAccelByteModelsPartyJoinReponse& Result)
+	{
+		Joined = Result;
+	}));
+	Leader.SetPartyJoinNotifDelegate(Lobby::FPartyJoinNotif::CreateLambda([&](const FAccelByteModelsPartyJoinNotice& Result)
+	{
+		JoinedUserId = Result.UserId;
+	}));
+	Member.SendAcceptInvitationRequest(Invitation.PartyId, Invitation.InvitationToken);
+	WaitUntil([&]() { return Joined.Members.Num() > 0 && !JoinedUserId.IsEmpty(); });
+
+	FString PartyMessage;
+	Leader.SetPartyChatNotifDelegate(Lobby::FPartyChatNotif::CreateLambda([&](const FAccelByteModelsPartyMessageNotice& Result)
+	{
+		PartyMessage = Result.Payload;
+	}));
+	Member.SendPartyMessage(TEXT("hello"));
+	WaitUntil([&]() { return !PartyMessage.IsEmpty(); });
+
+	FString AcceptedBy;
+	Member.SetOnIncomingRequestFriendsNotifDelegate(Lobby::FRequestFriendsNotif::CreateLambda([&](const FAccelByteModelsRequestFriendsNotif& Result)
+	{
+		Member.AcceptFriend(Result.friendId);
+	}));
+	Leader.SetOnFriendRequestAcceptedNotifDelegate(Lobby::FAcceptFriendsNotif::CreateLambda([&](const FAccelByteModelsAcceptFriendsNotif& Result)
+	{
+		AcceptedBy = Result.friendId;
+	}));
+	Leader.RequestFriend(TEXT("member"));
+	WaitUntil([&]() { return !AcceptedBy.IsEmpty(); });
+
+	FAccelByteModelsUsersPresenceNotice Presence;
+	Leader.SetUserPresenceNotifDelegate(Lobby::FFriendStatusNotif::CreateLambda([&](const FAccelByteModelsUsersPresenceNotice& Result)
+	{
+		Presence = Result;
+	}));
+	Member.SendSetPresenceStatus(Availability::Busy, TEXT("testing"));
+	WaitUntil([&]() { return !Presence.UserID.IsEmpty(); });
+
+	FAccelByteModelsMatchmakingNotice Match;
+	Member.SetMatchmakingNotifDelegate(Lobby::FMatchmakingNotif::CreateLambda([&](const FAccelByteModelsMatchmakingNotice& Result)
+	{
+		Match = Result;
+	}));
+	Leader.SendStartMatchmaking(TEXT("local"));
+	WaitUntil([&]() { return !Match.MatchId.IsEmpty(); });
+
+	Leader.Disconnect();
+	Member.Disconnect();
+
+	check(bIsConnected);
+	check(Created.LeaderId == TEXT("leader"));
+	check(Invitation.From == TEXT("leader") && Invitation.PartyId == Created.PartyId);
+	check(Joined.Members.Num() == 2);
+	check(JoinedUserId == TEXT("member"));
+	check(PartyMessage == TEXT("hello"));
+	check(AcceptedBy == TEXT("member"));
+	check(Presence.UserID == TEXT("member") && Presence.Availability == TEXT("2") && Presence.Activity == TEXT("testing"));
+	check(Match.Status == EAccelByteMatchmakingStatus::Done && Match.PartyMember.Num() == 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(LocalLobbyNotificationStorm, "AccelByte.Tests.LocalLobby.NotificationStorm_IsParsedInOrder", AutomationFlagMaskLocalLobby);
+bool LocalLobbyNotificationStorm::RunTest(const FString& Parameters)
+{
+	const int32 StormSize = 5000;
+	FLocalHttpServer Server;
+	FLocalLobbyServer LocalLobby(Server);
+	check(Server.Start());
+
+	Settings LobbySettings = FRegistry::Settings;
+	LocalLobby.ApplyTo(LobbySettings);
+	Credentials UserCredentials;
+	SetLocalUser(UserCredentials, TEXT("storm"));
+	Lobby Target(UserCredentials, LobbySettings);
+
+	int32 ReceivedCount = 0;
+	int32 OutOfOrderCount = 0;
+	Target.SetMessageNotifDelegate(Lobby::FMessageNotif::CreateLambda([&](const FAccelByteModelsNotificationMessage& Result)
+	{
+		if (FCString::Atoi(*Result.Payload) != ReceivedCount)
+		{
+			OutOfOrderCount++;
+		}
+
+		ReceivedCount++;
+	}));
+	Target.Connect();
+	bool bIsConnected = WaitUntil([&]() { return Target.IsConnected() && LocalLobby.GetConnectionCount() == 1; });
+
+	double StartTime = FPlatformTime::Seconds();
+	LocalLobby.PushNotifications(TEXT("storm"), StormSize);
+	bool bIsReceived = WaitUntil([&]() { return ReceivedCount == StormSize; }, 60.0);
+	double Duration = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogAccelByteLocalLobbyTest, Log, TEXT("%d notifications parsed and dispatched in %.3fs, %.0f/s"), ReceivedCount, Duration, ReceivedCount / FMath::Max(Duration, 0.001));
+
+	Target.Disconnect();
+
+	check(bIsConnected);
+	check(bIsReceived);
+	check(OutOfOrderCount == 0);
+	check(LocalLobby.GetNotificationCount() == StormSize);
+
+	return true;
+}
@@ -0,0 +1,148 @@
+// Copyright (c) 2018-2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteHttpRetryTest, Log, All);
+
+/**
+ * @brief Requests and responses that never touch the network, completed by the test through SetStatus; shared by the scheduler tests and benchmarks.
+ */
+class MockHttpResponse : public IHttpResponse
+{
+public:
+	FString GetURL() override { return TEXT(""); };
+	FString GetURLParameter(const FString& ParameterName) override { return TEXT(""); };
+	FString GetHeader(const FString& HeaderName) override { return ResponseHeaders.FindRef(HeaderName); };
+	TArray<FString> GetAllHeaders() override { return Headers; };
+	FString GetContentType() override { return TEXT(""); };
+	int32 GetContentLength() override { return Content.Num(); };
+	const TArray<uint8>& GetContent() override { return Content; };
+
+	int32 GetResponseCode() override { return ResponseCode; }
+	FString GetContentAsString() override
+	{
+		FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+
+		return FString(Converted.Length(), Converted.Get());
+	}
+	
+	void SetResponseCode(int32 ResponseCode) { this->ResponseCode = ResponseCode; }
+	void SetHeader(const FString& HeaderName, const FString& HeaderValue) { ResponseHeaders.Add(HeaderName, HeaderValue); }
+	void SetContentAsString(const FString& ContentString)
+	{
+		FTCHARToUTF8 Converted(*ContentString);
+		Content.SetNum(Converted.Length());
+		FMemory::Memcpy(Content.GetData(), Converted.Get(), Converted.Length());
+	}
+	void SetContent(const TArray<uint8>& Bytes) { Content = Bytes; }
+
+private:
+	int32 ResponseCode;
+	TMap<FString, FString> ResponseHeaders;
+	TArray<FString> Headers;
+	TArray<uint8> Content;
+};
+
+class MockHttpRequest : public IHttpRequest
+{
+public:
+	FString GetURL() override { return URL; };
+	FString GetURLParameter(const FString& ParameterName) override { return TEXT(""); };
+	FString GetHeader(const FString& HeaderName) override { return Headers.FindRef(HeaderName); };
+	TArray<FString> GetAllHeaders() override
+	{
+		TArray<FString> Result;
+
+		for (const auto& Header : Headers)
+		{
+			Result.Add(Header.Key + TEXT(": ") + Header.Value);
+		}
+
+		return Result;
+	};
+	FString GetContentType() override { return GetHeader(TEXT("Content-Type")); };
+	int32 GetContentLength() override { return Content.Num(); };
+	const TArray<uint8>& GetContent() override { return Content; };
+
+	FString GetVerb() override { return Verb; };
+	void SetVerb(const FString& Verb) override { this->Verb = Verb; };
+	void SetURL(const FString& URL) override { this->URL = URL; };
+	void SetContent(const TArray<uint8>& ContentPayload) override { Content = ContentPayload; };
+	void SetContentAsString(const FString& ContentString) override 
+	{
+		FTCHARToUTF8 Converted(*ContentString);
+		Content.SetNum(Converted.Length());
+		FMemory::Memcpy(Content.GetData(), Converted.Get(), Converted.Length());
+	};
+	void SetHeader(const FString& HeaderName, const FString& HeaderValue) override { Headers.Add(HeaderName, HeaderValue); };
+	void AppendToHeader(const FString& HeaderName, const FString& AdditionalHeaderValue) override { Headers.FindOrAdd(HeaderName).Append(AdditionalHeaderValue); };
+	
+	bool ProcessRequest() override 
+	{
+		UE_LOG(LogAccelByteHttpRetryTest, Verbose, TEXT("Process Request"));
+		Status = EHttpRequestStatus::Processing;
+		++RetryCount;
+		
+		return true; 
+	};
+	
+	FHttpRequestCompleteDelegate& OnProcessRequestComplete() override { return RequestCompleteDelegate; };
+	FHttpRequestProgressDelegate& OnRequestProgress() override { return RequestProgressDelegate; };
+	
+	void CancelRequest() override 
+	{
+		UE_LOG(LogAccelByteHttpRetryTest, Verbose, TEXT("Cancel Request"));
+		SetStatus(EHttpRequestStatus::Failed_ConnectionError);
+	};
+	
+	EHttpRequestStatus::Type GetStatus() override { return Status; };
+	const FHttpResponsePtr GetResponse() const override { return Response; };
+	
+	void Tick(float DeltaSeconds) override 
+	{
+		if (Status != EHttpRequestStatus::Processing && Status != EHttpRequestStatus::NotStarted)
+		{
+			OnProcessRequestComplete().ExecuteIfBound(MakeShareable(this), Response, true);
+		}
+	}
+	
+	float GetElapsedTime() override { return 0.0; }
+
+	void SetStatus(EHttpRequestStatus::Type Status)
+	{
+		this->Status = Status;
+
+		// Real requests report completion through their delegate, the scheduler relies on it
+		if (Status != EHttpRequestStatus::Processing && Status != EHttpRequestStatus::NotStarted)
+		{
+			OnProcessRequestComplete().ExecuteIfBound(nullptr, Response, true);
+		}
+	}
+
+	MockHttpRequest() 
+		: RetryCount(0)
+		, Status(EHttpRequestStatus::NotStarted)
+		, Response(MakeShared<MockHttpResponse, ESPMode::ThreadSafe>())
+	{
+	}
+
+public:
+	int32 RetryCount;
+
+private:
+	FString Verb;
+	FString URL;
+	TMap<FString, FString> Headers;
+	TArray<uint8> Content;
+
+	EHttpRequestStatus::Type Status;
+	TSharedPtr<MockHttpResponse, ESPMode::ThreadSafe> Response;
+	FHttpRequestCompleteDelegate RequestCompleteDelegate;
+	FHttpRequestProgressDelegate RequestProgressDelegate;
+};
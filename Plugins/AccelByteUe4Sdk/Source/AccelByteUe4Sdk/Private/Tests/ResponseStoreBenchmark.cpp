@@ -0,0 +1,151 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "AutomationTest.h"
+#include "FileManager.h"
+#include "Misc/Paths.h"
+#include "HttpModule.h"
+#include "HttpManager.h"
+#include "AccelByteRegistry.h"
+#include "AccelByteHttpRetryScheduler.h"
+#include "AccelByteHttpRequestFactory.h"
+#include "AccelByteUserApi.h"
+#include "AccelByteUserProfileApi.h"
+#include "Core/AccelByteEndpoints.h"
+#include "Benchmark.h"
+#include "LocalBackend.h"
+#include "TestUtilities.h"
+
+using AccelByte::FErrorHandler;
+using AccelByte::FVoidHandler;
+using AccelByte::THandler;
+using AccelByte::Settings;
+using AccelByte::FRegistry;
+using AccelByte::FHttpRetryScheduler;
+using AccelByte::FHttpRequestFactory;
+using AccelByte::FHttpQuery;
+using AccelByte::Api::User;
+using AccelByte::Api::UserProfile;
+
+namespace
+{
+	const int32 RunCount = 5;
+	const double BackendLatency = 0.05;
+	const double LoadTimeout = 10.0;
+
+	/** Counts the answer down once it is decoded, as a menu waiting for its data would. */
+	template<typename T>
+	FHttpRequestCompleteDelegate CountDown(int32& PendingCount, bool& bIsFailed)
+	{
+		return AccelByte::CreateHttpResultHandler(THandler<T>::CreateLambda([&PendingCount](const T& Result)
+		{
+			PendingCount--;
+		}), FErrorHandler::CreateLambda([&PendingCount, &bIsFailed](int32 ErrorCode, const FString& ErrorMessage)
+		{
+			bIsFailed = true;
+			PendingCount--;
+		}));
+	}
+
+	/**
+	 * @brief Seconds from the first request of a new session until the catalog and the profile of the main menu are decoded.
+	 * The session gets its own scheduler on the response store, as after a restart of the game.
+	 */
+	double LoadMainMenu(FHttpRequestFactory& Factory, const FString& Directory, FLocalBackend& Backend, int32& OutRequestCount, bool& bIsFailed)
+	{
+		FHttpRetryScheduler Scheduler;
+		Scheduler.SetResponseStoreDirectory(Directory);
+		Scheduler.PollRetry(FPlatformTime::Seconds(), FRegistry::Credentials);
+		int32 RequestCountBefore = Backend.GetServer().GetRequestCount();
+		int32 PendingCount = 4;
+		double StartTime = FPlatformTime::Seconds();
+
+		Scheduler.ProcessRequest(Factory.Create(AccelByte::Endpoints::Category::GetRootCategories, {}, FHttpQuery().AddRequired(TEXT("language"), TEXT("en"))),
+			CountDown<TArray<FAccelByteModelsFullCategoryInfo>>(PendingCount, bIsFailed), FPlatformTime::Seconds());
+		Scheduler.ProcessRequest(Factory.Create(AccelByte::Endpoints::Category::GetDescendantCategories, { *FGenericPlatformHttp::UrlEncode(TEXT("/game")) }, FHttpQuery().AddRequired(TEXT("language"), TEXT("en"))),
+			CountDown<TArray<FAccelByteModelsFullCategoryInfo>>(PendingCount, bIsFailed), FPlatformTime::Seconds());
+		Scheduler.ProcessRequest(Factory.Create(AccelByte::Endpoints::Item::GetItemsByCriteria, {}, FHttpQuery().AddRequired(TEXT("categoryPath"), FGenericPlatformHttp::UrlEncode(TEXT("/game/items"))).AddRequired(TEXT("region"), TEXT("US")).Add(TEXT("page"), 0).Add(TEXT("size"), 20)),
+			CountDown<FAccelByteModelsItemPagingSlicedResult>(PendingCount, bIsFailed), FPlatformTime::Seconds());
+		Scheduler.ProcessRequest(Factory.Create(AccelByte::Endpoints::UserProfile::GetUserProfile),
+			CountDown<FAccelByteModelsUserProfileInfo>(PendingCount, bIsFailed), FPlatformTime::Seconds());
+
+		double Timeout = StartTime + LoadTimeout;
+
+		while (PendingCount > 0 && FPlatformTime::Seconds() < Timeout)
+		{
+			FHttpModule::Get().GetHttpManager().Tick(0.0f);
+			Scheduler.PollRetry(FPlatformTime::Seconds(), FRegistry::Credentials);
+			FPlatformProcess::Sleep(0.001f);
+		}
+
+		double Elapsed = FPlatformTime::Seconds() - StartTime;
+		bIsFailed |= PendingCount > 0;
+		OutRequestCount += Backend.GetServer().GetRequestCount() - RequestCountBefore;
+		Scheduler.SetResponseStoreDirectory(FString());
+
+		return Elapsed;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ResponseStoreBenchmarkTimeToInteractive, "AccelByte.Benchmarks.ResponseStore.TimeToInteractive", AutomationFlagMaskBenchmark);
+bool ResponseStoreBenchmarkTimeToInteractive::RunTest(const FString& Parameters)
+{
+	FBenchmarkReport Report(TEXT("ResponseStore"));
+	FLocalBackend::FConfig Config;
+	Config.Server.Latency = AccelByte::FLatencyDistribution::Constant(BackendLatency);
+	Config.CacheControl = TEXT("max-age=300");
+	FLocalBackend Backend(Config);
+	check(Backend.Start());
+
+	Settings OriginalSettings = FRegistry::Settings;
+	Backend.ApplyTo(FRegistry::Settings);
+	FRegistry::Credentials.ForgetAll();
+
+	// The sessions measured below start signed in with a profile
+	const FString Email = TEXT("warmstart@example.com");
+	const FString Password = TEXT("password");
+	User::LoginWithClientCredentials(FVoidHandler(), FErrorHandler());
+	FlushHttpRequests();
+	User::Register(Email, Password, TEXT("WarmStart"), THandler<FUserData>(), FErrorHandler());
+	FlushHttpRequests();
+	User::LoginWithUsername(Email, Password, FVoidHandler(), FErrorHandler());
+	FlushHttpRequests();
+	FAccelByteModelsUserProfileCreateRequest ProfileCreate;
+	ProfileCreate.FirstName = TEXT("Warm");
+	ProfileCreate.Language = TEXT("en");
+	UserProfile::CreateUserProfile(ProfileCreate, THandler<FAccelByteModelsUserProfileInfo>(), FErrorHandler());
+	FlushHttpRequests();
+
+	FHttpRequestFactory Factory(FRegistry::Settings, FRegistry::Credentials);
+	FString Directory = FPaths::ProjectSavedDir() / TEXT("AccelByteBenchmarks") / TEXT("ResponseStore");
+	TArray<double> ColdTimes;
+	TArray<double> WarmTimes;
+	int32 ColdRequestCount = 0;
+	int32 WarmRequestCount = 0;
+	bool bIsFailed = false;
+
+	for (int32 Run = 0; Run < RunCount; Run++)
+	{
+		// A first launch downloads everything, the next one renders from the store
+		IFileManager::Get().DeleteDirectory(*Directory, false, true);
+		ColdTimes.Add(LoadMainMenu(Factory, Directory, Backend, ColdRequestCount, bIsFailed));
+		WarmTimes.Add(LoadMainMenu(Factory, Directory, Backend, WarmRequestCount, bIsFailed));
+	}
+
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+	FRegistry::Credentials.ForgetAll();
+	FRegistry::Settings = OriginalSettings;
+	Backend.Shutdown();
+
+	TMap<FString, int64> Latency;
+	Latency.Add(TEXT("latency_ms"), static_cast<int64>(BackendLatency * 1000.0));
+	Report.Add(TEXT("TimeToInteractive.Cold"), Latency, FBenchmarkReport::Median(ColdTimes) * 1000.0, TEXT("ms"));
+	Report.Add(TEXT("TimeToInteractive.Warm"), Latency, FBenchmarkReport::Median(WarmTimes) * 1000.0, TEXT("ms"));
+	Report.Add(TEXT("TimeToInteractive.Cold.Requests"), Latency, static_cast<double>(ColdRequestCount) / RunCount, TEXT("requests"));
+	Report.Add(TEXT("TimeToInteractive.Warm.Requests"), Latency, static_cast<double>(WarmRequestCount) / RunCount, TEXT("requests"));
+	check(!bIsFailed);
+	check(!Report.Write().IsEmpty());
+
+	return true;
+}
@@ -8,7 +8,11 @@
 #include "HttpManager.h"
 #include "AccelByteRegistry.h"
 #include "AccelByteHttpRetryScheduler.h"
+#include "AccelByteHttpWorker.h"
 #include "FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "LocalBackend.h"
 
 using AccelByte::THandler;
 using AccelByte::FVoidHandler;
@@ -156,7 +160,7 @@ void FlushHttpRequests()
 {
 	double LastTickTime = FPlatformTime::Seconds();
 
-	while (FRegistry::HttpRetryScheduler.PollRetry(FPlatformTime::Seconds(), FRegistry::Credentials))
+	while (FRegistry::HttpWorker.PollGameThread())
 	{
 		FRegistry::Credentials.PollRefreshToken(FPlatformTime::Seconds());
 		FHttpModule::Get().GetHttpManager().Tick(FPlatformTime::Seconds() - LastTickTime);
@@ -166,3 +170,29 @@ void FlushHttpRequests()
 
 	FHttpModule::Get().GetHttpManager().Flush(false);
 }
+
+bool UseLocalBackendIfRequested()
+{
+	static TUniquePtr<FLocalBackend> Backend;
+
+	if (!FParse::Param(FCommandLine::Get(), TEXT("AccelByteLocalBackend")))
+	{
+		return false;
+	}
+
+	if (!Backend.IsValid())
+	{
+		Backend = MakeUnique<FLocalBackend>();
+		verify(Backend->Start());
+		// Its server thread must be stopped before the modules unload
+		FCoreDelegates::OnPreExit.AddLambda([]()
+		{
+			Backend.Reset();
+		});
+	}
+
+	// Applied every time, the local backend tests restore the settings they replaced
+	Backend->ApplyTo(FRegistry::Settings);
+
+	return true;
+}
@@ -34,3 +34,9 @@ void DeleteUserById(
 	const FSimpleDelegate& OnSuccess, 
 	const FErrorHandler& OnError);
 void FlushHttpRequests();
+
+/**
+ * @brief With -AccelByteLocalBackend on the command line, points FRegistry::Settings at a FLocalBackend shared by the integration tests instead of the configured services.
+ * @return True when the tests run against the local backend.
+ */
+bool UseLocalBackendIfRequested();
@@ -44,6 +44,8 @@ const auto GlobalErrorHandler = FErrorHandler::CreateLambda([](int32 ErrorCode,
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(UpdateUserAccountTest, "AccelByte.Tests.User.UpdateUserAccount", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter);
 bool UpdateUserAccountTest::RunTest(const FString& Parameters)
 {
+	UseLocalBackendIfRequested();
+
 	const FString OriginalEmail = FString::Printf(TEXT("originalEmail+%s@example.com"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
 	const FString UpdatedEmail = FString::Printf(TEXT("updatedEmail+%s@example.com"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
 	const FString Password = TEXT("password");
@@ -139,6 +141,8 @@ bool UpdateUserAccountTest::RunTest(const FString& Parameters)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(LoginGameClientSuccess, "AccelByte.Tests.User.LoginGameClient", AutomationFlagMaskUser);
 bool LoginGameClientSuccess::RunTest(const FString& Parameters)
 {
+	UseLocalBackendIfRequested();
+
 	User::ForgetAllCredentials();
 	bool bClientTokenObtained = false;
 	double LastTime = 0;
@@ -159,6 +163,8 @@ bool LoginGameClientSuccess::RunTest(const FString& Parameters)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUserRegisterTest, "AccelByte.Tests.User.RegisterEmail_ThenLogin", AutomationFlagMaskUser);
 bool FUserRegisterTest::RunTest(const FString & Parameter)
 {
+	UseLocalBackendIfRequested();
+
 	User::ForgetAllCredentials();
 	FString LoginId = "testeraccelbyte+ue4sdk" + FGuid::NewGuid().ToString(EGuidFormats::Digits) + "@game.test";
 	FString Password = "testtest";
@@ -219,6 +225,8 @@ bool FUserRegisterTest::RunTest(const FString & Parameter)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUserLoginTest, "AccelByte.Tests.User.LoginEmail_ThenVerify", AutomationFlagMaskUser);
 bool FUserLoginTest::RunTest(const FString & Parameter)
 {
+	UseLocalBackendIfRequested();
+
 	User::ForgetAllCredentials();
 	FString LoginId = "testeraccelbyte+" + FGuid::NewGuid().ToString(EGuidFormats::Digits) + "@game.test";
 	FString Password = "testtest";
@@ -307,6 +315,8 @@ bool FUserLoginTest::RunTest(const FString & Parameter)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUserResetPasswordTest, "AccelByte.Tests.User.RegisterEmail_ThenResetPassword", AutomationFlagMaskUser);
 bool FUserResetPasswordTest::RunTest(const FString & Parameter)
 {
+	UseLocalBackendIfRequested();
+
 	User::ForgetAllCredentials();
 	FString LoginId = "testeraccelbyte+" + FGuid::NewGuid().ToString(EGuidFormats::Digits) + "@game.test";
 	FString Password = "old_password";
@@ -396,6 +406,8 @@ bool FUserResetPasswordTest::RunTest(const FString & Parameter)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoginWithDeviceIdSuccess, "AccelByte.Tests.User.LoginWithDeviceId.LoginTwiceGetSameUserId", AutomationFlagMaskUser);
 bool FLoginWithDeviceIdSuccess::RunTest(const FString & Parameter)
 {
+	UseLocalBackendIfRequested();
+
 	User::ForgetAllCredentials();
 	FString FirstUserId = "";
 	FString SecondUserId = "";
@@ -451,6 +463,8 @@ bool FLoginWithDeviceIdSuccess::RunTest(const FString & Parameter)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoginWithDeviceIdUniqueIdCreated, "AccelByte.Tests.User.LoginWithDeviceId.UniqueUserIdCreatedForEachDevice", AutomationFlagMaskUser);
 bool FLoginWithDeviceIdUniqueIdCreated::RunTest(const FString & Parameter)
 {
+	UseLocalBackendIfRequested();
+
 	User::ForgetAllCredentials();
 	FString FirstUserId = "";
 	FString SecondUserId = "";
@@ -526,6 +540,8 @@ bool FLoginWithDeviceIdUniqueIdCreated::RunTest(const FString & Parameter)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUpgradeDeviceAccountSuccess, "AccelByte.Tests.User.UpgradeHeadlessDeviceAccount", AutomationFlagMaskUser);
 bool FUpgradeDeviceAccountSuccess::RunTest(const FString & Parameter)
 {
+	UseLocalBackendIfRequested();
+
 	User::ForgetAllCredentials();
 	FString Email = TEXT("testSDK@game.test");
 	FString Password = TEXT("password");
@@ -645,6 +661,8 @@ bool FUpgradeDeviceAccountSuccess::RunTest(const FString & Parameter)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoginWithSteamSuccess, "AccelByte.Tests.User.LoginWithSteam.LoginTwiceGetSameUserId", AutomationFlagMaskUser);
 bool FLoginWithSteamSuccess::RunTest(const FString & Parameter)
 {
+	UseLocalBackendIfRequested();
+
 	User::ForgetAllCredentials();
 	FString FirstUserId = "";
 	FString SecondUserId = "";
@@ -701,6 +719,8 @@ bool FLoginWithSteamSuccess::RunTest(const FString & Parameter)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoginWithSteamUniqueIdCreated, "AccelByte.Tests.User.LoginWithSteam.UniqueUserIdCreatedForSteamAccount", AutomationFlagMaskUser);
 bool FLoginWithSteamUniqueIdCreated::RunTest(const FString & Parameter)
 {
+	UseLocalBackendIfRequested();
+
 	User::ForgetAllCredentials();
 	FString FirstUserId = "";
 	FString SecondUserId = "";
@@ -775,6 +795,8 @@ bool FLoginWithSteamUniqueIdCreated::RunTest(const FString & Parameter)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUpgradeSteamAccountSuccess, "AccelByte.Tests.User.UpgradeHeadlessSteamAccount", AutomationFlagMaskUser);
 bool FUpgradeSteamAccountSuccess::RunTest(const FString & Parameter)
 {
+	UseLocalBackendIfRequested();
+
 	User::ForgetAllCredentials();
 	FString Email = TEXT("testSDKsteam@game.test");
 	FString Password = TEXT("password");
@@ -856,6 +878,8 @@ bool FUpgradeSteamAccountSuccess::RunTest(const FString & Parameter)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUserProfileUtilitiesSuccess, "AccelByte.Tests.User.GetAndUpdateProfile", AutomationFlagMaskUser);
 bool FUserProfileUtilitiesSuccess::RunTest(const FString & Parameter)
 {
+	UseLocalBackendIfRequested();
+
 	User::ForgetAllCredentials();
 	FAccelByteModelsUserProfileUpdateRequest ProfileUpdate;
 	ProfileUpdate.Language = "en";
@@ -961,6 +985,8 @@ bool FUserProfileUtilitiesSuccess::RunTest(const FString & Parameter)
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUpgradeAndVerifyHeadlessDeviceAccountSuccess, "AccelByte.Tests.User.UpgradeAndVerifyHeadlessDeviceAccount", AutomationFlagMaskUser);
 bool FUpgradeAndVerifyHeadlessDeviceAccountSuccess::RunTest(const FString & Parameter)
 {
+	UseLocalBackendIfRequested();
+
 	User::ForgetAllCredentials();
 	FString Email = FString::Printf(TEXT("upgradeAndVerify+%s@example.com"), *FGuid::NewGuid().ToString(EGuidFormats::Digits));
 	FString Password = TEXT("password");
@@ -1053,6 +1079,8 @@ bool FUpgradeAndVerifyHeadlessDeviceAccountSuccess::RunTest(const FString & Para
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetSteamTicket, "AccelByte.Tests.User.SteamTicket", AutomationFlagMaskUser);
 bool FGetSteamTicket::RunTest(const FString & Parameter)
 {
+	UseLocalBackendIfRequested();
+
 	FString Ticket = GetSteamTicket();
 	UE_LOG(LogAccelByteUserTest, Log, TEXT("Print Steam Ticket :\r\n%s"), *Ticket);
 	check(Ticket != TEXT(""));
@@ -1098,5 +1126,11 @@ FString GetSteamTicket()
 	CurrentDirectory.Replace(TEXT("/"), TEXT("\\"));
 	FFileHelper::LoadFileToString(SteamTicket, *CurrentDirectory);
 
+	// The local backend takes any ticket as the id of one Steam account
+	if (SteamTicket.IsEmpty() && UseLocalBackendIfRequested())
+	{
+		SteamTicket = TEXT("local-steam-ticket");
+	}
+
 	return SteamTicket;
 }
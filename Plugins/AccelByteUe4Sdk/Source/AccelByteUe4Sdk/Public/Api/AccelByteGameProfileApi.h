@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "AccelByteError.h"
+#include "AccelByteHttpRequestFactory.h"
 #include "Models/AccelByteGameProfileModels.h"
 
 // Forward declarations
@@ -30,6 +31,7 @@ public:
 private:
 	const Credentials& GameProfileCredentials;
 	const Settings& GameProfileSettings;
+	FHttpRequestFactory RequestFactory;
 
 public:
 
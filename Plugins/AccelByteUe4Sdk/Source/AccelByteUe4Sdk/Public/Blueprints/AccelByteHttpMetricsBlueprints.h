@@ -0,0 +1,25 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "AccelByteHttpMetricsModels.h"
+#include "AccelByteHttpMetricsBlueprints.generated.h"
+
+UCLASS(Blueprintable, BlueprintType)
+class UAccelByteBlueprintsHttpMetrics : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+public:
+	/**
+	 * @brief Snapshot of the SDK's request metrics by endpoint, e.g. for a debug overlay or a telemetry event.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AccelByte | Metrics | Api")
+	static FAccelByteModelsHttpMetrics GetHttpMetrics();
+
+	UFUNCTION(BlueprintCallable, Category = "AccelByte | Metrics | Api")
+	static void ResetHttpMetrics();
+};
@@ -9,6 +9,8 @@
 #include "JsonUtilities.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "UnrealTypeTraits.h"
+#include "AccelByteTrace.h"
+#include "AccelByteJsonDecoder.h"
 
 #include <unordered_map>
 
@@ -270,6 +272,8 @@ enum class ErrorCodes : int32
 	UnknownError = 14000,
 	JsonDeserializationFailed = 14001,
 	NetworkError = 14005,
+	ServiceCircuitOpen = 14006,
+	ResponseTooLarge = 14007,
 	WebSocketConnectFailed = 14201
 };
 
@@ -288,39 +292,148 @@ public:
 
 ACCELBYTEUE4SDK_API void HandleHttpError(FHttpRequestPtr Request, FHttpResponsePtr Response, int& OutCode, FString& OutMessage);
 
+/**
+ * @brief Runs a result handler on the game thread: queued when called from the SDK worker thread (see FHttpWorker), run in place otherwise.
+ */
+ACCELBYTEUE4SDK_API void RunOnGameThread(TFunction<void()> Function);
+
+template<class T>
+inline void DecodeHttpResult(FHttpResponsePtr Response, TArray<T>& OutResult)
+{
+	Trace::FScope TraceScope(TEXT("Json"), TEXT("Parse"));
+	JsonDecoder::Decode(Response, OutResult);
+}
+
+template<class T>
+inline void DecodeHttpResult(FHttpResponsePtr Response, T& OutResult)
+{
+	Trace::FScope TraceScope(TEXT("Json"), TEXT("Parse"));
+	JsonDecoder::Decode(Response, OutResult);
+}
+
+/**
+ * @brief Decoded results of one response, by result type.
+ */
+using FHttpDecodedResults = TMap<const void*, TSharedPtr<void, ESPMode::ThreadSafe>>;
+
+/**
+ * @brief Scope in which one response is delivered to several handlers (e.g. coalesced requests); each result type is decoded only once.
+ */
+class ACCELBYTEUE4SDK_API FHttpResultFanOut
+{
+public:
+	explicit FHttpResultFanOut(const FHttpResponsePtr& Response);
+	/**
+	 * @brief Reuses results decoded by earlier scopes of the same response, e.g. a cached response served again.
+	 */
+	FHttpResultFanOut(const FHttpResponsePtr& Response, const TSharedRef<FHttpDecodedResults, ESPMode::ThreadSafe>& Results);
+	~FHttpResultFanOut();
+
+	static bool IsActive(const FHttpResponsePtr& Response)
+	{
+		FHttpResultFanOut* Current = GetCurrent();
+
+		return Current != nullptr && Response.IsValid() && Current->Response == Response;
+	}
+
+	template<class T>
+	static TSharedRef<T, ESPMode::ThreadSafe> FindOrDecode(const FHttpResponsePtr& Response)
+	{
+		static const uint8 TypeTag = 0;
+		FHttpResultFanOut* Current = GetCurrent();
+
+		if (TSharedPtr<void, ESPMode::ThreadSafe>* Result = Current->Results->Find(&TypeTag))
+		{
+			return StaticCastSharedPtr<T>(*Result).ToSharedRef();
+		}
+
+		TSharedRef<T, ESPMode::ThreadSafe> Result = MakeShared<T, ESPMode::ThreadSafe>();
+		DecodeHttpResult(Response, Result.Get());
+		Current->Results->Add(&TypeTag, Result);
+
+		return Result;
+	}
+
+private:
+	FHttpResponsePtr Response;
+	TSharedRef<FHttpDecodedResults, ESPMode::ThreadSafe> Results;
+	FHttpResultFanOut* Previous;
+
+	/** Innermost scope of the calling thread; the worker and the game thread deliver responses at the same time. */
+	static FHttpResultFanOut* GetCurrent();
+};
+
 inline void HandleHttpResultOk(FHttpResponsePtr Response, const FVoidHandler& OnSuccess)
 {
-	OnSuccess.ExecuteIfBound();
+	RunOnGameThread([OnSuccess]()
+	{
+		OnSuccess.ExecuteIfBound();
+	});
 }
 
 template<class T>
 inline void HandleHttpResultOk(FHttpResponsePtr Response, const THandler<TArray<T>>& OnSuccess)
 {
-	TArray<T> Result;
-	FJsonObjectConverter::JsonArrayStringToUStruct(Response->GetContentAsString(), &Result, 0, 0);
-
-	OnSuccess.ExecuteIfBound(Result);
+	// Decoded where the response is handled, only the typed result is passed to the game thread
+	TSharedPtr<TArray<T>, ESPMode::ThreadSafe> Result;
+
+	if (FHttpResultFanOut::IsActive(Response))
+	{
+		Result = FHttpResultFanOut::FindOrDecode<TArray<T>>(Response);
+	}
+	else
+	{
+		Result = MakeShared<TArray<T>, ESPMode::ThreadSafe>();
+		DecodeHttpResult(Response, *Result);
+	}
+
+	RunOnGameThread([OnSuccess, Result]()
+	{
+		OnSuccess.ExecuteIfBound(*Result);
+	});
 }
 
 template<>
 inline void HandleHttpResultOk<uint8>(FHttpResponsePtr Response, const THandler<TArray<uint8>>& OnSuccess)
 {
-	OnSuccess.ExecuteIfBound(Response->GetContent());
+	RunOnGameThread([OnSuccess, Response]()
+	{
+		OnSuccess.ExecuteIfBound(Response->GetContent());
+	});
 }
 
 template<class T>
 inline void HandleHttpResultOk(FHttpResponsePtr Response, const THandler<T>& OnSuccess)
 {
-	std::remove_const<std::remove_reference<T>::type>::type Result;
-	FJsonObjectConverter::JsonObjectStringToUStruct(Response->GetContentAsString(), &Result, 0, 0);
-
-	OnSuccess.ExecuteIfBound(Result);
+	typedef typename std::remove_const<typename std::remove_reference<T>::type>::type FResult;
+
+	TSharedPtr<FResult, ESPMode::ThreadSafe> Result;
+
+	if (FHttpResultFanOut::IsActive(Response))
+	{
+		Result = FHttpResultFanOut::FindOrDecode<FResult>(Response);
+	}
+	else
+	{
+		Result = MakeShared<FResult, ESPMode::ThreadSafe>();
+		DecodeHttpResult(Response, *Result);
+	}
+
+	RunOnGameThread([OnSuccess, Result]()
+	{
+		OnSuccess.ExecuteIfBound(*Result);
+	});
 }
 
 template<>
 inline void HandleHttpResultOk<FString>(FHttpResponsePtr Response, const THandler<FString>& OnSuccess)
 {
-	OnSuccess.ExecuteIfBound(Response->GetContentAsString());
+	FString Result = Response->GetContentAsString();
+
+	RunOnGameThread([OnSuccess, Result]()
+	{
+		OnSuccess.ExecuteIfBound(Result);
+	});
 }
 
 template<class T>
@@ -339,7 +452,11 @@ FHttpRequestCompleteDelegate CreateHttpResultHandler(const T& OnSuccess, const F
 			int32 Code;
 			FString Message;
 			HandleHttpError(Request, Response, Code, Message);
-			OnError.ExecuteIfBound(Code, Message);
+
+			RunOnGameThread([OnError, Code, Message]()
+			{
+				OnError.ExecuteIfBound(Code, Message);
+			});
 		});
 }
 
@@ -0,0 +1,47 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpResponse.h"
+
+namespace AccelByte
+{
+namespace HttpCompression
+{
+	/**
+	 * @brief Accept-Encoding sent with every request built by FHttpRequestFactory.
+	 */
+	extern ACCELBYTEUE4SDK_API const TCHAR* const AcceptEncoding;
+
+	struct FCompressionStats
+	{
+		int32 CompressedRequests;
+		/** Request body bytes not sent thanks to gzip. */
+		int64 RequestBytesSaved;
+		int32 DecompressedResponses;
+		/** Response body bytes not received thanks to gzip or deflate. */
+		int64 ResponseBytesSaved;
+	};
+
+	/**
+	 * @brief gzip stream of a body; false when it would not be smaller.
+	 */
+	ACCELBYTEUE4SDK_API bool Compress(const uint8* Content, int32 ContentSize, TArray<uint8>& OutCompressed);
+
+	/**
+	 * @brief Body decoded from a gzip or deflate Content-Encoding; false when it is not encoded that way or is damaged.
+	 */
+	ACCELBYTEUE4SDK_API bool Decompress(const FString& Encoding, const TArray<uint8>& Content, TArray<uint8>& OutContent);
+
+	/**
+	 * @brief Response with its body decoded from its Content-Encoding; the response itself when it is not encoded or was already decoded by the platform.
+	 * A body that decodes to more than the SDK accepts becomes a 502 carrying ErrorCodes::ResponseTooLarge.
+	 */
+	ACCELBYTEUE4SDK_API FHttpResponsePtr Decompress(const FHttpResponsePtr& Response);
+
+	ACCELBYTEUE4SDK_API FCompressionStats GetStats();
+}
+}
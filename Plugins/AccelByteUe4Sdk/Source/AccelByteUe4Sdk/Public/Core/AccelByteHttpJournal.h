@@ -0,0 +1,83 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Append-only file of the writes that have not reached the backend yet, so they survive a lost connection or a crash and are replayed in order.
+ * Each record carries a size and a CRC; a torn record at the end of the file, left by a crash while appending, is dropped when the journal is opened.
+ */
+class ACCELBYTEUE4SDK_API FHttpJournal
+{
+public:
+	struct FEntry
+	{
+		int64 Sequence;
+		FString Verb;
+		FString Url;
+		/** "Name: Value" pairs without Authorization, which is signed again with the token of the replay. */
+		TArray<FString> Headers;
+		TArray<uint8> Content;
+		/** Sent by its original request or by a replay, it can't be replayed or superseded until that ends. */
+		bool bIsInFlight;
+		/** Answers of the backend that did not settle it (throttled, rejected token, server error) in this session. */
+		int32 UnsettledAnswers;
+	};
+
+	/** Unsettled answers after which a write is dropped; it would otherwise hold back every later write for good. */
+	static const int32 MaxUnsettledAnswers = 8;
+
+	FHttpJournal();
+
+	/**
+	 * @brief Loads the pending writes of a journal file; the file is created when missing and rewritten when its end is torn.
+	 */
+	void Open(const FString& JournalPath);
+	void Close();
+	bool IsOpen() const;
+	const FString& GetPath() const;
+
+	/**
+	 * @brief Records a write sent now, in flight until Complete or Release; earlier pending PUT or DELETE of the same URL are superseded by it.
+	 * @return Sequence number of the write, 0 when the journal is closed.
+	 */
+	int64 Append(const FHttpRequestPtr& Request);
+
+	/**
+	 * @brief The backend answered the write, it is never replayed.
+	 */
+	void Complete(int64 Sequence);
+
+	/**
+	 * @brief The write did not reach the backend or its answer did not settle it (bIsAnswered), it is replayed later.
+	 * Dropped with a warning once it has MaxUnsettledAnswers; lost connections are not counted, the journal is there to wait them out.
+	 */
+	void Release(int64 Sequence, bool bIsAnswered = false);
+
+	/**
+	 * @brief Oldest pending write when it can be replayed now; nullptr when there is none or it is still in flight, later writes wait for it.
+	 */
+	FEntry* GetNextReplay();
+
+	int32 Num() const;
+
+private:
+	void Compact();
+	bool WriteRecord(uint8 Type, int64 Sequence, FEntry* Entry);
+
+	FString Path;
+	/** Pending writes by sequence. */
+	TArray<FEntry> Entries;
+	int64 NextSequence;
+	/** Records in the file that no longer stand for a pending write. */
+	int32 DeadRecords;
+};
+
+} // Namespace AccelByte
@@ -0,0 +1,135 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Log-linear histogram in the style of HdrHistogram: every power of two is split in 8 buckets, so any recorded value is known within 12.5%.
+ * Recording is a few atomic increments and may happen on any thread; reads are approximate while values are being recorded.
+ */
+class ACCELBYTEUE4SDK_API FHttpHistogram
+{
+public:
+	/** Values are clamped below 2^MaxValueBits, about 19 hours in microseconds or 64 GB in bytes. */
+	static const int32 MaxValueBits = 36;
+	static const int32 SubBucketBits = 3;
+	static const int32 SubBucketCount = 1 << SubBucketBits;
+	static const int32 BucketCount = (MaxValueBits - SubBucketBits + 1) * SubBucketCount;
+
+	FHttpHistogram();
+
+	void Record(int64 Value);
+
+	int64 GetCount() const;
+	int64 GetSum() const;
+	int64 GetMax() const;
+	double GetMean() const;
+
+	/**
+	 * @brief Highest value of the bucket the percentile (0 to 1) falls in, 0 when nothing was recorded.
+	 */
+	int64 GetPercentile(float Percentile) const;
+
+	void Reset();
+
+	static int32 GetBucketIndex(int64 Value);
+	static int64 GetBucketUpperBound(int32 Index);
+
+private:
+	FThreadSafeCounter Counts[BucketCount];
+	FThreadSafeCounter64 Count;
+	FThreadSafeCounter64 Sum;
+	volatile int64 Max;
+};
+
+/**
+ * @brief Why a request reached its caller without a successful response.
+ */
+enum class EHttpFailureReason : uint8
+{
+	None,
+	/** No connection or the connection dropped. */
+	ConnectionError,
+	/** Cancelled at its deadline. */
+	Timeout,
+	/** Failed locally without being sent: expired before it left its queue. */
+	Expired,
+	/** Failed locally because the breaker of its service is open. */
+	CircuitOpen,
+	RateLimited,
+	/** 4xx other than 429. */
+	ClientError,
+	ServerError,
+	Count
+};
+
+/**
+ * @brief Everything recorded for the requests of one endpoint template (see HttpRequest::GetEndpointTemplate).
+ * Times are in microseconds.
+ */
+struct ACCELBYTEUE4SDK_API FHttpEndpointMetrics
+{
+	/** From the request to its first attempt leaving the admission queue. */
+	FHttpHistogram QueueWait;
+	/** From the dispatch of an attempt to the first bytes of its response, when the platform reports download progress. */
+	FHttpHistogram TimeToFirstByte;
+	/** From the request to its completion, over all attempts. */
+	FHttpHistogram Latency;
+	FHttpHistogram Attempts;
+	/** Body bytes sent, after compression. */
+	FHttpHistogram RequestBytes;
+	/** Body bytes received, before decompression. */
+	FHttpHistogram ResponseBytes;
+	/** Completed requests by failure reason, None counting the successful ones. */
+	FThreadSafeCounter Failures[static_cast<int32>(EHttpFailureReason::Count)];
+
+	void Reset();
+};
+
+/**
+ * @brief Metrics of the requests sent through one scheduler, by endpoint template, and gauges of its queues.
+ * Endpoints are only added by the scheduler's thread; queries may come from any thread.
+ */
+class ACCELBYTEUE4SDK_API FHttpMetrics
+{
+public:
+	typedef TSharedRef<FHttpEndpointMetrics, ESPMode::ThreadSafe> FEndpointRef;
+
+	/**
+	 * @brief Metrics of the endpoint, created on first use; only called from the scheduler's thread.
+	 */
+	FEndpointRef FindOrAdd(const FString& EndpointTemplate);
+
+	/**
+	 * @brief Metrics of the endpoint, nullptr when it was never requested.
+	 */
+	TSharedPtr<FHttpEndpointMetrics, ESPMode::ThreadSafe> Find(const FString& EndpointTemplate) const;
+
+	TArray<FString> GetEndpoints() const;
+
+	/** Requests waiting in an admission queue. */
+	FThreadSafeCounter QueuedRequests;
+	/** Attempts sent and not finished yet. */
+	FThreadSafeCounter InFlightRequests;
+
+	/**
+	 * @brief Zeroes every histogram and counter; the gauges keep following the scheduler.
+	 */
+	void Reset();
+
+	static const TCHAR* GetFailureReasonName(EHttpFailureReason Reason);
+
+private:
+	mutable FCriticalSection Mutex;
+	TMap<FString, FEndpointRef> Endpoints;
+};
+
+} // Namespace AccelByte
@@ -0,0 +1,140 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+#include "AccelByteSettings.h"
+#include "AccelByteCredentials.h"
+
+#include <initializer_list>
+
+namespace AccelByte
+{
+
+/**
+ * @brief Backend service of an endpoint; its base URL is taken from Settings.
+ */
+enum class EHttpService : uint8
+{
+	Iam,
+	Platform,
+	Basic,
+	CloudStorage,
+	GameProfile,
+	Count
+};
+
+/**
+ * @brief What the Authorization header of an endpoint carries.
+ */
+enum class EHttpAuthorization : uint8
+{
+	None,
+	/** Bearer with the user access token. */
+	User,
+	/** Bearer with the client access token. */
+	Client,
+	/** Basic with the client id and secret from Settings. */
+	Basic
+};
+
+/**
+ * @brief Static description of one REST endpoint.
+ * Path is relative to the service URL. {namespace}, {clientNamespace}, {gameNamespace} and {userId} are filled from Credentials and Settings, every {} takes the next argument given to FHttpRequestFactory::Create.
+ */
+struct FHttpEndpoint
+{
+	const TCHAR* Verb;
+	EHttpService Service;
+	const TCHAR* Path;
+	EHttpAuthorization Authorization;
+	/** Content-Type of the body, nullptr when the request has none or sets it itself (e.g. multipart boundaries). */
+	const TCHAR* ContentType = nullptr;
+	const TCHAR* Accept = TEXT("application/json");
+	/** Bodies above the factory's threshold are sent gzip encoded unless the service can't take them. */
+	bool bCompressBody = true;
+};
+
+/**
+ * @brief Query string of one request; empty string values are skipped unless added with AddRequired.
+ */
+class ACCELBYTEUE4SDK_API FHttpQuery
+{
+public:
+	FHttpQuery& Add(const TCHAR* Name, const FString& Value);
+	FHttpQuery& Add(const TCHAR* Name, int32 Value);
+	/**
+	 * @brief Sent even when empty, for parameters the service rejects the request without (e.g. region of items/byCriteria).
+	 */
+	FHttpQuery& AddRequired(const TCHAR* Name, const FString& Value);
+
+	bool IsEmpty() const { return Query.IsEmpty(); }
+	const FString& ToString() const { return Query; }
+
+private:
+	void Append(const TCHAR* Name, const TCHAR* Value, int32 ValueLength);
+
+	FString Query;
+};
+
+/**
+ * @brief Builds requests from endpoint descriptors: the URL is written into a buffer sized up front and the Authorization header is rebuilt only when the token changes.
+ * Every request accepts gzip and deflate responses, the scheduler decodes them (see HttpCompression).
+ * Game thread only, like the Credentials it reads: the cached headers are rewritten without a lock and handed out by reference.
+ */
+class ACCELBYTEUE4SDK_API FHttpRequestFactory
+{
+public:
+	FHttpRequestFactory(const Settings& Settings, const Credentials& Credentials);
+
+	FHttpRequestPtr Create(const FHttpEndpoint& Endpoint, std::initializer_list<const TCHAR*> Arguments = {}, const FHttpQuery& Query = FHttpQuery());
+
+	/**
+	 * @brief Full URL of an endpoint, e.g. https://example.accelbyte.io/platform/public/namespaces/game01/items/0a1b2c/locale?region=US
+	 */
+	FString CreateUrl(const FHttpEndpoint& Endpoint, std::initializer_list<const TCHAR*> Arguments = {}, const FHttpQuery& Query = FHttpQuery()) const;
+
+	/**
+	 * @brief Basic header of explicit client credentials, for the OAuth calls that take them as arguments.
+	 */
+	const FString& GetBasicAuthorization(const FString& ClientId, const FString& ClientSecret);
+
+	/**
+	 * @brief Sets the UTF-8 body of a request, gzip encoded when the endpoint allows it and it is at least the compression threshold.
+	 */
+	void SetContent(const FHttpRequestPtr& Request, const FHttpEndpoint& Endpoint, const FString& Content);
+
+	/**
+	 * @brief Smallest body in bytes that is compressed, 1 KB by default; 0 disables request compression.
+	 */
+	void SetCompressionThreshold(int32 Threshold);
+
+private:
+	const FString& GetServiceUrl(EHttpService Service) const;
+	const FString& GetAuthorization(EHttpAuthorization Authorization);
+	void ForEachPathSegment(const FHttpEndpoint& Endpoint, std::initializer_list<const TCHAR*> Arguments, TFunctionRef<void(const TCHAR*, int32)> Visit) const;
+
+	/**
+	 * @brief Header built from one credential, kept until the credential changes.
+	 */
+	struct FCachedAuthorization
+	{
+		/** Token, or client id for Basic. */
+		FString Credential;
+		FString Secret;
+		FString Header;
+	};
+
+	const Settings& FactorySettings;
+	const Credentials& FactoryCredentials;
+	FCachedAuthorization UserAuthorization;
+	FCachedAuthorization ClientAuthorization;
+	FCachedAuthorization BasicAuthorization;
+	FString EmptyAuthorization;
+	int32 CompressionThreshold;
+};
+
+}
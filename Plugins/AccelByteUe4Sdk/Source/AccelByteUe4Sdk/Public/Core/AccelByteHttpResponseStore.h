@@ -0,0 +1,93 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpResponse.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Cached GET responses kept on disk between sessions, in one directory per namespace and user.
+ * An index holds the validators and lifetimes, each body lives in its own file and is only read, and checked against its CRC, when it is served.
+ */
+class ACCELBYTEUE4SDK_API FHttpResponseStore
+{
+public:
+	struct FEntry
+	{
+		FString Url;
+		FString ContentType;
+		FString ETag;
+		FString LastModified;
+		/** Wall clock (UTC) until which the response is fresh. */
+		FDateTime FreshUntil;
+		/** Wall clock (UTC) until which the response may be served while it is revalidated. */
+		FDateTime StaleUntil;
+		FDateTime LastUsed;
+		uint32 Crc;
+		int64 Size;
+	};
+
+	FHttpResponseStore();
+	~FHttpResponseStore();
+
+	/**
+	 * @brief Directory of a user's entries under the store's root.
+	 */
+	static FString GetPartitionDirectory(const FString& RootDirectory, const FString& Namespace, const FString& UserId);
+
+	/**
+	 * @brief Writes the open partition back and loads the index of another one; a missing or damaged index starts empty.
+	 */
+	void Open(const FString& PartitionDirectory);
+	void Close();
+	bool IsOpen() const;
+	const FString& GetDirectory() const;
+
+	const FEntry* Find(const FString& Key) const;
+
+	/**
+	 * @brief Reads a stored body as a response; the entry is dropped when its file is missing or does not match its CRC.
+	 */
+	FHttpResponsePtr Read(const FString& Key);
+
+	/**
+	 * @brief Stores a 200 response, its body is written at once, the index on the next Flush.
+	 */
+	void Write(const FString& Key, const FString& Url, const FHttpResponsePtr& Response, const FDateTime& FreshUntil, const FDateTime& StaleUntil);
+
+	/**
+	 * @brief New lifetimes of a stored response that was revalidated.
+	 */
+	void Touch(const FString& Key, const FDateTime& FreshUntil, const FDateTime& StaleUntil);
+	void Remove(const FString& Key);
+	void RemoveIf(TFunctionRef<bool(const FEntry&)> Predicate);
+
+	/**
+	 * @brief Drops the least recently used entries until the bodies fit in the budget.
+	 */
+	void Trim(int64 Budget);
+
+	/**
+	 * @brief Writes the index when entries changed since the last flush.
+	 */
+	void Flush();
+
+	int64 GetSize() const;
+
+private:
+	FString GetBodyPath(const FString& Key) const;
+	FString GetIndexPath() const;
+	void LoadIndex();
+
+	FString Directory;
+	TMap<FString, FEntry> Entries;
+	int64 Size;
+	bool bIsDirty;
+};
+
+} // Namespace AccelByte
@@ -8,6 +8,9 @@
 #include <ctime>
 
 #include "HttpRetrySystem.h"
+#include "AccelByteHttpResponseStore.h"
+#include "AccelByteHttpJournal.h"
+#include "AccelByteHttpMetrics.h"
 #include "Runtime/Core/Public/Containers/Ticker.h"
 
 #include "AutomationTest.h"
@@ -34,21 +37,365 @@ using namespace std;
 namespace AccelByte
 {
 
+class FHttpWorker;
+class FHttpRetryScheduler;
+
 namespace HttpRequest
 {
 	bool IsFinished(const FHttpRequestPtr& Request);
+	/**
+	 * @brief Base URL of the service a request goes to, e.g. https://example.accelbyte.io/platform for https://example.accelbyte.io/platform/public/...
+	 */
+	FString GetServiceUrl(const FString& Url);
+	/**
+	 * @brief What a write to the URL may change: the URL without its query and last segment, never above its service, e.g. https://example.accelbyte.io/basic/public/namespaces/game01/users/me for .../users/me/profiles
+	 */
+	FString GetParentPath(const FString& Url);
+	/**
+	 * @brief Key of the rate limit bucket a request belongs to: the verb and the URL path with its id segments replaced, e.g. GET https://example.accelbyte.io/platform/public/namespaces/game01/items/{id}
+	 */
+	FString GetEndpointTemplate(const FString& Verb, const FString& Url);
+	/**
+	 * @brief Seconds to wait before the next request according to the Retry-After header, negative when the response has none.
+	 */
+	double GetRetryAfter(const FHttpResponsePtr& Response);
+	/**
+	 * @brief Whether the backend applies the request once however many times it is sent: idempotent verbs, and POST or PATCH that carry an Idempotency-Key.
+	 */
+	bool IsRetrySafe(const FHttpRequestPtr& Request);
 }
 
+/**
+ * @brief Admission class of a request; lanes are dispatched in this order when the service is saturated.
+ */
+enum class EHttpRequestClass : uint8
+{
+	Auth,
+	Commerce,
+	Interactive,
+	Background,
+	Count
+};
+
+/**
+ * @brief State of the circuit breaker of one service URL.
+ */
+enum class ECircuitState : uint8
+{
+	/** Requests are sent normally. */
+	Closed,
+	/** The service is failing, requests fail locally with ErrorCodes::ServiceCircuitOpen. */
+	Open,
+	/** One probe request is sent; its outcome closes or re-opens the breaker. */
+	HalfOpen
+};
+
+/**
+ * @brief How long and how often one request is retried; the default keeps the scheduler's historical budget.
+ */
+struct FHttpRetryPolicy
+{
+	/** Seconds an attempt may stay in flight before it is cancelled and sent again, 0 lets it run until the deadline. */
+	double AttemptTimeout;
+	/** Attempts including the first one, 0 retries until the deadline. */
+	int32 MaxAttempts;
+	double InitialDelay;
+	double MaximumDelay;
+	float BackoffMultiplier;
+	/** Random part of each delay as a fraction of it. */
+	float Jitter;
+	/** Response codes that are sent again instead of being reported. */
+	TArray<int32> RetryableStatuses;
+	/** Seconds from the request time to the deadline, used when Deadline is not set. */
+	double Timeout;
+	/** Absolute deadline on the scheduler's clock, 0 for RequestTime + Timeout. */
+	double Deadline;
+	/** Sends a second copy of a GET that is slower than usual for its endpoint; the first successful response wins. */
+	bool bIsHedged;
+	/** Latency percentile of the endpoint after which the second copy is sent. */
+	float HedgePercentile;
+	/** Kept in the write journal until the backend answers it, so it is replayed after a lost connection or a crash (see SetJournalDirectory). */
+	bool bIsDurable;
+	/** Gives POST and PATCH requests an Idempotency-Key kept by all their attempts, so they are retried like idempotent ones; without a key they are only sent again when the backend surely did not process them.
+	 * Only for endpoints whose service applies a key once (see Keyed), others would take the retries as new writes. */
+	bool bIsIdempotencyKeyed;
+
+	FHttpRetryPolicy();
+
+	/**
+	 * @brief Calls a player is waiting for: short attempts, few retries.
+	 */
+	static FHttpRetryPolicy Interactive();
+
+	/**
+	 * @brief Sync and other background traffic: attempts are never cut short, long deadline.
+	 */
+	static FHttpRetryPolicy Background();
+
+	/**
+	 * @brief Uploads: a background policy whose deadline leaves time to send the whole body over a slow uplink.
+	 */
+	static FHttpRetryPolicy Upload(int64 ContentLength);
+
+	/**
+	 * @brief Idempotent reads on the critical path, where tail latency matters more than a few extra requests.
+	 */
+	static FHttpRetryPolicy Hedged();
+
+	/**
+	 * @brief Writes of player state that must not be lost offline: interactive attempts, then journaled and replayed in order.
+	 */
+	static FHttpRetryPolicy Durable();
+
+	/**
+	 * @brief Writes to endpoints that apply each Idempotency-Key once: Policy whose POST and PATCH attempts carry a key.
+	 * Orders and registration use it only when Settings::bRetryKeyedWrites says the backend honors keys.
+	 */
+	static FHttpRetryPolicy Keyed(FHttpRetryPolicy Policy = FHttpRetryPolicy());
+};
+
+/**
+ * @brief Holds the requests sent through a scheduler on this thread until the scope ends, then hands them over together, grouped by service so they reuse the same connections.
+ * Identical GETs of the batch are sent once (see coalescing). OnComplete runs on the game thread after the handlers of every request of the batch.
+ */
+class FHttpBatchScope
+{
+public:
+	explicit FHttpBatchScope(FHttpRetryScheduler& Scheduler, const FVoidHandler& OnComplete = FVoidHandler());
+	~FHttpBatchScope();
+
+	int32 Num() const;
+
+private:
+	friend class FHttpRetryScheduler;
+
+	struct FHeldRequest
+	{
+		FHttpRequestPtr Request;
+		FHttpRequestCompleteDelegate CompleteDelegate;
+		double RequestTime;
+		EHttpRequestClass RequestClass;
+		FHttpRetryPolicy Policy;
+	};
+
+	/**
+	 * @brief Innermost scope open on this thread for the scheduler, nullptr when requests are sent at once.
+	 */
+	static FHttpBatchScope* Find(const FHttpRetryScheduler& Scheduler);
+
+	FHttpRetryScheduler& Scheduler;
+	FVoidHandler OnComplete;
+	TArray<FHeldRequest> Requests;
+	FHttpBatchScope* Previous;
+};
+
 class FHttpRetryScheduler
 {
 public:
 	static const int InitialDelay = 1;
 	static const int MaximumDelay = 30;
 	static const int TotalTimeout = 60;
+	/** Seconds a request rejected with 401/403 waits for the user token to be refreshed. */
+	static const int ParkTimeout = 10;
+	static const int MaxParkedRequests = 64;
+
+	FHttpRetryScheduler();
 
-	bool ProcessRequest(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime);
+	/**
+	 * @brief Requests sent from inside another request's completion delegate never outlive that request's deadline.
+	 * CompleteDelegate runs on the scheduler's thread: the SDK worker once it is started (see SetWorker), the thread calling PollRetry otherwise.
+	 * Handlers made by CreateHttpResultHandler hand their results to the game thread; other delegates must not touch UObjects or game state, or forward to it with RunOnGameThread.
+	 * The request's OnProcessRequestComplete must be unbound, the scheduler binds it.
+	 */
+	bool ProcessRequest(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, EHttpRequestClass RequestClass = EHttpRequestClass::Interactive, const FHttpRetryPolicy& Policy = FHttpRetryPolicy());
 	bool PollRetry(double CurrentTime, Credentials& UserCredentials);
 
+	/**
+	 * @brief Sends the requests of a closed batch scope in one go, from the scheduler's thread.
+	 */
+	void ProcessBatch(TArray<FHttpBatchScope::FHeldRequest>&& Requests);
+
+	/**
+	 * @brief Number of requests that are still owned by the scheduler.
+	 */
+	int32 GetTaskCount() const;
+
+	/**
+	 * @brief Bytes held by the tasks and the bookkeeping of the scheduler; the requests, responses and what delegates capture are not counted.
+	 */
+	SIZE_T GetAllocatedSize() const;
+
+	struct FCoalescingStats
+	{
+		/** GET requests that joined an identical request already in flight. */
+		int64 Hits;
+		/** GET requests that had to be sent. */
+		int64 Misses;
+	};
+
+	/**
+	 * @brief Counters of the single-flight layer that merges identical in-flight GET requests.
+	 */
+	FCoalescingStats GetCoalescingStats() const;
+
+	struct FLaneStats
+	{
+		/** Requests waiting for a free slot. */
+		int32 QueueDepth;
+		/** Requests sent and not finished yet. */
+		int32 InFlight;
+		int64 DispatchedCount;
+		/** Seconds spent in the queue, summed over dispatched requests. */
+		double TotalWaitTime;
+		double MaxWaitTime;
+	};
+
+	/**
+	 * @brief Queue depth and wait time of one admission lane.
+	 */
+	FLaneStats GetLaneStats(EHttpRequestClass RequestClass) const;
+
+	/**
+	 * @brief Maximum requests of a class in flight to one service URL (see HttpRequest::GetServiceUrl).
+	 */
+	void SetMaxInFlight(EHttpRequestClass RequestClass, int32 MaxInFlight);
+
+	/**
+	 * @brief Maximum requests of all classes in flight to one service URL.
+	 */
+	void SetMaxInFlightPerService(int32 MaxInFlight);
+
+	struct FThrottlingStats
+	{
+		/** 429 responses received from the backend. */
+		int64 RateLimitedResponses;
+		/** Requests held locally until their endpoint's bucket allowed them. */
+		int64 DelayedRequests;
+		/** Seconds spent held locally, summed over dispatched requests. */
+		double TotalDelayTime;
+		/** Endpoint templates that currently hold requests back. */
+		int32 ThrottledEndpoints;
+	};
+
+	/**
+	 * @brief Counters of the client side rate limiter fed by Retry-After and X-RateLimit-* response headers.
+	 */
+	FThrottlingStats GetThrottlingStats() const;
+
+	struct FCircuitBreakerConfig
+	{
+		/** Seconds of attempt outcomes the failure and slow call rates are computed over. */
+		double Window;
+		/** Outcomes needed in the window before the breaker may open. */
+		int32 MinimumCalls;
+		float FailureRateThreshold;
+		/** Attempts that take at least this many seconds count as slow. */
+		double SlowCallDuration;
+		float SlowCallRateThreshold;
+		/** Seconds the breaker stays open before a probe is let through; doubled each time the probe fails. */
+		double OpenDuration;
+		double MaximumOpenDuration;
+
+		FCircuitBreakerConfig();
+	};
+
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FCircuitStateChanged, const FString& /* ServiceUrl */, ECircuitState /* State */);
+
+	/**
+	 * @brief State of the breaker guarding the service the URL belongs to, e.g. FRegistry::Settings.PlatformServerUrl.
+	 */
+	ECircuitState GetCircuitState(const FString& Url) const;
+
+	void SetCircuitBreakerConfig(const FCircuitBreakerConfig& Config);
+
+	/**
+	 * @brief Broadcast on every breaker state change so the game can hide or restore features of that service.
+	 */
+	FCircuitStateChanged& OnCircuitStateChanged();
+
+	struct FHedgingStats
+	{
+		/** Second copies sent. */
+		int64 Sent;
+		/** Second copies that answered first. */
+		int64 Won;
+		/** Second copies cancelled because the original answered first. */
+		int64 Cancelled;
+		/** Second copies not sent because of the global cap. */
+		int64 Capped;
+	};
+
+	FHedgingStats GetHedgingStats() const;
+
+	/**
+	 * @brief Maximum second copies in flight over all endpoints; they are also limited to a tenth of the hedged requests.
+	 */
+	void SetMaxHedgesInFlight(int32 MaxInFlight);
+
+	struct FResponseCacheStats
+	{
+		/** GET requests answered from a fresh cached response. */
+		int64 Hits;
+		/** GET requests answered from a stale cached response while it was revalidated in the background. */
+		int64 StaleHits;
+		/** Conditional requests answered with 304 Not Modified. */
+		int64 Revalidations;
+		/** Cacheable GET requests that downloaded a full response. */
+		int64 Misses;
+		/** Responses read back from the disk store. */
+		int64 Restored;
+		int32 Entries;
+		/** Bytes held by the cached response bodies. */
+		int64 Size;
+	};
+
+	/**
+	 * @brief Counters of the cache of GET responses that carry an ETag, a Last-Modified date or a max-age.
+	 */
+	FResponseCacheStats GetResponseCacheStats() const;
+
+	/**
+	 * @brief Bytes of response bodies the cache may hold, least recently used entries are dropped first; 0 disables the cache.
+	 */
+	void SetResponseCacheBudget(int64 Budget);
+
+	/**
+	 * @brief Keeps the response cache on disk under the directory, in one partition per namespace and user, so a new session starts with the last one's responses.
+	 * Stored responses that expired less than MaxStaleAge seconds ago are served once more while they are revalidated; an empty directory keeps the cache in memory only.
+	 */
+	void SetResponseStoreDirectory(const FString& Directory, double MaxStaleAge = 86400.0);
+
+	/**
+	 * @brief Journals durable writes under the directory, in one file per namespace and user; writes the backend did not answer are replayed in order once it is reachable again, also in a later session.
+	 * An empty directory stops journaling, pending writes stay in their file.
+	 */
+	void SetJournalDirectory(const FString& Directory);
+
+	/**
+	 * @brief Durable writes of the current user the backend has not answered yet.
+	 */
+	int32 GetPendingWriteCount() const;
+
+	/**
+	 * @brief Latency, size and failure histograms by endpoint template, and the queue gauges; safe to read from any thread.
+	 */
+	FHttpMetrics& GetMetrics();
+
+	/**
+	 * @brief Creates the copies sent by hedging and the replayed writes, from the current HttpTransport by default.
+	 */
+	void SetRequestFactory(const TFunction<FHttpRequestPtr()>& Factory);
+
+	/**
+	 * @brief Thread that owns the scheduler once started; requests, responses and settings from other threads are forwarded to it, other threads read the stats it published at its last poll.
+	 */
+	void SetWorker(FHttpWorker* HttpWorker);
+
+	/**
+	 * @brief Deadline of the request whose delegates are running, 0 outside of them.
+	 */
+	double GetInheritedDeadline() const;
+
 private:
 	class FHttpRetryTask
 	{
@@ -56,15 +403,262 @@ private:
 		const FHttpRequestPtr Request;
 		const FHttpRequestCompleteDelegate CompleteDelegate;
 		const double RequestTime;
+		const FHttpRetryPolicy Policy;
+		double Deadline;
+		int32 AttemptCount;
+		bool bIsAttemptTimedOut;
 		float NextDelay;
 		double NextRetryTime;
+		bool bIsRetryPending;
+		FString CoalescingKey;
+		TArray<FHttpRequestCompleteDelegate> JoinedDelegates;
+		EHttpRequestClass RequestClass;
+		FString ServiceUrl;
+		bool bIsDispatched;
+		FString EndpointTemplate;
+		double ThrottledSince;
+		double DispatchTime;
+		bool bIsProbe;
+		bool bIsReplayed;
+		/** Bearer the request was rejected with while it waits for a refreshed one. */
+		FString ParkedToken;
+		double ParkedSince;
+		/** Completes the task instead of the request's own response when set, e.g. for requests rejected locally. */
+		FHttpResponsePtr LocalResponse;
+		FHttpRequestPtr HedgeRequest;
+		double HedgeTime;
+		/** Body size of the winning hedge as received, LocalResponse holds it decoded; -1 when no hedge won. */
+		int32 HedgeResponseBytes;
+		/** Key of the response cache entry the response is stored in, empty when the request is not cacheable. */
+		FString CacheKey;
+		bool bIsServedFromCache;
+		/** Cached response whose validators were sent, what a 304 answer stands for. */
+		FHttpResponsePtr ValidatedResponse;
+		/** Journal entry of a durable write, 0 when the request is not journaled. */
+		int64 JournalSequence;
+		FString JournalPath;
+		bool bIsJournalReplay;
+		TSharedPtr<FHttpEndpointMetrics, ESPMode::ThreadSafe> Metrics;
+		uint64 DispatchCycles;
+		/** Set by the request's progress delegate, which may run on another thread. */
+		FThreadSafeCounter64 FirstByteCycles;
+		/** Correlates the trace events of the request (see Trace), 0 when it started while tracing was disabled. */
+		uint64 TraceId;
 
-		FHttpRetryTask(const FHttpRequestPtr& HttpRequest, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, double NextDelay);
+		FHttpRetryTask(const FHttpRequestPtr& HttpRequest, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime, const FHttpRetryPolicy& Policy);
+		/** Grows the backoff delay and sets when the next attempt is sent. */
 		void ScheduleNextRetry(double CurrentTime);
+		/** Sets when the attempt in flight is checked again, at the latest when its attempt timeout expires. */
+		void ScheduleNextCheck(double CurrentTime);
+		bool CanRetry(double CurrentTime) const;
+		SIZE_T GetAllocatedSize() const;
+	};
+
+	/**
+	 * @brief Heap entry; a task can leave stale timers behind, they are skipped when the task is gone or rescheduled.
+	 */
+	struct FHttpRetryTimer
+	{
+		double Time;
+		TWeakPtr<FHttpRetryTask, ESPMode::ThreadSafe> Task;
+
+		bool operator<(const FHttpRetryTimer& Other) const { return Time < Other.Time; }
+	};
+
+	/**
+	 * @brief Last full response of one GET with its validators; the results decoded from it are served again as long as it is current.
+	 */
+	struct FCachedResponse
+	{
+		FString Url;
+		FHttpResponsePtr Response;
+		TSharedRef<FHttpDecodedResults, ESPMode::ThreadSafe> Results;
+		FString ETag;
+		FString LastModified;
+		/** Served without asking the backend until then. */
+		double FreshUntil;
+		/** Served while a revalidation runs in the background until then. */
+		double StaleUntil;
+		double LastUsed;
+		int64 Size;
+
+		FCachedResponse() : Results(MakeShared<FHttpDecodedResults, ESPMode::ThreadSafe>()), FreshUntil(0.0), StaleUntil(0.0), LastUsed(0.0), Size(0) {}
+	};
+
+	void ArmTimer(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task);
+	void OnTimerExpired(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime);
+	void OnRequestFinished(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime);
+	/** Arms the task's retry after its backoff delay, false when the deadline comes first. */
+	bool DeferRetry(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime);
+	void CompleteTask(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime);
+	static FString GetCoalescingKey(const FHttpRequestPtr& Request);
+	bool HasFreeSlot(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task) const;
+	bool Dispatch(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task);
+	bool ReleaseSlot(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task);
+	void DispatchQueued();
+	bool IsThrottled(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task);
+	void UpdateRateLimit(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime);
+	void Requeue(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task);
+	bool AdmitThroughCircuit(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task);
+	void RecordOutcome(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime);
+	void Reject(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task);
+	bool IsCircuitOpen(const FString& ServiceUrl) const;
+	bool Park(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime);
+	void PollParkedTasks(double CurrentTime, Credentials& UserCredentials);
+	void RecordLatency(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime);
+	bool GetLatencyPercentile(const FString& EndpointTemplate, float Percentile, double& OutLatency) const;
+	void ArmHedge(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task);
+	FHttpRequestPtr CopyRequest(const FHttpRequestPtr& Request);
+	void SendHedge(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task);
+	void OnHedgeFinished(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime);
+	void CancelHedge(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task);
+	bool ServeFromCache(const FHttpRequestPtr& Request, const FHttpRequestCompleteDelegate& CompleteDelegate, const FString& CacheKey, double RequestTime);
+	void Revalidate(const FHttpRequestPtr& Request, const FCachedResponse& Cached, double RequestTime);
+	void UpdateResponseCache(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, FHttpResponsePtr& Response, double CurrentTime);
+	void InvalidateResponseCache(const FString& Path);
+	void TrimResponseCache();
+	static FString GetStoreKey(const FHttpRequestPtr& Request);
+	void RestoreResponse(const FHttpRequestPtr& Request, const FString& CacheKey, double RequestTime);
+	void PollResponseStore(double CurrentTime, const Credentials& UserCredentials);
+	void UpdateJournal(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, const FHttpResponsePtr& Response, double CurrentTime);
+	void PollJournal(double CurrentTime, const Credentials& UserCredentials);
+	void RecordMetrics(const TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>& Task, double CurrentTime);
+	void ReplayNextWrite(double CurrentTime, const Credentials& UserCredentials);
+	void RunOnSchedulerThread(TFunction<void()> Function);
+	/** True on a thread other than the running worker's, which must forward to it instead of touching the scheduler. */
+	bool IsOffSchedulerThread() const;
+	void PublishStats();
+	/** The clock read now, in the time base the callers pass to PollRetry and ProcessRequest. */
+	double GetCurrentTime() const;
+	void ScheduleRefreshToken(Credentials& UserCredentials, double CurrentTime);
+
+	struct FServiceSlots
+	{
+		int32 InFlight;
+		int32 LaneInFlight[static_cast<int32>(EHttpRequestClass::Count)];
+
+		FServiceSlots() : InFlight(0) { FMemory::Memzero(LaneInFlight); }
+	};
+
+	/**
+	 * @brief Token bucket of one endpoint template; a zero capacity means only the Retry-After window applies.
+	 */
+	struct FRateLimitBucket
+	{
+		double Tokens;
+		double Capacity;
+		double RefillRate;
+		double LastRefillTime;
+		double BlockedUntil;
+
+		FRateLimitBucket() : Tokens(0.0), Capacity(0.0), RefillRate(0.0), LastRefillTime(0.0), BlockedUntil(0.0) {}
+	};
+
+	struct FCircuitBreaker
+	{
+		struct FOutcome
+		{
+			double Time;
+			bool bIsFailure;
+			bool bIsSlow;
+		};
+
+		ECircuitState State;
+		TArray<FOutcome> Outcomes;
+		double OpenUntil;
+		double OpenDuration;
+		bool bIsProbeInFlight;
+
+		FCircuitBreaker() : State(ECircuitState::Closed), OpenUntil(0.0), OpenDuration(0.0), bIsProbeInFlight(false) {}
+	};
+
+	void SetCircuitState(const FString& ServiceUrl, FCircuitBreaker& Breaker, ECircuitState State, double CurrentTime);
+
+	/**
+	 * @brief Ring of the last first-attempt latencies of one endpoint template.
+	 */
+	struct FLatencyHistory
+	{
+		TArray<float> Samples;
+		int32 Next;
+
+		FLatencyHistory() : Next(0) {}
+	};
+
+	/**
+	 * @brief Stats as of the worker's last poll, returned by the getters called from other threads.
+	 */
+	struct FStatsSnapshot
+	{
+		int32 TaskCount;
+		FCoalescingStats Coalescing;
+		FLaneStats Lanes[static_cast<int32>(EHttpRequestClass::Count)];
+		FThrottlingStats Throttling;
+		/** Services whose breaker is not closed. */
+		TMap<FString, ECircuitState> CircuitStates;
+		FHedgingStats Hedging;
+		FResponseCacheStats ResponseCache;
+		int32 PendingWrites;
+
+		FStatsSnapshot() : TaskCount(0), Coalescing(), Lanes(), Throttling(), Hedging(), ResponseCache(), PendingWrites(0) {}
 	};
 
 private:
-	TArray<TSharedRef<FHttpRetryTask>> RetryList;
+	TSet<TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>> Tasks;
+	TArray<FHttpRetryTimer> RetryTimers;
+	TMap<FString, TWeakPtr<FHttpRetryTask, ESPMode::ThreadSafe>> InFlightGets;
+	FCoalescingStats CoalescingStats;
+	TArray<TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>> LaneQueues[static_cast<int32>(EHttpRequestClass::Count)];
+	FLaneStats LaneStats[static_cast<int32>(EHttpRequestClass::Count)];
+	int32 LaneMaxInFlight[static_cast<int32>(EHttpRequestClass::Count)];
+	int32 MaxInFlightPerService;
+	TMap<FString, FServiceSlots> ServiceSlots;
+	TMap<FString, FRateLimitBucket> RateLimitBuckets;
+	FThrottlingStats ThrottlingStats;
+	TMap<FString, FCircuitBreaker> CircuitBreakers;
+	FCircuitBreakerConfig CircuitBreakerConfig;
+	FCircuitStateChanged CircuitStateChanged;
+	/** Tasks answered without sending their request (rejected, expired or cached), completed from the next poll. */
+	TArray<TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>> LocalTasks;
+	TArray<TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe>> ParkedTasks;
+	/** Deadline of the request whose delegates are running, 0 outside of them. */
+	double InheritedDeadline;
+	TArray<FHttpRetryTimer> HedgeTimers;
+	TMap<FString, FLatencyHistory> LatencyHistories;
+	FHedgingStats HedgingStats;
+	int32 HedgesInFlight;
+	int32 MaxHedgesInFlight;
+	double HedgeTokens;
+	TMap<FString, FCachedResponse> ResponseCache;
+	FResponseCacheStats ResponseCacheStats;
+	int64 ResponseCacheBudget;
+	/** Set while a background revalidation is sent, so it is not answered from the cache itself. */
+	bool bIsRevalidating;
+	FHttpResponseStore ResponseStore;
+	FString ResponseStoreRoot;
+	double ResponseStoreMaxStaleAge;
+	double ResponseStoreFlushTime;
+	FHttpJournal Journal;
+	FString JournalRoot;
+	/** Set while a journaled write is sent again, so its task settles the existing entry instead of adding one. */
+	int64 ReplayingSequence;
+	/** Writes are replayed one at a time, in sequence order. */
+	bool bIsReplayInFlight;
+	double NextReplayTime;
+	double ReplayDelay;
+	FHttpMetrics Metrics;
+	TFunction<FHttpRequestPtr()> RequestFactory;
+	FHttpWorker* Worker;
+	/** User token a refresh was last scheduled for, so parked requests trigger one refresh per token. */
+	FString RefreshRequestedToken;
+	double LastPollTime;
+	mutable FCriticalSection StatsLock;
+	FStatsSnapshot PublishedStats;
+	/** Caller time minus FPlatformTime::Seconds(), so a completion is timed when the transport reports it. */
+	double ClockOffset;
+	bool bIsRefreshTokenRequested;
+	bool bIsDispatchingQueue;
+	bool bIsDispatchQueuePending;
 };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,39 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Where the SDK gets its HTTP requests from: the platform's HTTP module by default, a simulated backend in tests and benchmarks (see FSimulatedHttpTransport).
+ */
+class ACCELBYTEUE4SDK_API IHttpTransport
+{
+public:
+	virtual ~IHttpTransport() {}
+
+	virtual FHttpRequestPtr CreateRequest() = 0;
+};
+
+namespace HttpTransport
+{
+	/**
+	 * @brief New request from the current transport; every request of the SDK is created here.
+	 */
+	ACCELBYTEUE4SDK_API FHttpRequestPtr CreateRequest();
+
+	/**
+	 * @brief Replaces the transport of the requests created from now on, nullptr goes back to the platform's HTTP module.
+	 */
+	ACCELBYTEUE4SDK_API void Set(const TSharedPtr<IHttpTransport, ESPMode::ThreadSafe>& Transport);
+
+	ACCELBYTEUE4SDK_API TSharedPtr<IHttpTransport, ESPMode::ThreadSafe> Get();
+}
+
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Containers/Queue.h"
+#include "AccelByteCredentials.h"
+
+namespace AccelByte
+{
+
+class FHttpRetryScheduler;
+
+/**
+ * @brief SDK thread that owns the scheduler: requests are classified and responses are decoded there, the typed results come back to the game thread through a lock-free queue.
+ * Until Startup and after Shutdown everything runs on the thread that calls PollGameThread.
+ */
+class ACCELBYTEUE4SDK_API FHttpWorker : public FRunnable
+{
+public:
+	FHttpWorker(FHttpRetryScheduler& Scheduler, Credentials& UserCredentials);
+	virtual ~FHttpWorker();
+
+	bool Startup();
+	void Shutdown();
+	bool IsRunning() const;
+	bool IsInWorkerThread() const;
+
+	/**
+	 * @brief Runs the function on the worker thread, in place when the worker is not running or when called from it.
+	 */
+	void RunOnWorker(TFunction<void()> Function);
+
+	/**
+	 * @brief Runs the function from the next PollGameThread when called from the worker thread, in place otherwise.
+	 */
+	void RunOnGameThread(TFunction<void()> Function);
+
+	/**
+	 * @brief Asks Credentials on the game thread to refresh the user token.
+	 */
+	void ScheduleRefreshToken(double NextRefreshTime);
+
+	/**
+	 * @brief Deadline of the request whose results the game thread is delivering, 0 outside of them.
+	 */
+	double GetHandlerDeadline() const;
+
+	/**
+	 * @brief Game thread side: runs the finished handlers and hands the current tokens to the worker.
+	 * @return true while the scheduler still owns requests or handlers are waiting.
+	 */
+	bool PollGameThread();
+
+	virtual bool Init() override;
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	FHttpWorker(const FHttpWorker&) = delete;
+	FHttpWorker& operator=(const FHttpWorker&) = delete;
+
+	struct FGameThreadHandler
+	{
+		TFunction<void()> Function;
+		double Deadline;
+	};
+
+	FHttpRetryScheduler& Scheduler;
+	Credentials& UserCredentials;
+	/** Copy of UserCredentials the worker polls with, refreshed from PollGameThread when they change. */
+	Credentials WorkerCredentials;
+	/** Game thread copy of what was last sent to WorkerCredentials. */
+	Credentials SentCredentials;
+	TQueue<TFunction<void()>, EQueueMode::Mpsc> WorkerQueue;
+	TQueue<FGameThreadHandler, EQueueMode::Spsc> GameThreadQueue;
+	FRunnableThread* Thread;
+	FEvent* WakeUpEvent;
+	FThreadSafeBool bIsRunning;
+	FThreadSafeBool bIsStopping;
+	/** Scheduler task count as of the last worker poll. */
+	FThreadSafeCounter TaskCount;
+	/** Functions sent with RunOnWorker that have not run yet. */
+	FThreadSafeCounter PendingCount;
+	double HandlerDeadline;
+};
+
+}
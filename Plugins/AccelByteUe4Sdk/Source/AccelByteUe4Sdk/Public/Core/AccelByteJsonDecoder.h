@@ -0,0 +1,90 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpResponse.h"
+#include "JsonObjectConverter.h"
+
+namespace AccelByte
+{
+namespace JsonDecoder
+{
+	struct FDecoderStats
+	{
+		/** Documents read straight from their UTF-8 bytes into the result. */
+		int64 Streamed;
+		/** Documents handed to FJsonObjectConverter, e.g. malformed ones or ones with a value the decoder doesn't read the converter's way. */
+		int64 FellBack;
+	};
+
+	/**
+	 * @brief Fills OutStruct, an instance of Struct, from the UTF-8 JSON object in Content without converting it to an FString nor building an FJsonObject.
+	 * Properties are found through a layout table built once per struct; unknown fields are skipped without being decoded.
+	 * True only when OutStruct holds what FJsonObjectConverter::JsonObjectStringToUStruct would have made of the same bytes;
+	 * otherwise OutStruct may be partially filled and the caller resets it before falling back to the converter.
+	 */
+	ACCELBYTEUE4SDK_API bool TryDecodeObject(const UScriptStruct* Struct, void* OutStruct, const uint8* Content, int32 ContentSize);
+
+	/**
+	 * @brief Same as TryDecodeObject for a JSON array of Struct, as JsonArrayStringToUStruct reads it; AddElement returns a new default element.
+	 */
+	ACCELBYTEUE4SDK_API bool TryDecodeArray(const UScriptStruct* Struct, const uint8* Content, int32 ContentSize, TFunctionRef<void*()> AddElement);
+
+	/**
+	 * @brief Enabled by default; disabled, Decode always goes through FJsonObjectConverter, e.g. to compare both.
+	 */
+	ACCELBYTEUE4SDK_API void SetEnabled(bool bEnabled);
+	ACCELBYTEUE4SDK_API bool IsEnabled();
+
+	ACCELBYTEUE4SDK_API FDecoderStats GetStats();
+
+	/**
+	 * @brief Drop-in for FJsonObjectConverter::JsonObjectStringToUStruct(Response->GetContentAsString(), &OutResult, 0, 0), OutResult being freshly constructed.
+	 */
+	template<class T>
+	bool Decode(const FHttpResponsePtr& Response, T& OutResult)
+	{
+		if (IsEnabled())
+		{
+			const TArray<uint8>& Content = Response->GetContent();
+
+			if (TryDecodeObject(T::StaticStruct(), &OutResult, Content.GetData(), Content.Num()))
+			{
+				return true;
+			}
+
+			OutResult = T();
+		}
+
+		return FJsonObjectConverter::JsonObjectStringToUStruct(Response->GetContentAsString(), &OutResult, 0, 0);
+	}
+
+	/**
+	 * @brief Drop-in for FJsonObjectConverter::JsonArrayStringToUStruct(Response->GetContentAsString(), &OutResult, 0, 0), OutResult being empty.
+	 */
+	template<class T>
+	bool Decode(const FHttpResponsePtr& Response, TArray<T>& OutResult)
+	{
+		if (IsEnabled())
+		{
+			const TArray<uint8>& Content = Response->GetContent();
+			bool bIsDecoded = TryDecodeArray(T::StaticStruct(), Content.GetData(), Content.Num(), [&OutResult]() -> void*
+			{
+				return &OutResult[OutResult.AddDefaulted()];
+			});
+
+			if (bIsDecoded)
+			{
+				return true;
+			}
+
+			OutResult.Empty();
+		}
+
+		return FJsonObjectConverter::JsonArrayStringToUStruct(Response->GetContentAsString(), &OutResult, 0, 0);
+	}
+}
+}
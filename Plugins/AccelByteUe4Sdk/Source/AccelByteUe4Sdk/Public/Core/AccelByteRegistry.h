@@ -13,6 +13,8 @@ namespace AccelByte
 {
 
 class FHttpRetryScheduler;
+class FHttpWorker;
+class FHttpRequestFactory;
 
 namespace Api
 {
@@ -26,6 +28,8 @@ public:
 	static Settings Settings;
 	static Credentials Credentials;
 	static FHttpRetryScheduler HttpRetryScheduler;
+	static FHttpWorker HttpWorker;
+	static FHttpRequestFactory HttpRequestFactory;
 	static Api::Lobby Lobby;
 	static Api::GameProfile GameProfile;
 
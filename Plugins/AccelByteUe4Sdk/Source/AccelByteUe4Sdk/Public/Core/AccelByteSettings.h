@@ -26,6 +26,10 @@ public:
 	FString BasicServerUrl;
 	FString CloudStorageServerUrl;
 	FString GameProfileServerUrl;
+	bool bPersistResponseCache = false;
+	bool bJournalWrites = false;
+	bool bRetryKeyedWrites = false;
+	bool bTraceEnabled = false;
 };
 
 } // Namespace AccelByte
@@ -75,6 +79,22 @@ public:
 
 	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte | Settings")
 	FString GameProfileServerUrl;
+
+	/** Keeps cached GET responses under the project's saved directory, so the next launch starts from them. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte | Settings")
+	bool bPersistResponseCache;
+
+	/** Keeps profile and cloud save writes made offline under the project's saved directory and sends them once the backend is reachable again. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte | Settings")
+	bool bJournalWrites;
+
+	/** Sends orders and registrations with an Idempotency-Key and retries them after a lost answer; only for backends that apply each key once. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte | Settings")
+	bool bRetryKeyedWrites;
+
+	/** Records requests, token refreshes and lobby messages from startup; frames longer than 100 ms dump them as Chrome trace JSON under the project's saved directory. */
+	UPROPERTY(EditAnywhere, GlobalConfig, Category = "AccelByte | Settings")
+	bool bTraceEnabled;
 };
 
 
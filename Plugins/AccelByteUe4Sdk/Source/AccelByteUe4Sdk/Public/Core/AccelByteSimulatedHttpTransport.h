@@ -0,0 +1,133 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "AccelByteHttpTransport.h"
+
+namespace AccelByte
+{
+
+class FSimulatedHttpRequest;
+
+/**
+ * @brief Time a simulated backend takes to answer, network included, in seconds.
+ */
+struct ACCELBYTEUE4SDK_API FLatencyDistribution
+{
+	enum class EType : uint8
+	{
+		Constant,
+		Uniform,
+		/** Most answers near the median with a long tail, as measured on real services. */
+		LogNormal
+	};
+
+	EType Type;
+	double A;
+	double B;
+
+	static FLatencyDistribution Constant(double Latency);
+	static FLatencyDistribution Uniform(double Min, double Max);
+	static FLatencyDistribution LogNormal(double Median, double P99);
+
+	double Sample(FRandomStream& Random) const;
+};
+
+/**
+ * @brief Transport answering from a simulated backend on a virtual clock, with latency, losses, error statuses, a bandwidth cap and overload.
+ * Every random draw comes from one seeded stream and time only moves with Advance, so a run is reproduced exactly on any machine without a network.
+ * The transport and its requests are driven from one thread; completion delegates run from Advance.
+ */
+class ACCELBYTEUE4SDK_API FSimulatedHttpTransport : public IHttpTransport, public TSharedFromThis<FSimulatedHttpTransport, ESPMode::ThreadSafe>
+{
+public:
+	struct FConfig
+	{
+		FLatencyDistribution Latency = FLatencyDistribution::Constant(0.05);
+		/** Probability of each status answered instead of the responder's, e.g. { 503, 0.1f }. */
+		TMap<int32, float> StatusRates;
+		/** Probability that the connection is lost: the request fails with Failed_ConnectionError after its latency. */
+		float ConnectionErrorRate = 0.0f;
+		/** Probability that the backend never answers; such requests end at Timeout, or when cancelled. */
+		float NoResponseRate = 0.0f;
+		/** Attempts taking longer fail with Failed_ConnectionError at this time, like the platform's request timeout; 0 for none. */
+		double Timeout = 0.0;
+		/** Request and response bodies share one link of this many bytes per second, transfers wait for the ones before them; 0 for unlimited. */
+		double BandwidthBytesPerSecond = 0.0;
+		/** With this many requests in flight, new ones are answered 503; 0 for no limit. */
+		int32 OverloadThreshold = 0;
+		int32 Seed = 0;
+	};
+
+	struct FStats
+	{
+		int32 Sent = 0;
+		int32 Answered = 0;
+		int32 ConnectionErrors = 0;
+		int32 Overloaded = 0;
+		int32 TimedOut = 0;
+		int32 Cancelled = 0;
+		int64 BytesSent = 0;
+		int64 BytesReceived = 0;
+	};
+
+	/**
+	 * @brief Status and body of the backend's answer to a request, when no fault is injected.
+	 */
+	typedef TFunction<int32(const FHttpRequestPtr& Request, FString& OutContent)> FResponder;
+
+	explicit FSimulatedHttpTransport(const FConfig& Config = FConfig());
+
+	FHttpRequestPtr CreateRequest() override;
+
+	/**
+	 * @brief Answers 200 with an empty JSON object when not set.
+	 */
+	void SetResponder(const FResponder& Responder);
+
+	/**
+	 * @brief Moves the clock forward, completing the requests that end by then in the order they end.
+	 */
+	void Advance(double Seconds);
+	void AdvanceTo(double Time);
+
+	double GetTime() const;
+	int32 GetInFlightCount() const;
+	/** End of the earliest request in flight, 0 when none is due. */
+	double GetNextCompletionTime() const;
+	const FStats& GetStats() const;
+	const FConfig& GetConfig() const;
+
+private:
+	friend class FSimulatedHttpRequest;
+
+	struct FPendingRequest
+	{
+		TSharedRef<FSimulatedHttpRequest> Request;
+		double CompletionTime;
+		/** Ends in a response, a connection error otherwise. */
+		bool bIsAnswered;
+		bool bIsTimedOut;
+		int32 ResponseCode;
+		TArray<uint8> Content;
+	};
+
+	bool Submit(const TSharedRef<FSimulatedHttpRequest>& Request);
+	void Cancel(FSimulatedHttpRequest& Request);
+	void Complete(FPendingRequest& Completed);
+
+	FConfig Config;
+	FResponder Responder;
+	FRandomStream Random;
+	double Time;
+	/** When the last transfer queued on the link is done. */
+	double LinkFreeTime;
+	TArray<FPendingRequest> Pending;
+	FStats Stats;
+};
+
+}
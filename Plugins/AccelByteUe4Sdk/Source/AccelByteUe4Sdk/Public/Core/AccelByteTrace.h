@@ -0,0 +1,169 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace AccelByte
+{
+/**
+ * @brief Events of the SDK's requests, token refreshes and lobby messages, kept in a ring buffer and written as Chrome trace JSON (chrome://tracing, ui.perfetto.dev).
+ * Operations that span threads or frames are async events sharing one id from Begin to End; work done in one call is a scope.
+ * While tracing is disabled every call stops at one branch on a global flag and nothing is formatted or allocated.
+ */
+namespace Trace
+{
+	enum class EPhase : uint8
+	{
+		Begin,
+		End,
+		Instant,
+		/** A scope, with its duration. */
+		Complete
+	};
+
+	struct FEvent
+	{
+		const TCHAR* Category;
+		const TCHAR* Name;
+		/** Correlates the events of one async operation, 0 for scopes and thread instants. */
+		uint64 Id;
+		EPhase Phase;
+		uint32 ThreadId;
+		uint64 Cycles;
+		uint64 DurationCycles;
+		FString Detail;
+	};
+
+	static const int32 DefaultCapacity = 16 * 1024;
+
+	/** Read by every call site, only written by Enable and Disable. */
+	extern ACCELBYTEUE4SDK_API volatile bool bIsTraceEnabled;
+
+	FORCEINLINE bool IsEnabled()
+	{
+		return bIsTraceEnabled;
+	}
+
+	/**
+	 * @brief Starts recording into an empty ring buffer of Capacity events; the oldest events are overwritten once it is full.
+	 */
+	ACCELBYTEUE4SDK_API void Enable(int32 Capacity = DefaultCapacity);
+
+	/**
+	 * @brief Stops recording; the events recorded so far can still be dumped.
+	 */
+	ACCELBYTEUE4SDK_API void Disable();
+
+	ACCELBYTEUE4SDK_API uint64 AllocateId();
+	ACCELBYTEUE4SDK_API uint64 HashId(const FString& Key);
+	ACCELBYTEUE4SDK_API void Record(EPhase Phase, const TCHAR* Category, const TCHAR* Name, uint64 Id, const FString& Detail, uint64 Cycles = 0, uint64 DurationCycles = 0);
+
+	/**
+	 * @brief Id of a new async operation, 0 while tracing is disabled so the operation stays untraced to its end.
+	 */
+	FORCEINLINE uint64 NewId()
+	{
+		return IsEnabled() ? AllocateId() : 0;
+	}
+
+	/**
+	 * @brief Id derived from a key both ends of an operation know, e.g. the id of a lobby message and of its response.
+	 */
+	FORCEINLINE uint64 GetId(const FString& Key)
+	{
+		return IsEnabled() ? HashId(Key) : 0;
+	}
+
+	FORCEINLINE void Begin(const TCHAR* Category, const TCHAR* Name, uint64 Id, const FString& Detail = FString())
+	{
+		if (Id != 0 && IsEnabled())
+		{
+			Record(EPhase::Begin, Category, Name, Id, Detail);
+		}
+	}
+
+	FORCEINLINE void End(const TCHAR* Category, const TCHAR* Name, uint64 Id, const FString& Detail = FString())
+	{
+		if (Id != 0 && IsEnabled())
+		{
+			Record(EPhase::End, Category, Name, Id, Detail);
+		}
+	}
+
+	/**
+	 * @brief A step of the async operation Id, or of the calling thread when Id is 0.
+	 */
+	FORCEINLINE void Instant(const TCHAR* Category, const TCHAR* Name, uint64 Id, const FString& Detail = FString())
+	{
+		if (IsEnabled())
+		{
+			Record(EPhase::Instant, Category, Name, Id, Detail);
+		}
+	}
+
+	/**
+	 * @brief Records the work done until the end of the C++ scope as one event of the calling thread.
+	 */
+	class FScope
+	{
+	public:
+		FORCEINLINE FScope(const TCHAR* Category, const TCHAR* Name)
+			: Category(Category)
+			, Name(Name)
+			, StartCycles(IsEnabled() ? FPlatformTime::Cycles64() : 0)
+		{
+		}
+
+		FORCEINLINE ~FScope()
+		{
+			if (StartCycles != 0 && IsEnabled())
+			{
+				Record(EPhase::Complete, Category, Name, 0, Detail, StartCycles, FPlatformTime::Cycles64() - StartCycles);
+			}
+		}
+
+		/**
+		 * @brief Detail shown with the event, only kept when the scope is traced.
+		 */
+		FORCEINLINE void SetDetail(const FString& InDetail)
+		{
+			if (StartCycles != 0)
+			{
+				Detail = InDetail;
+			}
+		}
+
+	private:
+		const TCHAR* Category;
+		const TCHAR* Name;
+		uint64 StartCycles;
+		FString Detail;
+	};
+
+	/**
+	 * @brief Events in the buffer, oldest first.
+	 */
+	ACCELBYTEUE4SDK_API TArray<FEvent> GetEvents();
+
+	/**
+	 * @brief Events in the buffer as a Chrome trace JSON object.
+	 */
+	ACCELBYTEUE4SDK_API FString ToJson();
+
+	ACCELBYTEUE4SDK_API bool DumpToFile(const FString& Path);
+
+	/**
+	 * @brief Dumps the buffer into Directory when a frame takes longer than Threshold seconds, at most once every MinInterval seconds; an empty Directory stops it.
+	 * Dumps are written on a pool thread; this waits for the one in progress.
+	 */
+	ACCELBYTEUE4SDK_API void SetHitchDump(const FString& Directory, double Threshold, double MinInterval = 30.0);
+
+	/**
+	 * @brief Called once a frame from the game thread with the frame's duration.
+	 */
+	ACCELBYTEUE4SDK_API void OnFrame(float DeltaTime);
+}
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2019 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AccelByteHttpMetricsModels.generated.h"
+
+USTRUCT(BlueprintType)
+struct ACCELBYTEUE4SDK_API FAccelByteModelsHttpEndpointMetrics
+{
+	GENERATED_BODY()
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | EndpointMetrics")
+		FString Endpoint;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | EndpointMetrics")
+		int32 Requests;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | EndpointMetrics")
+		float LatencyP50Ms;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | EndpointMetrics")
+		float LatencyP95Ms;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | EndpointMetrics")
+		float LatencyP99Ms;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | EndpointMetrics")
+		float LatencyMaxMs;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | EndpointMetrics")
+		float QueueWaitP95Ms;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | EndpointMetrics")
+		float TimeToFirstByteP95Ms;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | EndpointMetrics")
+		float AverageAttempts;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | EndpointMetrics")
+		int32 RequestBytesP95;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | EndpointMetrics")
+		int32 ResponseBytesP95;
+	/** Completed requests by failure reason, None counting the successful ones. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | EndpointMetrics")
+		TMap<FString, int32> Failures;
+};
+
+USTRUCT(BlueprintType)
+struct ACCELBYTEUE4SDK_API FAccelByteModelsHttpMetrics
+{
+	GENERATED_BODY()
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | HttpMetrics")
+		TArray<FAccelByteModelsHttpEndpointMetrics> Endpoints;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | HttpMetrics")
+		int32 QueuedRequests;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AccelByte | Metrics | Models | HttpMetrics")
+		int32 InFlightRequests;
+};